@@ -3,6 +3,8 @@
 
 #include "Blenders/PCGExMetadataBlender.h"
 
+#include "Core/PCGExBlendPlan.h"
+#include "Core/PCGExMTCommon.h"
 #include "Core/PCGExOpStats.h"
 #include "Data/PCGBasePointData.h"
 #include "Data/PCGExData.h"
@@ -80,6 +82,16 @@ namespace PCGExBlending
 			Blenders.Add(Blender);
 		}
 
+		Plan = MakeShared<FBlendPlan>();
+		for (const TSharedPtr<FProxyDataBlender>& Blender : Blenders)
+		{
+			if (!Plan->Add(Blender))
+			{
+				Plan.Reset();
+				break;
+			}
+		}
+
 		return true;
 	}
 
@@ -93,6 +105,17 @@ namespace PCGExBlending
 		for (int i = 0; i < Blenders.Num(); i++) { Blenders[i]->Blend(SourceAIndex, SourceBIndex, TargetIndex, Weight); }
 	}
 
+	void FMetadataBlender::Blend(const int32 SourceAIndex, const int32 SourceBIndex, const PCGExMT::FScope& Scope, TConstArrayView<double> Weights) const
+	{
+		if (Plan)
+		{
+			Plan->Blend(SourceAIndex, SourceBIndex, Scope, Weights);
+			return;
+		}
+
+		PCGEX_SCOPE_LOOP(Index) { Blend(SourceAIndex, SourceBIndex, Index, Weights[Index - Scope.Start]); }
+	}
+
 	void FMetadataBlender::InitTrackers(TArray<PCGEx::FOpStats>& Trackers) const
 	{
 		Trackers.SetNumUninitialized(Blenders.Num());
@@ -8,6 +8,8 @@
 #include "Blenders/PCGExUnionBlender.h"
 
 #include "Containers/PCGExIndexLookup.h"
+#include "Core/PCGExBlendPlan.h"
+#include "Core/PCGExMTCommon.h"
 #include "Core/PCGExOpStats.h"
 #include "Data/PCGExData.h"
 #include "Data/Utils/PCGExDataFilterDetails.h"
@@ -252,6 +254,21 @@ namespace PCGExBlending
 			}
 		}
 
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(CompilePlan)
+
+			// Compile typed kernels once; fall back to per-source blending if any attribute can't be compiled
+			Plan = MakeShared<FBlendPlan>();
+			for (const TSharedPtr<FMultiSourceBlender>& MultiAttribute : Blenders)
+			{
+				if (!Plan->Add(MultiAttribute->MainBlender, MultiAttribute->SubBlenders))
+				{
+					Plan.Reset();
+					break;
+				}
+			}
+		}
+
 		return true;
 	}
 
@@ -272,6 +289,12 @@ namespace PCGExBlending
 	{
 		if (InWeightedPoints.IsEmpty()) { return; }
 
+		if (Plan)
+		{
+			Plan->MultiBlend(WriteIndex, InWeightedPoints);
+			return;
+		}
+
 		// For each attribute/property we want to blend
 		for (const TSharedPtr<FMultiSourceBlender>& MultiAttribute : Blenders)
 		{
@@ -290,6 +313,17 @@ namespace PCGExBlending
 		}
 	}
 
+	void FUnionBlender::Blend(const FBlendSources& InSources, TArray<PCGEx::FOpStats>& Trackers) const
+	{
+		if (!Plan)
+		{
+			IUnionBlender::Blend(InSources, Trackers);
+			return;
+		}
+
+		Plan->MultiBlend(InSources);
+	}
+
 	void FUnionBlender::MergeSingle(const int32 WriteIndex, const TSharedPtr<PCGExData::IUnionData>& InUnionData, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const
 	{
 		check(InUnionData)
@@ -303,6 +337,20 @@ namespace PCGExBlending
 		Blend(UnionIndex, OutWeightedPoints, Trackers);
 	}
 
+	void FUnionBlender::MergeScope(const PCGExMT::FScope& Scope, FBlendSources& OutSources, TArray<PCGExData::FWeightedPoint>& WeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const
+	{
+		// Gather every union's sources first, then blend the whole span kernel-major
+		OutSources.Reset(Scope.Count);
+		PCGEX_SCOPE_LOOP(Index)
+		{
+			WeightedPoints.Reset();
+			if (!ComputeWeights(Index, CurrentUnionMetadata->Get(Index), WeightedPoints)) { WeightedPoints.Reset(); }
+			OutSources.AddRow(Index, WeightedPoints);
+		}
+
+		Blend(OutSources, Trackers);
+	}
+
 	bool FUnionBlender::Validate(FPCGExContext* InContext, const bool bQuiet) const
 	{
 		if (TypeMismatches.IsEmpty()) { return true; }
@@ -0,0 +1,241 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExBlendPlan.h"
+
+#include "Core/PCGExBlendOperations.h"
+#include "Core/PCGExMTCommon.h"
+#include "Core/PCGExOpStats.h"
+#include "Core/PCGExProxyDataBlending.h"
+#include "Data/PCGExData.h"
+#include "Data/PCGExProxyData.h"
+#include "Helpers/PCGExMetaHelpers.h"
+
+namespace PCGExBlending
+{
+	namespace BlendPlan
+	{
+		//
+		// TAccessor - Typed view over a proxy
+		// Goes straight to the underlying buffer when there is no conversion nor sub-selection involved
+		//
+		template <typename T>
+		struct TAccessor
+		{
+			TSharedPtr<PCGExData::IBufferProxy> Proxy;
+			PCGExData::TBuffer<T>* Buffer = nullptr;
+
+			TAccessor() = default;
+
+			explicit TAccessor(const TSharedPtr<PCGExData::IBufferProxy>& InProxy)
+				: Proxy(InProxy)
+			{
+				if (!Proxy || Proxy->HasSubSelection() || Proxy->RealType != Proxy->WorkingType) { return; }
+
+				const TSharedPtr<PCGExData::IBuffer> RawBuffer = Proxy->GetBuffer();
+				if (RawBuffer && RawBuffer->GetTypeId() == PCGExTypes::TTraits<T>::Type)
+				{
+					Buffer = static_cast<PCGExData::TBuffer<T>*>(RawBuffer.Get());
+				}
+			}
+
+			FORCEINLINE bool IsValid() const { return Proxy.IsValid(); }
+
+			FORCEINLINE void Read(const int32 Index, T& OutValue) const
+			{
+				if (Buffer) { OutValue = Buffer->Read(Index); }
+				else { Proxy->GetVoid(Index, &OutValue); }
+			}
+
+			FORCEINLINE void Set(const int32 Index, const T& Value) const
+			{
+				if (Buffer) { Buffer->SetValue(Index, Value); }
+				else { Proxy->SetVoid(Index, &Value); }
+			}
+		};
+
+		template <typename T>
+		class TBlendKernel final : public IBlendKernel
+		{
+		public:
+			TSharedPtr<IBlendOperation> Operation;
+
+			TAccessor<T> A;
+			TAccessor<T> B;
+			TAccessor<T> Target;
+			TArray<TAccessor<T>> Sources;
+
+			// Mirrors FProxyDataBlender Begin/Multi/EndMultiBlend, with the accumulator kept local
+			virtual void MultiBlend(const int32 TargetIndex, TConstArrayView<PCGExData::FWeightedPoint> InSources) const override
+			{
+				PCGEx::FOpStats Tracker{};
+
+				T Current{};
+				Target.Read(TargetIndex, Current);
+				Operation->BeginMulti(&Current, nullptr, Tracker);
+
+				T Value{};
+				for (const PCGExData::FWeightedPoint& P : InSources)
+				{
+					const TAccessor<T>& Source = Sources[P.IO];
+					if (!Source.IsValid()) { continue; }
+
+					if (Tracker.Count < 0)
+					{
+						Tracker.Count = 0;
+						Source.Read(P.Index, Current);
+					}
+					else
+					{
+						Source.Read(P.Index, Value);
+						Operation->Accumulate(&Value, &Current, P.Weight);
+					}
+
+					Tracker.Count++;
+					Tracker.TotalWeight += P.Weight;
+				}
+
+				if (Tracker.Count) { Operation->EndMulti(&Current, Tracker.TotalWeight, Tracker.Count); }
+				Target.Set(TargetIndex, Current);
+			}
+
+			virtual void Blend(const int32 SourceIndexA, const int32 SourceIndexB, const PCGExMT::FScope& Scope, TConstArrayView<double> Weights) const override
+			{
+				// Operands are the same for the whole scope, only fetch them once
+				T ValA{};
+				T ValB{};
+				T Out{};
+
+				A.Read(SourceIndexA, ValA);
+				B.Read(SourceIndexB, ValB);
+
+				PCGEX_SCOPE_LOOP(Index)
+				{
+					Operation->Blend(&ValA, &ValB, Weights[Index - Scope.Start], &Out);
+					Target.Set(Index, Out);
+				}
+			}
+		};
+
+		static bool IsCompatible(const TSharedPtr<PCGExData::IBufferProxy>& InProxy, const EPCGMetadataTypes InType)
+		{
+			return InProxy && InProxy->WorkingType == InType;
+		}
+	}
+
+	void FBlendSources::Reset(const int32 InNumRows, const int32 InNumPoints)
+	{
+		Targets.Reset(InNumRows);
+		Offsets.Reset(InNumRows + 1);
+		Points.Reset(InNumPoints);
+
+		Offsets.Add(0);
+	}
+
+	void FBlendSources::AddRow(const int32 TargetIndex, TConstArrayView<PCGExData::FWeightedPoint> InWeightedPoints)
+	{
+		if (Offsets.IsEmpty()) { Offsets.Add(0); }
+
+		Targets.Add(TargetIndex);
+		Points.Append(InWeightedPoints.GetData(), InWeightedPoints.Num());
+		Offsets.Add(Points.Num());
+	}
+
+	bool FBlendPlan::Add(const TSharedPtr<FProxyDataBlender>& InTarget, const TArray<TSharedPtr<FProxyDataBlender>>& InSources)
+	{
+		if (!InTarget || !InTarget->Operation) { return false; }
+
+		const EPCGMetadataTypes WorkingType = InTarget->UnderlyingType;
+		if (InTarget->Operation->GetWorkingType() != WorkingType || !BlendPlan::IsCompatible(InTarget->C, WorkingType)) { return false; }
+
+		for (const TSharedPtr<FProxyDataBlender>& Source : InSources)
+		{
+			if (Source && !BlendPlan::IsCompatible(Source->A, WorkingType)) { return false; }
+		}
+
+		TUniquePtr<IBlendKernel> Kernel;
+
+		PCGExMetaHelpers::ExecuteWithRightType(
+			WorkingType, [&](auto DummyValue)
+			{
+				using T = decltype(DummyValue);
+
+				TUniquePtr<BlendPlan::TBlendKernel<T>> TypedKernel = MakeUnique<BlendPlan::TBlendKernel<T>>();
+				TypedKernel->Operation = InTarget->Operation;
+				TypedKernel->Target = BlendPlan::TAccessor<T>(InTarget->C);
+
+				TypedKernel->Sources.Reserve(InSources.Num());
+				for (const TSharedPtr<FProxyDataBlender>& Source : InSources)
+				{
+					if (Source) { TypedKernel->Sources.Emplace(Source->A); }
+					else { TypedKernel->Sources.Emplace(); }
+				}
+
+				Kernel = MoveTemp(TypedKernel);
+			});
+
+		if (!Kernel) { return false; }
+
+		Kernels.Add(MoveTemp(Kernel));
+		return true;
+	}
+
+	bool FBlendPlan::Add(const TSharedPtr<FProxyDataBlender>& InBlender)
+	{
+		if (!InBlender || !InBlender->Operation) { return false; }
+
+		const EPCGMetadataTypes WorkingType = InBlender->UnderlyingType;
+		if (InBlender->Operation->GetWorkingType() != WorkingType ||
+			!BlendPlan::IsCompatible(InBlender->A, WorkingType) ||
+			!BlendPlan::IsCompatible(InBlender->B, WorkingType) ||
+			!BlendPlan::IsCompatible(InBlender->C, WorkingType))
+		{
+			return false;
+		}
+
+		TUniquePtr<IBlendKernel> Kernel;
+
+		PCGExMetaHelpers::ExecuteWithRightType(
+			WorkingType, [&](auto DummyValue)
+			{
+				using T = decltype(DummyValue);
+
+				TUniquePtr<BlendPlan::TBlendKernel<T>> TypedKernel = MakeUnique<BlendPlan::TBlendKernel<T>>();
+				TypedKernel->Operation = InBlender->Operation;
+				TypedKernel->A = BlendPlan::TAccessor<T>(InBlender->A);
+				TypedKernel->B = BlendPlan::TAccessor<T>(InBlender->B);
+				TypedKernel->Target = BlendPlan::TAccessor<T>(InBlender->C);
+
+				Kernel = MoveTemp(TypedKernel);
+			});
+
+		if (!Kernel) { return false; }
+
+		Kernels.Add(MoveTemp(Kernel));
+		return true;
+	}
+
+	void FBlendPlan::MultiBlend(const int32 TargetIndex, TConstArrayView<PCGExData::FWeightedPoint> InSources) const
+	{
+		for (const TUniquePtr<IBlendKernel>& Kernel : Kernels) { Kernel->MultiBlend(TargetIndex, InSources); }
+	}
+
+	void FBlendPlan::MultiBlend(const FBlendSources& InSources) const
+	{
+		// Kernel-major so each attribute streams through the whole span at once
+		const int32 NumRows = InSources.Num();
+		for (const TUniquePtr<IBlendKernel>& Kernel : Kernels)
+		{
+			for (int32 Row = 0; Row < NumRows; Row++)
+			{
+				const TConstArrayView<PCGExData::FWeightedPoint> RowSources = InSources.GetRow(Row);
+				if (!RowSources.IsEmpty()) { Kernel->MultiBlend(InSources.Targets[Row], RowSources); }
+			}
+		}
+	}
+
+	void FBlendPlan::Blend(const int32 SourceIndexA, const int32 SourceIndexB, const PCGExMT::FScope& Scope, TConstArrayView<double> Weights) const
+	{
+		for (const TUniquePtr<IBlendKernel>& Kernel : Kernels) { Kernel->Blend(SourceIndexA, SourceIndexB, Scope, Weights); }
+	}
+}
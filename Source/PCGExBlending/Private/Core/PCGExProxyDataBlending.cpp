@@ -11,12 +11,38 @@
 #include "Data/PCGExProxyDataHelpers.h"
 #include "Core/PCGExUnionData.h"
 #include "Core/PCGExBlendOperations.h"
+#include "Core/PCGExBlendPlan.h"
+#include "Core/PCGExMTCommon.h"
 #include "Core/PCGExOpStats.h"
 #include "Data/PCGExData.h"
 #include "Math/PCGExMathDistances.h"
 
 namespace PCGExBlending
 {
+	// IUnionBlender implementation
+
+	void IUnionBlender::Blend(const FBlendSources& InSources, TArray<PCGEx::FOpStats>& Trackers) const
+	{
+		TArray<PCGExData::FWeightedPoint> WeightedPoints;
+		for (int32 Row = 0; Row < InSources.Num(); Row++)
+		{
+			WeightedPoints.Reset();
+			WeightedPoints.Append(InSources.GetRow(Row));
+			Blend(InSources.Targets[Row], WeightedPoints, Trackers);
+		}
+	}
+
+	void IUnionBlender::MergeScope(const PCGExMT::FScope& Scope, FBlendSources& OutSources, TArray<PCGExData::FWeightedPoint>& WeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const
+	{
+		OutSources.Reset(Scope.Count);
+		PCGEX_SCOPE_LOOP(Index)
+		{
+			WeightedPoints.Reset();
+			MergeSingle(Index, WeightedPoints, Trackers);
+			OutSources.AddRow(Index, WeightedPoints);
+		}
+	}
+
 	// FDummyUnionBlender implementation
 
 	void FDummyUnionBlender::Init(const TSharedPtr<PCGExData::FFacade>& TargetData, const TArray<TSharedRef<PCGExData::FFacade>>& InSources)
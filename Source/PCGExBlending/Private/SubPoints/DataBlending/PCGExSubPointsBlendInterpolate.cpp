@@ -16,41 +16,31 @@ void FPCGExSubPointsBlendInterpolate::BlendSubPoints(const PCGExData::FConstPoin
 	EPCGExBlendOver SafeBlendOver = TypedFactory->BlendOver;
 	if (TypedFactory->BlendOver == EPCGExBlendOver::Distance && !Metrics.IsValid()) { SafeBlendOver = EPCGExBlendOver::Index; }
 
+	TArray<double> Weights;
+	Weights.SetNumUninitialized(Scope.Count);
+
 	if (SafeBlendOver == EPCGExBlendOver::Distance)
 	{
 		PCGExPaths::FPathMetrics PathMetrics = PCGExPaths::FPathMetrics(From.GetLocation());
-		TPCGValueRange<FTransform> OutTransform = Scope.Data->GetTransformValueRange(false);
+		TConstPCGValueRange<FTransform> OutTransform = Scope.Data->GetConstTransformValueRange();
 
-		PCGEX_SCOPE_LOOP(Index)
-		{
-			FVector Location = OutTransform[Index].GetLocation();
-			MetadataBlender->Blend(From.Index, To.Index, Index, Metrics.GetTime(PathMetrics.Add(Location)));
-			//OutTransform[Index].SetLocation(Location);
-		}
+		PCGEX_SCOPE_LOOP(Index) { Weights[Index - Scope.Start] = Metrics.GetTime(PathMetrics.Add(OutTransform[Index].GetLocation())); }
 	}
 	else if (SafeBlendOver == EPCGExBlendOver::Index)
 	{
 		const double Divider = Scope.Count;
-		TPCGValueRange<FTransform> OutTransform = Scope.Data->GetTransformValueRange(false);
-
-		PCGEX_SCOPE_LOOP(Index)
-		{
-			//FVector Location = OutTransform[Index].GetLocation();
-			MetadataBlender->Blend(From.Index, To.Index, Index, Index / Divider);
-			//OutTransform[Index].SetLocation(Location);
-		}
+		PCGEX_SCOPE_LOOP(Index) { Weights[Index - Scope.Start] = Index / Divider; }
 	}
 	else if (SafeBlendOver == EPCGExBlendOver::Fixed)
 	{
-		TPCGValueRange<FTransform> OutTransform = Scope.Data->GetTransformValueRange(false);
-
-		PCGEX_SCOPE_LOOP(Index)
-		{
-			//FVector Location = OutTransform[Index].GetLocation();
-			MetadataBlender->Blend(From.Index, To.Index, Index, Lerp);
-			//OutTransform[Index].SetLocation(Location);
-		}
+		for (double& W : Weights) { W = Lerp; }
 	}
+	else
+	{
+		return;
+	}
+
+	MetadataBlender->Blend(From.Index, To.Index, Scope, Weights);
 }
 
 void UPCGExSubPointsBlendInterpolate::CopySettingsFrom(const UPCGExInstancedFactory* Other)
@@ -19,6 +19,8 @@ namespace PCGExMT
 
 namespace PCGExBlending
 {
+	class FBlendPlan;
+
 	class PCGEXBLENDING_API FMetadataBlender final : public IBlender
 	{
 	public:
@@ -40,6 +42,9 @@ namespace PCGExBlending
 		virtual void Blend(const int32 SourceIndex, const int32 TargetIndex, const double Weight) const override;
 		virtual void Blend(const int32 SourceAIndex, const int32 SourceBIndex, const int32 TargetIndex, const double Weight) const override;
 
+		// Target[i] = SourceA|SourceB for every target in scope, Weights are relative to Scope.Start
+		void Blend(const int32 SourceAIndex, const int32 SourceBIndex, const PCGExMT::FScope& Scope, TConstArrayView<double> Weights) const;
+
 		virtual void InitTrackers(TArray<PCGEx::FOpStats>& Trackers) const override;
 
 		virtual void BeginMultiBlend(const int32 TargetIndex, TArray<PCGEx::FOpStats>& Trackers) const override;
@@ -58,6 +63,7 @@ namespace PCGExBlending
 		TWeakPtr<PCGExData::FFacade> TargetFacadeHandle;
 
 		TArray<TSharedPtr<FProxyDataBlender>> Blenders;
+		TSharedPtr<FBlendPlan> Plan; // Compiled from Blenders, null if any of them could not be compiled
 		TSharedPtr<PCGExMT::TScopedArray<PCGEx::FOpStats>> ScopedTrackers;
 	};
 }
@@ -28,6 +28,7 @@ namespace PCGExMath
 namespace PCGExBlending
 {
 	struct FPropertiesBlender;
+	class FBlendPlan;
 }
 
 namespace PCGExBlending
@@ -81,8 +82,10 @@ namespace PCGExBlending
 		};
 		virtual int32 ComputeWeights(const int32 WriteIndex, const TSharedPtr<PCGExData::IUnionData>& InUnionData, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints) const override;
 		virtual void Blend(const int32 WriteIndex, const TArray<PCGExData::FWeightedPoint>& InWeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const override;
+		virtual void Blend(const FBlendSources& InSources, TArray<PCGEx::FOpStats>& Trackers) const override;
 		virtual void MergeSingle(const int32 WriteIndex, const TSharedPtr<PCGExData::IUnionData>& InUnionData, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const override;
 		virtual void MergeSingle(const int32 UnionIndex, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const override;
+		virtual void MergeScope(const PCGExMT::FScope& Scope, FBlendSources& OutSources, TArray<PCGExData::FWeightedPoint>& WeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const override;
 
 	protected:
 		TSet<FString> TypeMismatches;
@@ -94,6 +97,7 @@ namespace PCGExBlending
 
 		TArray<FBlendingParam> PropertyParams;
 		TArray<TSharedPtr<FMultiSourceBlender>> Blenders;
+		TSharedPtr<FBlendPlan> Plan; // Compiled from Blenders, null if any of them could not be compiled
 
 		TSet<FString> UniqueTags;
 		TArray<FString> UniqueTagsList;
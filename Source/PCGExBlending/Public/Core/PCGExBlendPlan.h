@@ -0,0 +1,86 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/PCGExPointElements.h"
+
+namespace PCGExMT
+{
+	struct FScope;
+}
+
+namespace PCGExBlending
+{
+	class FProxyDataBlender;
+
+	//
+	// FBlendSources - Weighted sources for a span of targets, stored as compressed rows
+	//
+	// Row i blends Points[Offsets[i]..Offsets[i+1]) into Targets[i].
+	//
+	struct PCGEXBLENDING_API FBlendSources
+	{
+		TArray<int32> Targets;
+		TArray<int32> Offsets;
+		TArray<PCGExData::FWeightedPoint> Points;
+
+		void Reset(const int32 InNumRows = 0, const int32 InNumPoints = 0);
+		void AddRow(const int32 TargetIndex, TConstArrayView<PCGExData::FWeightedPoint> InWeightedPoints);
+
+		FORCEINLINE int32 Num() const { return Targets.Num(); }
+
+		FORCEINLINE TConstArrayView<PCGExData::FWeightedPoint> GetRow(const int32 Row) const
+		{
+			return MakeArrayView(Points.GetData() + Offsets[Row], Offsets[Row + 1] - Offsets[Row]);
+		}
+	};
+
+	//
+	// IBlendKernel - A single attribute/property blend, resolved to its working type once
+	//
+	class PCGEXBLENDING_API IBlendKernel
+	{
+	public:
+		virtual ~IBlendKernel() = default;
+
+		// Target = Begin, Accumulate(Sources...), End -- sources are resolved through FWeightedPoint::IO
+		virtual void MultiBlend(const int32 TargetIndex, TConstArrayView<PCGExData::FWeightedPoint> InSources) const = 0;
+
+		// Target = A|B, for each target in scope with its own weight
+		virtual void Blend(const int32 SourceIndexA, const int32 SourceIndexB, const PCGExMT::FScope& Scope, TConstArrayView<double> Weights) const = 0;
+	};
+
+	//
+	// FBlendPlan - Compiled list of typed kernels for a facade pair
+	//
+	// Built once from the proxy blenders an IBlender/IUnionBlender already owns.
+	// Kernels read/write typed values directly (bypassing the type-erased proxy path
+	// whenever the proxy maps 1:1 onto a buffer), keep the accumulator local to the target
+	// and run the whole source list in a single call instead of once per source per attribute.
+	//
+	class PCGEXBLENDING_API FBlendPlan : public TSharedFromThis<FBlendPlan>
+	{
+	public:
+		FBlendPlan() = default;
+		~FBlendPlan() = default;
+
+		// Multi-source kernel. InTarget provides the operation & output, InSources is indexed by FWeightedPoint::IO (null entries are skipped)
+		bool Add(const TSharedPtr<FProxyDataBlender>& InTarget, const TArray<TSharedPtr<FProxyDataBlender>>& InSources);
+
+		// A|B->C kernel from a single blender
+		bool Add(const TSharedPtr<FProxyDataBlender>& InBlender);
+
+		FORCEINLINE int32 Num() const { return Kernels.Num(); }
+		FORCEINLINE bool IsEmpty() const { return Kernels.IsEmpty(); }
+
+		void MultiBlend(const int32 TargetIndex, TConstArrayView<PCGExData::FWeightedPoint> InSources) const;
+		void MultiBlend(const FBlendSources& InSources) const;
+
+		void Blend(const int32 SourceIndexA, const int32 SourceIndexB, const PCGExMT::FScope& Scope, TConstArrayView<double> Weights) const;
+
+	protected:
+		TArray<TUniquePtr<IBlendKernel>> Kernels;
+	};
+}
@@ -57,6 +57,7 @@ namespace PCGExMT
 namespace PCGExBlending
 {
 	struct FBlendingParam;
+	struct FBlendSources;
 	class IBlendOperation;
 	//
 	// IBlender - Base interface for multi-attribute blending
@@ -136,9 +137,13 @@ namespace PCGExBlending
 		virtual void InitTrackers(TArray<PCGEx::FOpStats>& Trackers) const = 0;
 		virtual int32 ComputeWeights(const int32 WriteIndex, const TSharedPtr<PCGExData::IUnionData>& InUnionData, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints) const = 0;
 		virtual void Blend(const int32 WriteIndex, const TArray<PCGExData::FWeightedPoint>& InWeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const = 0;
+		virtual void Blend(const FBlendSources& InSources, TArray<PCGEx::FOpStats>& Trackers) const; // Span of targets, defaults to one Blend per row
 		virtual void MergeSingle(const int32 WriteIndex, const TSharedPtr<PCGExData::IUnionData>& InUnionData, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const = 0;
 		virtual void MergeSingle(const int32 UnionIndex, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const = 0;
 
+		// MergeSingle for every union in scope. OutSources gets one row per index in scope, in order, even if empty.
+		virtual void MergeScope(const PCGExMT::FScope& Scope, FBlendSources& OutSources, TArray<PCGExData::FWeightedPoint>& WeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const;
+
 		FORCEINLINE EPCGPointNativeProperties GetAllocatedProperties() const { return AllocatedProperties; }
 
 	protected:
@@ -153,6 +158,8 @@ namespace PCGExBlending
 	public:
 		virtual ~FDummyUnionBlender() override = default;
 
+		using IUnionBlender::Blend;
+
 		void Init(const TSharedPtr<PCGExData::FFacade>& TargetData, const TArray<TSharedRef<PCGExData::FFacade>>& InSources);
 
 		virtual void InitTrackers(TArray<PCGEx::FOpStats>& Trackers) const override
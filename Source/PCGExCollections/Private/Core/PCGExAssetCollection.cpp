@@ -1,4 +1,4 @@
-// Copyright 2026 Timothé Lapetite and contributors
+﻿// Copyright 2026 Timothé Lapetite and contributors
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #include "Core/PCGExAssetCollection.h"
@@ -56,6 +56,28 @@ bool FPCGExAssetStagingData::FindSocket(FName InName, const FString& Tag, const
 
 namespace PCGExAssetCollection
 {
+#pragma region FWeightedPickGuide
+
+	// One bucket per entry. Bucket b covers thresholds in [ceil(b * Sum / N), ceil((b + 1) * Sum / N))
+	// and starts at the first cumulative weight greater than the smallest of them.
+	void FWeightedPickGuide::Build(TConstArrayView<int32> InCumulativeWeights)
+	{
+		const int32 NumEntries = InCumulativeWeights.Num();
+
+		Buckets.SetNumUninitialized(NumEntries);
+		WeightSum = NumEntries ? FMath::Max<int64>(1, InCumulativeWeights.Last()) : 1;
+
+		int32 Pick = 0;
+		for (int32 b = 0; b < NumEntries; b++)
+		{
+			const int64 MinThreshold = (b * WeightSum + NumEntries - 1) / NumEntries;
+			while (Pick < NumEntries && InCumulativeWeights[Pick] <= MinThreshold) { Pick++; }
+			Buckets[b] = Pick;
+		}
+	}
+
+#pragma endregion
+
 #pragma region FMicroCache
 
 	int32 FMicroCache::GetPick(int32 Index, EPCGExIndexPickMode PickMode) const
@@ -107,14 +129,32 @@ namespace PCGExAssetCollection
 		}
 
 		const int32 Threshold = FRandomStream(Seed).RandRange(0, static_cast<int32>(WeightSum) - 1);
-		int32 Pick = 0;
-		while (Pick < Weights.Num() && Weights[Pick] <= Threshold) { Pick++; }
-		return Order[FMath::Min(Pick, Order.Num() - 1)];
+		return Order[FMath::Min(PickGuide.Find(Weights, Threshold), Order.Num() - 1)];
+	}
+
+	void FMicroCache::GetPicksRandomWeighted(TConstArrayView<int32> Seeds, TArrayView<int32> OutPicks) const
+	{
+		check(Seeds.Num() == OutPicks.Num());
+
+		if (Order.IsEmpty())
+		{
+			for (int32& Pick : OutPicks) { Pick = -1; }
+			return;
+		}
+
+		const int32 MaxThreshold = static_cast<int32>(WeightSum) - 1;
+		const int32 MaxPick = Order.Num() - 1;
+
+		for (int32 i = 0; i < Seeds.Num(); i++)
+		{
+			const int32 Threshold = FRandomStream(Seeds[i]).RandRange(0, MaxThreshold);
+			OutPicks[i] = Order[FMath::Min(PickGuide.Find(Weights, Threshold), MaxPick)];
+		}
 	}
 
 	// Builds cumulative weight array for weighted random picking.
 	// Weights are sorted ascending, then converted to cumulative sums.
-	// GetPickRandomWeighted scans for the first cumulative weight > threshold.
+	// GetPickRandomWeighted looks for the first cumulative weight > threshold, starting from the pick guide.
 	void FMicroCache::BuildFromWeights(TConstArrayView<int32> InWeights)
 	{
 		const int32 NumEntries = InWeights.Num();
@@ -136,6 +176,8 @@ namespace PCGExAssetCollection
 			WeightSum += Weights[i];
 			Weights[i] = static_cast<int32>(WeightSum);
 		}
+
+		PickGuide.Build(Weights);
 	}
 
 #pragma endregion
@@ -184,9 +226,27 @@ namespace PCGExAssetCollection
 	{
 		if (Order.IsEmpty()) { return -1; }
 		const int32 Threshold = FRandomStream(Seed).RandRange(0, static_cast<int32>(WeightSum) - 1);
-		int32 Pick = 0;
-		while (Pick < Weights.Num() && Weights[Pick] <= Threshold) { Pick++; }
-		return Indices[Order[FMath::Min(Pick, Order.Num() - 1)]];
+		return Indices[Order[FMath::Min(PickGuide.Find(Weights, Threshold), Order.Num() - 1)]];
+	}
+
+	void FCategory::GetPicksRandomWeighted(TConstArrayView<int32> Seeds, TArrayView<int32> OutPicks) const
+	{
+		check(Seeds.Num() == OutPicks.Num());
+
+		if (Order.IsEmpty())
+		{
+			for (int32& Pick : OutPicks) { Pick = -1; }
+			return;
+		}
+
+		const int32 MaxThreshold = static_cast<int32>(WeightSum) - 1;
+		const int32 MaxPick = Order.Num() - 1;
+
+		for (int32 i = 0; i < Seeds.Num(); i++)
+		{
+			const int32 Threshold = FRandomStream(Seeds[i]).RandRange(0, MaxThreshold);
+			OutPicks[i] = Indices[Order[FMath::Min(PickGuide.Find(Weights, Threshold), MaxPick)]];
+		}
 	}
 
 	void FCategory::Reserve(int32 InNum)
@@ -227,6 +287,8 @@ namespace PCGExAssetCollection
 			WeightSum += Weights[i];
 			Weights[i] = static_cast<int32>(WeightSum);
 		}
+
+		PickGuide.Build(Weights);
 	}
 
 #pragma endregion
@@ -602,6 +664,33 @@ FPCGExEntryAccessResult UPCGExAssetCollection::GetEntryRandom(int32 Seed, uint8
 	return Result;
 }
 
+void UPCGExAssetCollection::GetEntriesWeightedRandom(TConstArrayView<int32> Seeds, TArrayView<FPCGExEntryAccessResult> OutResults) const
+{
+	check(Seeds.Num() == OutResults.Num());
+
+	TArray<int32, TInlineAllocator<256>> PickedIndices;
+	PickedIndices.SetNumUninitialized(Seeds.Num());
+	const_cast<UPCGExAssetCollection*>(this)->LoadCache()->Main->GetPicksRandomWeighted(Seeds, PickedIndices);
+
+	for (int32 i = 0; i < Seeds.Num(); i++)
+	{
+		FPCGExEntryAccessResult& Result = OutResults[i];
+		Result = FPCGExEntryAccessResult{};
+
+		const FPCGExAssetCollectionEntry* Entry = GetEntryAtRawIndex(PickedIndices[i]);
+		if (!Entry) { continue; }
+
+		if (Entry->HasValidSubCollection())
+		{
+			Result = Entry->GetSubCollectionPtr()->GetEntryWeightedRandom(Seeds[i] * 2);
+			continue;
+		}
+
+		Result.Entry = Entry;
+		Result.Host = this;
+	}
+}
+
 FPCGExEntryAccessResult UPCGExAssetCollection::GetEntryWeightedRandom(int32 Seed, uint8 TagInheritance, TSet<FName>& OutTags) const
 {
 	FPCGExEntryAccessResult Result;
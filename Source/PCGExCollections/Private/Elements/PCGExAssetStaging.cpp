@@ -472,6 +472,21 @@ namespace PCGExAssetStaging
 		const bool bFilterEntryType = Settings->bDoFilterEntryType;
 		const FPCGExStagedTypeFilterDetails& EntryTypeFilter = Settings->EntryTypeFilter;
 
+		// With a single collection, every pick of the scope can be resolved up-front in one batch
+		PCGExCollections::FDistributionHelper* ScopeHelper = nullptr;
+		PCGExCollections::FMicroDistributionHelper* ScopeMicroHelper = nullptr;
+		TArray<int32> ScopeSeeds;
+		TArray<FPCGExEntryAccessResult> ScopeResults;
+
+		if (Source->IsSingleSource() && Source->TryGetHelpers(Scope.Start, ScopeHelper, ScopeMicroHelper))
+		{
+			ScopeSeeds.SetNumUninitialized(Scope.Count);
+			ScopeResults.SetNum(Scope.Count);
+
+			PCGEX_SCOPE_LOOP(Index) { ScopeSeeds[Index - Scope.Start] = PCGExRandomHelpers::GetSeed(Seeds[Index], ScopeHelper->Details.SeedComponents, ScopeHelper->Details.LocalSeed, Settings, Component); }
+			ScopeHelper->GetEntries(Scope.Start, ScopeSeeds, ScopeResults);
+		}
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			PCGExCollections::FDistributionHelper* Helper = nullptr;
@@ -483,9 +498,9 @@ namespace PCGExAssetStaging
 				continue;
 			}
 
-			const int32 Seed = PCGExRandomHelpers::GetSeed(Seeds[Index], Helper->Details.SeedComponents, Helper->Details.LocalSeed, Settings, Component);
+			const int32 Seed = ScopeHelper ? ScopeSeeds[Index - Scope.Start] : PCGExRandomHelpers::GetSeed(Seeds[Index], Helper->Details.SeedComponents, Helper->Details.LocalSeed, Settings, Component);
 
-			FPCGExEntryAccessResult Result = Helper->GetEntry(Index, Seed);
+			FPCGExEntryAccessResult Result = ScopeHelper ? ScopeResults[Index - Scope.Start] : Helper->GetEntry(Index, Seed);
 
 			if (!Result.IsValid()
 				|| !Result.Entry->Staging.Bounds.IsValid
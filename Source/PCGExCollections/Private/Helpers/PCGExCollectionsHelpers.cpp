@@ -1,4 +1,4 @@
-// Copyright 2026 Timothé Lapetite and contributors
+﻿// Copyright 2026 Timothé Lapetite and contributors
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #include "Helpers/PCGExCollectionsHelpers.h"
@@ -180,6 +180,20 @@ namespace PCGExCollections
 		return FPCGExEntryAccessResult{};
 	}
 
+	// Only uncategorized weighted picks have a batched path; everything else resolves point by point.
+	void FDistributionHelper::GetEntries(int32 StartIndex, TConstArrayView<int32> Seeds, TArrayView<FPCGExEntryAccessResult> OutResults) const
+	{
+		check(Seeds.Num() == OutResults.Num());
+
+		if (!CategoryGetter && Details.Distribution == EPCGExDistribution::WeightedRandom)
+		{
+			Collection->GetEntriesWeightedRandom(Seeds, OutResults);
+			return;
+		}
+
+		for (int32 i = 0; i < Seeds.Num(); i++) { OutResults[i] = GetEntry(StartIndex + i, Seeds[i]); }
+	}
+
 	// MicroDistribution Helper Implementation
 
 	FMicroDistributionHelper::FMicroDistributionHelper(const FPCGExMicroCacheDistributionDetails& InDetails)
@@ -1,4 +1,4 @@
-// Copyright 2026 Timothé Lapetite and contributors
+﻿// Copyright 2026 Timothé Lapetite and contributors
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #pragma once
@@ -261,6 +261,27 @@ protected:
 
 namespace PCGExAssetCollection
 {
+	/**
+	 * Lookup table over cumulative weights, so weighted picks don't scan from the first entry.
+	 * Bucket b holds the first cumulative weight index that can match a threshold falling in that bucket,
+	 * which keeps results identical to a linear scan while taking ~O(1) steps on average.
+	 */
+	struct PCGEXCOLLECTIONS_API FWeightedPickGuide
+	{
+		TArray<int32> Buckets;
+		int64 WeightSum = 0;
+
+		void Build(TConstArrayView<int32> InCumulativeWeights);
+
+		/** Index of the first cumulative weight strictly greater than Threshold */
+		FORCEINLINE int32 Find(TConstArrayView<int32> InCumulativeWeights, const int32 Threshold) const
+		{
+			int32 Pick = Buckets[static_cast<int64>(Threshold) * Buckets.Num() / WeightSum];
+			while (Pick < InCumulativeWeights.Num() && InCumulativeWeights[Pick] <= Threshold) { Pick++; }
+			return Pick;
+		}
+	};
+
 	/**
 	 * Per-entry cache for weighted sub-selections within a single entry.
 	 * Used when an entry has multiple variants (e.g. material overrides on a mesh,
@@ -279,6 +300,7 @@ namespace PCGExAssetCollection
 		double WeightSum = 0;
 		TArray<int32> Weights;
 		TArray<int32> Order;
+		FWeightedPickGuide PickGuide;
 
 	public:
 		FMicroCache() = default;
@@ -297,6 +319,9 @@ namespace PCGExAssetCollection
 		int32 GetPickRandom(int32 Seed) const;
 		int32 GetPickRandomWeighted(int32 Seed) const;
 
+		/** Batched GetPickRandomWeighted, OutPicks must be the same size as Seeds */
+		void GetPicksRandomWeighted(TConstArrayView<int32> Seeds, TArrayView<int32> OutPicks) const;
+
 	protected:
 		/** Initialize from weight array. Call from derived class. */
 		void BuildFromWeights(TConstArrayView<int32> InWeights);
@@ -317,6 +342,7 @@ namespace PCGExAssetCollection
 		TArray<int32> Weights;
 		TArray<int32> Order;
 		TArray<const FPCGExAssetCollectionEntry*> Entries;
+		FWeightedPickGuide PickGuide;
 
 		FCategory() = default;
 
@@ -338,6 +364,9 @@ namespace PCGExAssetCollection
 		int32 GetPickRandom(int32 Seed) const;
 		int32 GetPickRandomWeighted(int32 Seed) const;
 
+		/** Batched GetPickRandomWeighted, OutPicks must be the same size as Seeds. Picks are raw entry indices. */
+		void GetPicksRandomWeighted(TConstArrayView<int32> Seeds, TArrayView<int32> OutPicks) const;
+
 		void Reserve(int32 InNum);
 		void Shrink();
 		void RegisterEntry(int32 Index, const FPCGExAssetCollectionEntry* InEntry);
@@ -394,6 +423,7 @@ namespace PCGExAssetCollection
  * - GetEntry(Index, Seed, Mode) — pick by mode (ascending/descending/weight-sorted)
  * - GetEntryRandom(Seed)        — uniform random
  * - GetEntryWeightedRandom(Seed)— weighted random
+ * - GetEntriesWeightedRandom()  — weighted random, batched over many seeds
  * All return FPCGExEntryAccessResult with entry + host collection.
  */
 UCLASS(Abstract, BlueprintType, DisplayName="[PCGEx] Asset Collection")
@@ -444,6 +474,9 @@ public:
 	/** Get random entry (weighted by entry Weight property) */
 	FPCGExEntryAccessResult GetEntryWeightedRandom(int32 Seed) const;
 
+	/** Batched GetEntryWeightedRandom. Top-level picks are resolved in one pass, subcollections recurse per seed. */
+	void GetEntriesWeightedRandom(TConstArrayView<int32> Seeds, TArrayView<FPCGExEntryAccessResult> OutResults) const;
+
 	// With tag inheritance
 	FPCGExEntryAccessResult GetEntryAt(int32 Index, uint8 TagInheritance, TSet<FName>& OutTags) const;
 	FPCGExEntryAccessResult GetEntryRaw(int32 RawIndex, uint8 TagInheritance, TSet<FName>& OutTags) const;
@@ -107,6 +107,14 @@ namespace PCGExCollections
 		 */
 		FPCGExEntryAccessResult GetEntry(int32 PointIndex, int32 Seed, uint8 TagInheritance, TSet<FName>& OutTags) const;
 
+		/**
+		 * Batched GetEntry over a contiguous range of points
+		 * @param StartIndex Index of the first point
+		 * @param Seeds Random seed for each point of the range
+		 * @param OutResults Access results, same size as Seeds
+		 */
+		void GetEntries(int32 StartIndex, TConstArrayView<int32> Seeds, TArrayView<FPCGExEntryAccessResult> OutResults) const;
+
 		/** Get the underlying collection */
 		UPCGExAssetCollection* GetCollection() const { return Collection; }
 
@@ -126,6 +126,7 @@ namespace PCGExClusters
 
 	void FCluster::WillModifyVtxPositions(const bool bClearOwned)
 	{
+		bVtxPositionsModified = true;
 		NodeOctree.Reset();
 		EdgeOctree.Reset();
 		BoundedEdges.Reset();
@@ -262,11 +263,144 @@ namespace PCGExClusters
 		EdgesDataPtr = Edges->GetData();
 	}
 
+	void FCluster::DetachStructure()
+	{
+		// Mirrors share their structure with the original cluster until they need to modify it
+		if (!OriginalCluster) { return; }
+
+		if (Nodes == OriginalCluster->Nodes)
+		{
+			Nodes = MakeShared<TArray<FNode>>(*OriginalCluster->Nodes);
+			NodesDataPtr = Nodes->GetData();
+		}
+
+		if (Edges == OriginalCluster->Edges)
+		{
+			Edges = MakeShared<TArray<FEdge>>(*OriginalCluster->Edges);
+			EdgesDataPtr = Edges->GetData();
+		}
+
+		if (BoundedEdges && BoundedEdges == OriginalCluster->BoundedEdges) { BoundedEdges = MakeShared<TArray<FBoundedEdge>>(*OriginalCluster->BoundedEdges); }
+		if (EdgeLengths && EdgeLengths == OriginalCluster->EdgeLengths) { EdgeLengths = MakeShared<TArray<double>>(*OriginalCluster->EdgeLengths); }
+	}
+
+	void FCluster::CompactEdges(TArray<int32>& OutKeptEdges)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExCluster::CompactEdges);
+
+		DetachStructure();
+
+		TArray<FEdge>& EdgesRef = *Edges;
+		const int32 NumOldEdges = EdgesRef.Num();
+
+		// Old edge index -> new edge index, -1 if removed
+		TArray<int32> Remap;
+		Remap.Init(-1, NumOldEdges);
+
+		OutKeptEdges.Reset(NumOldEdges);
+
+		int32 WriteIndex = 0;
+		for (int i = 0; i < NumOldEdges; i++)
+		{
+			const FEdge& Edge = EdgesRef[i];
+			if (!IsEdgeFullyValid(Edge)) { continue; }
+
+			OutKeptEdges.Add(Edge.PointIndex);
+			Remap[i] = WriteIndex;
+
+			FEdge& KeptEdge = (EdgesRef[WriteIndex] = Edge);
+			KeptEdge.Index = WriteIndex;
+			KeptEdge.PointIndex = WriteIndex;
+			WriteIndex++;
+		}
+
+		EdgesRef.SetNum(WriteIndex);
+
+		for (FNode& Node : *Nodes)
+		{
+			int32 WriteLink = 0;
+			for (const FLink Lk : Node.Links)
+			{
+				if (const int32 NewEdge = Remap[Lk.Edge]; NewEdge != -1) { Node.Links[WriteLink++] = FLink(Lk.Node, NewEdge); }
+			}
+			Node.Links.SetNum(WriteLink);
+		}
+
+		NumRawEdges = WriteIndex;
+		EdgesDataPtr = Edges->GetData();
+
+		// Node positions didn't change, only edge-indexed data needs to go
+		EdgeOctree.Reset();
+		BoundedEdges.Reset();
+		EdgeLengths.Reset();
+		bEdgeLengthsDirty = true;
+		ClearCachedData();
+
+		bIsMirror = false;
+		OriginalCluster.Reset();
+	}
+
+	void FCluster::BindTo(const TSharedPtr<PCGExData::FPointIO>& InVtxIO, const TSharedPtr<PCGExData::FPointIO>& InEdgesIO)
+	{
+		VtxIO = InVtxIO;
+		EdgesIO = InEdgesIO;
+
+		VtxPoints = InVtxIO->GetOutIn();
+		VtxTransforms = VtxPoints->GetConstTransformValueRange();
+
+		NumRawVtx = InVtxIO->GetNum(PCGExData::EIOSide::Out);
+		NumRawEdges = InEdgesIO->GetNum(PCGExData::EIOSide::Out);
+
+		// Same as clusters built from subgraphs
+		for (FEdge& Edge : *Edges) { Edge.IOIndex = -1; }
+	}
+
+	bool FCluster::HasSameStructure(const FCluster& Other) const
+	{
+		if (Nodes == Other.Nodes && Edges == Other.Edges) { return true; }
+		if (!Nodes || !Edges || !Other.Nodes || !Other.Edges) { return false; }
+		if (Nodes->Num() != Other.Nodes->Num() || Edges->Num() != Other.Edges->Num()) { return false; }
+
+		for (int i = 0; i < Nodes->Num(); i++)
+		{
+			const FNode& A = *(NodesDataPtr + i);
+			const FNode& B = *(Other.NodesDataPtr + i);
+			if (A.bValid != B.bValid || A.PointIndex != B.PointIndex || A.Links != B.Links) { return false; }
+		}
+
+		for (int i = 0; i < Edges->Num(); i++)
+		{
+			const FEdge& A = *(EdgesDataPtr + i);
+			const FEdge& B = *(Other.EdgesDataPtr + i);
+			if (A.bValid != B.bValid || A.Start != B.Start || A.End != B.End) { return false; }
+		}
+
+		return true;
+	}
+
 	bool FCluster::IsValidWith(const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO) const
 	{
 		return NumRawVtx == InVtxIO->GetNum() && NumRawEdges == InEdgesIO->GetNum();
 	}
 
+	SIZE_T FCluster::GetAllocatedSize() const
+	{
+		SIZE_T Size = sizeof(FCluster);
+
+		if (Nodes)
+		{
+			Size += Nodes->GetAllocatedSize();
+			for (const FNode& Node : *Nodes) { Size += Node.Links.GetAllocatedSize(); }
+		}
+
+		if (Edges) { Size += Edges->GetAllocatedSize(); }
+		if (BoundedEdges) { Size += BoundedEdges->GetAllocatedSize(); }
+		if (EdgeLengths) { Size += EdgeLengths->GetAllocatedSize(); }
+		if (NodeIndexLookup) { Size += static_cast<SIZE_T>(NumRawVtx) * sizeof(int32); }
+
+		return Size;
+	}
+
 	bool FCluster::HasTag(const FString& InTag)
 	{
 		if (const TSharedPtr<PCGExData::FPointIO>& PinnedVtxIO = VtxIO.Pin()) { if (PinnedVtxIO->Tags->IsTagged(InTag)) { return true; } }
@@ -944,4 +1078,33 @@ namespace PCGExClusters
 		FWriteScopeLock WriteLock(ClusterLock);
 		CachedData.Reset();
 	}
+
+	void FCluster::GetAllCachedData(TMap<FName, TSharedPtr<ICachedClusterData>>& OutCachedData) const
+	{
+		FReadScopeLock ReadLock(ClusterLock);
+		OutCachedData = CachedData;
+	}
+
+	bool FCluster::InheritCachedData(const FCluster& Other)
+	{
+		if (&Other == this || Other.bVtxPositionsModified) { return false; }
+
+		TMap<FName, TSharedPtr<ICachedClusterData>> OtherData;
+		{
+			FReadScopeLock ReadLock(Other.ClusterLock);
+			OtherData = Other.CachedData;
+		}
+
+		bool bAdopted = false;
+
+		FWriteScopeLock WriteLock(ClusterLock);
+		for (const TPair<FName, TSharedPtr<ICachedClusterData>>& Pair : OtherData)
+		{
+			if (!Pair.Value || !Pair.Value->IsPortable() || CachedData.Contains(Pair.Key)) { continue; }
+			CachedData.Add(Pair.Key, Pair.Value);
+			bAdopted = true;
+		}
+
+		return bAdopted;
+	}
 }
@@ -0,0 +1,432 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Clusters/PCGExClusterSnapshot.h"
+
+#include <atomic>
+#include <type_traits>
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/Paths.h"
+#include "Tasks/Task.h"
+#include "PCGExSettingsCacheBody.h"
+#include "PCGExCoreSettingsCache.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Clusters/PCGExCluster.h"
+#include "Clusters/PCGExClusterCache.h"
+#include "Data/PCGExPointIO.h"
+
+namespace PCGExClusters::Snapshot
+{
+	namespace Flags
+	{
+		constexpr uint32 NodeOctree = 1 << 0;
+		constexpr uint32 EdgeOctree = 1 << 1;
+	}
+
+	template <typename T>
+	static void SerializeSection(FArchive& Ar, TArray<T>& Section, const int32 Num)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "Snapshot sections must be flat");
+		if (Ar.IsLoading()) { Section.SetNumUninitialized(Num); }
+		Ar.Serialize(Section.GetData(), static_cast<int64>(Num) * sizeof(T));
+	}
+
+	bool Write(const FCluster& InCluster, const FClusterContentKey& InContentKey, FArchive& Ar)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusters::Snapshot::Write);
+
+		if (!InCluster.Nodes || !InCluster.Edges) { return false; }
+
+		const TArray<FNode>& Nodes = *InCluster.Nodes;
+		const TArray<FEdge>& Edges = *InCluster.Edges;
+
+		int32 NumNodes = Nodes.Num();
+		int32 NumEdges = Edges.Num();
+
+		TArray<int32> NodePoints;
+		TArray<int32> Offsets;
+		TArray<FLink> Links;
+		TArray<int8> NodeValid;
+
+		NodePoints.SetNumUninitialized(NumNodes);
+		Offsets.SetNumUninitialized(NumNodes + 1);
+		NodeValid.SetNumUninitialized(NumNodes);
+
+		Offsets[0] = 0;
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			const FNode& Node = Nodes[i];
+			if (Node.Index != i) { return false; } // Only compact node arrays can be snapshot
+
+			NodePoints[i] = Node.PointIndex;
+			NodeValid[i] = Node.bValid;
+			Offsets[i + 1] = Offsets[i] + Node.Links.Num();
+		}
+
+		Links.Reserve(Offsets[NumNodes]);
+		for (const FNode& Node : Nodes) { Links.Append(Node.Links); }
+
+		TArray<FUint32Point> Endpoints;
+		TArray<int32> EdgePoints;
+		TArray<int8> EdgeValid;
+
+		Endpoints.SetNumUninitialized(NumEdges);
+		EdgePoints.SetNumUninitialized(NumEdges);
+		EdgeValid.SetNumUninitialized(NumEdges);
+
+		for (int32 i = 0; i < NumEdges; i++)
+		{
+			const FEdge& Edge = Edges[i];
+			if (Edge.Index != i) { return false; }
+
+			Endpoints[i] = FUint32Point(Edge.Start, Edge.End);
+			EdgePoints[i] = Edge.PointIndex;
+			EdgeValid[i] = Edge.bValid;
+		}
+
+		// Header
+
+		uint32 HeaderMagic = Magic;
+		uint32 HeaderVersion = Version;
+		FClusterContentKey ContentKey = InContentKey;
+		int32 NumRawVtx = InCluster.NumRawVtx;
+		int32 NumRawEdges = InCluster.NumRawEdges;
+		int32 NumLinks = Links.Num();
+		uint32 HeaderFlags = (InCluster.NodeOctree ? Flags::NodeOctree : 0) | (InCluster.EdgeOctree ? Flags::EdgeOctree : 0);
+		FBox Bounds = InCluster.Bounds;
+
+		Ar << HeaderMagic << HeaderVersion << ContentKey;
+		Ar << NumRawVtx << NumRawEdges << NumNodes << NumEdges << NumLinks;
+		Ar << HeaderFlags << Bounds;
+
+		// Sections
+
+		SerializeSection(Ar, NodePoints, NumNodes);
+		SerializeSection(Ar, Offsets, NumNodes + 1);
+		SerializeSection(Ar, Links, NumLinks);
+		SerializeSection(Ar, NodeValid, NumNodes);
+		SerializeSection(Ar, Endpoints, NumEdges);
+		SerializeSection(Ar, EdgePoints, NumEdges);
+		SerializeSection(Ar, EdgeValid, NumEdges);
+
+		// Cached data blobs, length-prefixed so readers can skip unknown keys
+
+		TMap<FName, TSharedPtr<ICachedClusterData>> CachedData;
+		InCluster.GetAllCachedData(CachedData);
+
+		TArray<TPair<FString, TArray<uint8>>> Blobs;
+		TArray<uint32> BlobHashes;
+
+		for (const TPair<FName, TSharedPtr<ICachedClusterData>>& Pair : CachedData)
+		{
+			if (!Pair.Value) { continue; }
+
+			TArray<uint8> Bytes;
+			FMemoryWriter Writer(Bytes);
+			if (!Pair.Value->SaveSnapshot(Writer) || Writer.IsError()) { continue; }
+
+			Blobs.Emplace(Pair.Key.ToString(), MoveTemp(Bytes));
+			BlobHashes.Add(Pair.Value->ContextHash);
+		}
+
+		int32 NumBlobs = Blobs.Num();
+		Ar << NumBlobs;
+
+		for (int32 i = 0; i < NumBlobs; i++) { Ar << Blobs[i].Key << BlobHashes[i] << Blobs[i].Value; }
+
+		return !Ar.IsError();
+	}
+
+	TSharedPtr<FCluster> Read(FArchive& Ar, const FClusterContentKey& InContentKey, const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusters::Snapshot::Read);
+
+		uint32 HeaderMagic = 0;
+		uint32 HeaderVersion = 0;
+		FClusterContentKey ContentKey;
+		int32 NumRawVtx = 0;
+		int32 NumRawEdges = 0;
+		int32 NumNodes = 0;
+		int32 NumEdges = 0;
+		int32 NumLinks = 0;
+		uint32 HeaderFlags = 0;
+		FBox Bounds(ForceInit);
+
+		Ar << HeaderMagic << HeaderVersion << ContentKey;
+		if (Ar.IsError() || HeaderMagic != Magic || HeaderVersion != Version || ContentKey != InContentKey) { return nullptr; }
+
+		Ar << NumRawVtx << NumRawEdges << NumNodes << NumEdges << NumLinks;
+		Ar << HeaderFlags << Bounds;
+
+		if (Ar.IsError() ||
+			NumRawVtx != InVtxIO->GetNum() || NumRawEdges != InEdgesIO->GetNum() ||
+			NumNodes < 0 || NumNodes > NumRawVtx || NumEdges < 0 || NumEdges > NumRawEdges || NumLinks != NumEdges * 2)
+		{
+			return nullptr;
+		}
+
+		TArray<int32> NodePoints;
+		TArray<int32> Offsets;
+		TArray<FLink> Links;
+		TArray<int8> NodeValid;
+		TArray<FUint32Point> Endpoints;
+		TArray<int32> EdgePoints;
+		TArray<int8> EdgeValid;
+
+		SerializeSection(Ar, NodePoints, NumNodes);
+		SerializeSection(Ar, Offsets, NumNodes + 1);
+		SerializeSection(Ar, Links, NumLinks);
+		SerializeSection(Ar, NodeValid, NumNodes);
+		SerializeSection(Ar, Endpoints, NumEdges);
+		SerializeSection(Ar, EdgePoints, NumEdges);
+		SerializeSection(Ar, EdgeValid, NumEdges);
+
+		if (Ar.IsError()) { return nullptr; }
+
+		// Don't trust the file blindly, a corrupted snapshot must not index out of bounds
+
+		if (Offsets[0] != 0 || Offsets[NumNodes] != NumLinks) { return nullptr; }
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			if (Offsets[i + 1] < Offsets[i] || !FMath::IsWithin(NodePoints[i], 0, NumRawVtx)) { return nullptr; }
+		}
+
+		for (const FLink& Lk : Links)
+		{
+			if (!FMath::IsWithin(Lk.Node, 0, NumNodes) || !FMath::IsWithin(Lk.Edge, 0, NumEdges)) { return nullptr; }
+		}
+
+		for (int32 i = 0; i < NumEdges; i++)
+		{
+			const FUint32Point& Endpoint = Endpoints[i];
+			if (Endpoint.X >= static_cast<uint32>(NumRawVtx) || Endpoint.Y >= static_cast<uint32>(NumRawVtx)) { return nullptr; }
+			if (!FMath::IsWithin(EdgePoints[i], 0, NumRawEdges)) { return nullptr; }
+		}
+
+		// Endpoints must resolve to distinct nodes, and every link must agree with the edge it points to
+
+		const TSharedPtr<PCGEx::FIndexLookup> NodeIndexLookup = MakeShared<PCGEx::FIndexLookup>(NumRawVtx);
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			if (NodeIndexLookup->Get(NodePoints[i]) != -1) { return nullptr; }
+			NodeIndexLookup->Set(NodePoints[i], i);
+		}
+
+		for (const FUint32Point& Endpoint : Endpoints)
+		{
+			const int32 StartNode = NodeIndexLookup->Get(Endpoint.X);
+			const int32 EndNode = NodeIndexLookup->Get(Endpoint.Y);
+			if (StartNode == -1 || EndNode == -1 || StartNode == EndNode) { return nullptr; }
+		}
+
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			const uint32 PointIndex = NodePoints[i];
+			for (int32 l = Offsets[i]; l < Offsets[i + 1]; l++)
+			{
+				const FUint32Point& Endpoint = Endpoints[Links[l].Edge];
+				const uint32 OtherPointIndex = NodePoints[Links[l].Node];
+				if (!(Endpoint.X == PointIndex && Endpoint.Y == OtherPointIndex) && !(Endpoint.Y == PointIndex && Endpoint.X == OtherPointIndex)) { return nullptr; }
+			}
+		}
+
+		// Rebuild
+
+		const TSharedPtr<FCluster> Cluster = MakeShared<FCluster>(InVtxIO, InEdgesIO, NodeIndexLookup);
+
+		Cluster->NumRawVtx = NumRawVtx;
+		Cluster->NumRawEdges = NumRawEdges;
+		Cluster->Bounds = Bounds;
+		Cluster->VtxTransforms = InVtxIO->GetIn()->GetConstTransformValueRange();
+
+		TArray<FNode>& Nodes = *Cluster->Nodes;
+		TArray<FEdge>& Edges = *Cluster->Edges;
+
+		Nodes.SetNum(NumNodes);
+		Edges.SetNum(NumEdges);
+
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			FNode& Node = Nodes[i];
+			Node.Index = i;
+			Node.PointIndex = NodePoints[i];
+			Node.bValid = NodeValid[i];
+			Node.Links.Append(Links.GetData() + Offsets[i], Offsets[i + 1] - Offsets[i]);
+		}
+
+		const int32 EdgeIOIndex = InEdgesIO->IOIndex;
+		for (int32 i = 0; i < NumEdges; i++)
+		{
+			FEdge& Edge = Edges[i];
+			Edge = FEdge(i, Endpoints[i].X, Endpoints[i].Y, EdgePoints[i], EdgeIOIndex);
+			Edge.bValid = EdgeValid[i];
+		}
+
+		Cluster->NodesDataPtr = Nodes.GetData();
+		Cluster->EdgesDataPtr = Edges.GetData();
+
+		if (HeaderFlags & Flags::NodeOctree) { Cluster->RebuildNodeOctree(); }
+		if (HeaderFlags & Flags::EdgeOctree) { Cluster->RebuildEdgeOctree(); }
+
+		// Cached data; blobs without a matching factory are skipped
+
+		int32 NumBlobs = 0;
+		Ar << NumBlobs;
+
+		const TSharedRef<FCluster> ClusterRef = Cluster.ToSharedRef();
+		for (int32 i = 0; i < NumBlobs && !Ar.IsError(); i++)
+		{
+			FString Key;
+			uint32 ContextHash = 0;
+			TArray<uint8> Bytes;
+			Ar << Key << ContextHash << Bytes;
+
+			const IClusterCacheFactory* Factory = FClusterCacheRegistry::Get().GetFactory(FName(Key));
+			if (!Factory) { continue; }
+
+			FMemoryReader Reader(Bytes);
+			if (const TSharedPtr<ICachedClusterData> Data = Factory->LoadSnapshot(ClusterRef, Reader); Data && !Reader.IsError())
+			{
+				Data->ContextHash = ContextHash;
+				Cluster->SetCachedData(FName(Key), Data);
+			}
+		}
+
+		return Ar.IsError() ? nullptr : Cluster;
+	}
+
+	static FString GetDirectory()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("PCGEx") / TEXT("ClusterSnapshots");
+	}
+
+	FString GetFilePath(const FClusterContentKey& InContentKey)
+	{
+		return GetDirectory() / (InContentKey.ToString() + TEXT(".pcgexcluster"));
+	}
+
+	bool SaveToDisk(const FCluster& InCluster, const FClusterContentKey& InContentKey, const bool bOverwrite)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusters::Snapshot::SaveToDisk);
+
+		const FString FilePath = GetFilePath(InContentKey);
+		if (!bOverwrite && IFileManager::Get().FileExists(*FilePath)) { return true; }
+
+		// Write next to the destination then move, so concurrent writers & readers never see a partial file
+		const FString TempPath = FString::Printf(TEXT("%s.%u.tmp"), *FilePath, FPlatformTLS::GetCurrentThreadId());
+
+		{
+			const TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*TempPath));
+			if (!Writer) { return false; }
+
+			if (!Write(InCluster, InContentKey, *Writer) || !Writer->Close())
+			{
+				IFileManager::Get().Delete(*TempPath, false, false, true);
+				return false;
+			}
+		}
+
+		if (!IFileManager::Get().Move(*FilePath, *TempPath, bOverwrite, false, false, true))
+		{
+			IFileManager::Get().Delete(*TempPath, false, false, true);
+			return IFileManager::Get().FileExists(*FilePath);
+		}
+
+		return true;
+	}
+
+	void SaveToDiskAsync(const TSharedPtr<FCluster>& InCluster, const FClusterContentKey& InContentKey, const bool bOverwrite)
+	{
+		if (!InCluster) { return; }
+
+		UE::Tasks::Launch(TEXT("PCGExClusterSnapshot"), [Cluster = InCluster, ContentKey = InContentKey, bOverwrite]()
+		{
+			if (SaveToDisk(*Cluster, ContentKey, bOverwrite)) { PruneAsync(); }
+		}, UE::Tasks::ETaskPriority::BackgroundNormal);
+	}
+
+	TSharedPtr<FCluster> LoadFromDisk(const FClusterContentKey& InContentKey, const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusters::Snapshot::LoadFromDisk);
+
+		const FString FilePath = GetFilePath(InContentKey);
+
+		TSharedPtr<FCluster> Cluster;
+		{
+			const TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath, FILEREAD_Silent));
+			if (!Reader) { return nullptr; }
+
+			Cluster = Read(*Reader, InContentKey, InVtxIO, InEdgesIO);
+		}
+
+		// Modification time doubles as last use, see Prune
+		if (Cluster) { IFileManager::Get().SetTimeStamp(*FilePath, FDateTime::UtcNow()); }
+
+		return Cluster;
+	}
+
+	void Prune(const int64 MaxBytes)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusters::Snapshot::Prune);
+
+		struct FSnapshotFile
+		{
+			FString Path;
+			int64 Size = 0;
+			FDateTime LastUse;
+		};
+
+		TArray<FSnapshotFile> Snapshots;
+		TArray<FString> StaleTempFiles;
+		int64 TotalBytes = 0;
+
+		// Temp files this old can only be leftovers from a write that never completed
+		const FDateTime StaleTime = FDateTime::UtcNow() - FTimespan::FromHours(1);
+
+		IFileManager::Get().IterateDirectoryStat(*GetDirectory(), [&](const TCHAR* Path, const FFileStatData& Stat)
+		{
+			if (Stat.bIsDirectory) { return true; }
+
+			const FString FilePath(Path);
+			if (FilePath.EndsWith(TEXT(".tmp")))
+			{
+				if (Stat.ModificationTime < StaleTime) { StaleTempFiles.Add(FilePath); }
+			}
+			else if (FilePath.EndsWith(TEXT(".pcgexcluster")))
+			{
+				Snapshots.Add(FSnapshotFile{FilePath, Stat.FileSize, Stat.ModificationTime});
+				TotalBytes += Stat.FileSize;
+			}
+
+			return true;
+		});
+
+		for (const FString& FilePath : StaleTempFiles) { IFileManager::Get().Delete(*FilePath, false, false, true); }
+
+		if (TotalBytes <= MaxBytes) { return; }
+
+		Snapshots.Sort([](const FSnapshotFile& A, const FSnapshotFile& B) { return A.LastUse < B.LastUse; });
+
+		for (const FSnapshotFile& Snapshot : Snapshots)
+		{
+			if (TotalBytes <= MaxBytes) { break; }
+			if (IFileManager::Get().Delete(*Snapshot.Path, false, false, true)) { TotalBytes -= Snapshot.Size; }
+		}
+	}
+
+	void PruneAsync()
+	{
+		static std::atomic<bool> bPruning{false};
+		if (bPruning.exchange(true)) { return; }
+
+		const int64 MaxBytes = static_cast<int64>(FMath::Max(1, PCGEX_CORE_SETTINGS.ClusterSnapshotsBudget)) * 1024 * 1024;
+
+		UE::Tasks::Launch(TEXT("PCGExClusterSnapshotPrune"), [MaxBytes]()
+		{
+			Prune(MaxBytes);
+			bPruning = false;
+		}, UE::Tasks::ETaskPriority::BackgroundLow);
+	}
+}
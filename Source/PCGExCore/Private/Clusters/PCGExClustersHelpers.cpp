@@ -5,9 +5,14 @@
 
 #include "PCGExSettingsCacheBody.h"
 #include "PCGExCoreSettingsCache.h"
+#include "PCGExSubSystem.h"
+#include "PCGExH.h"
+#include "Helpers/PCGExMetaHelpers.h"
 #include "Data/PCGExDataTags.h"
 #include "Data/PCGExPointIO.h"
 #include "Clusters/PCGExCluster.h"
+#include "Clusters/PCGExClusterSnapshot.h"
+#include "Hash/xxhash.h"
 #include "Clusters/PCGExClusterCommon.h"
 #include "Data/PCGExClusterData.h"
 #include "Paths/PCGExPathsCommon.h"
@@ -127,4 +132,124 @@ namespace PCGExClusters::Helpers
 
 		return nullptr;
 	}
+
+	static FClusterDataKey GetPersistentClusterDataKey(const TSharedRef<PCGExData::FPointIO>& VtxIO, const TSharedRef<PCGExData::FPointIO>& EdgeIO, const uint32 InBuildOptions)
+	{
+		return FClusterDataKey(VtxIO->GetIn()->UID, EdgeIO->GetIn()->UID, InBuildOptions);
+	}
+
+	// Hashes everything BuildFrom depends on : vtx positions & ids, edge endpoints.
+	// Other attributes don't affect the cluster structure and are ignored on purpose.
+	static FClusterContentKey GetPersistentClusterContentKey(const TSharedRef<PCGExData::FPointIO>& VtxIO, const TSharedRef<PCGExData::FPointIO>& EdgeIO, const uint32 InBuildOptions)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusters::Helpers::GetPersistentClusterContentKey);
+
+		const UPCGBasePointData* VtxData = VtxIO->GetIn();
+		const UPCGBasePointData* EdgeData = EdgeIO->GetIn();
+
+		const FPCGMetadataAttribute<int64>* VtxIdx = PCGExMetaHelpers::TryGetConstAttribute<int64>(VtxData, Labels::Attr_PCGExVtxIdx);
+		const FPCGMetadataAttribute<int64>* EdgeIdx = PCGExMetaHelpers::TryGetConstAttribute<int64>(EdgeData, Labels::Attr_PCGExEdgeIdx);
+
+		if (!VtxIdx || !EdgeIdx) { return FClusterContentKey(); }
+
+		const int32 NumVtx = VtxData->GetNumPoints();
+		const int32 NumEdges = EdgeData->GetNumPoints();
+
+		FXxHash128Builder Builder;
+		Builder.Update(&InBuildOptions, sizeof(uint32));
+		Builder.Update(&NumVtx, sizeof(int32));
+		Builder.Update(&NumEdges, sizeof(int32));
+
+		{
+			const TConstPCGValueRange<FTransform> Transforms = VtxData->GetConstTransformValueRange();
+			const TConstPCGValueRange<int64> VtxEntries = VtxData->GetConstMetadataEntryValueRange();
+
+			TArray<FVector> Positions;
+			TArray<int64> Ids;
+			Positions.SetNumUninitialized(NumVtx);
+			Ids.SetNumUninitialized(NumVtx);
+
+			for (int i = 0; i < NumVtx; i++)
+			{
+				Positions[i] = Transforms[i].GetLocation();
+				Ids[i] = VtxIdx->GetValueFromItemKey(VtxEntries[i]);
+			}
+
+			Builder.Update(Positions.GetData(), Positions.Num() * sizeof(FVector));
+			Builder.Update(Ids.GetData(), Ids.Num() * sizeof(int64));
+		}
+
+		{
+			const TConstPCGValueRange<int64> EdgeEntries = EdgeData->GetConstMetadataEntryValueRange();
+
+			TArray<int64> Ids;
+			Ids.SetNumUninitialized(NumEdges);
+			for (int i = 0; i < NumEdges; i++) { Ids[i] = EdgeIdx->GetValueFromItemKey(EdgeEntries[i]); }
+
+			Builder.Update(Ids.GetData(), Ids.Num() * sizeof(int64));
+		}
+
+		const FXxHash128 Hash = Builder.Finalize();
+
+		FClusterContentKey Key;
+		Key.Low = Hash.HashLow;
+		Key.High = Hash.HashHigh;
+		return Key;
+	}
+
+	TSharedPtr<FCluster> TryGetPersistentCluster(const TSharedRef<PCGExData::FPointIO>& VtxIO, const TSharedRef<PCGExData::FPointIO>& EdgeIO, const uint32 InBuildOptions, FPersistentClusterKey& OutKey)
+	{
+		OutKey = FPersistentClusterKey();
+
+		if (!PCGEX_CORE_SETTINGS.bCacheClusters || !PCGEX_CORE_SETTINGS.bPersistentClusterCache) { return nullptr; }
+
+		UPCGExSubSystem* Subsystem = UPCGExSubSystem::GetSubsystemForCurrentWorld();
+		if (!Subsystem) { return nullptr; }
+
+		OutKey.DataKey = GetPersistentClusterDataKey(VtxIO, EdgeIO, InBuildOptions);
+
+		TSharedPtr<FCluster> CachedCluster = Subsystem->FindCachedClusterByData(OutKey.DataKey, &OutKey.ContentKey);
+		if (!CachedCluster)
+		{
+			OutKey.ContentKey = GetPersistentClusterContentKey(VtxIO, EdgeIO, InBuildOptions);
+			if (!OutKey.ContentKey.IsValid())
+			{
+				OutKey = FPersistentClusterKey();
+				return nullptr;
+			}
+
+			CachedCluster = Subsystem->FindCachedClusterByContent(OutKey.DataKey, OutKey.ContentKey);
+
+			if (!CachedCluster && PCGEX_CORE_SETTINGS.bClusterSnapshots)
+			{
+				// Unknown to this session, but may have been built by a previous one
+				CachedCluster = Snapshot::LoadFromDisk(OutKey.ContentKey, VtxIO, EdgeIO);
+				if (CachedCluster) { Subsystem->CacheCluster(OutKey.DataKey, OutKey.ContentKey, CachedCluster); }
+			}
+		}
+
+		if (CachedCluster && CachedCluster->IsValidWith(VtxIO, EdgeIO)) { return CachedCluster; }
+		return nullptr;
+	}
+
+	void CachePersistentCluster(const TSharedRef<PCGExData::FPointIO>& VtxIO, const TSharedRef<PCGExData::FPointIO>& EdgeIO, const uint32 InBuildOptions, FPersistentClusterKey& InKey, const TSharedPtr<FCluster>& InCluster)
+	{
+		if (!InKey.IsValid() || !InCluster) { return; }
+
+		UPCGExSubSystem* Subsystem = UPCGExSubSystem::GetSubsystemForCurrentWorld();
+		if (!Subsystem) { return; }
+
+		if (!InKey.ContentKey.IsValid()) { InKey.ContentKey = GetPersistentClusterContentKey(VtxIO, EdgeIO, InBuildOptions); }
+		if (!InKey.ContentKey.IsValid()) { return; }
+
+		Subsystem->CacheCluster(InKey.DataKey, InKey.ContentKey, InCluster);
+
+		if (PCGEX_CORE_SETTINGS.bClusterSnapshots) { Snapshot::SaveToDiskAsync(InCluster, InKey.ContentKey); }
+	}
+
+	void UpdatePersistentClusterSnapshot(const FClusterContentKey& InContentKey, const TSharedPtr<FCluster>& InCluster)
+	{
+		if (!InContentKey.IsValid() || !InCluster || !PCGEX_CORE_SETTINGS.bClusterSnapshots) { return; }
+		Snapshot::SaveToDiskAsync(InCluster, InContentKey, true);
+	}
 }
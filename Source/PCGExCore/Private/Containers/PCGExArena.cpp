@@ -0,0 +1,128 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Containers/PCGExArena.h"
+
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/ScopeLock.h"
+
+namespace PCGExMT
+{
+	FArena::FArena(const int32 InBlockSize)
+		: BlockSize(FMath::Max(InBlockSize, 1024))
+	{
+		// One lane per worker, plus game thread; thread ids are hashed so a few collisions are harmless
+		const int32 NumLanes = FMath::RoundUpToPowerOfTwo(FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads() + 1));
+		LaneMask = NumLanes - 1;
+
+		Lanes.Reserve(NumLanes);
+		for (int32 i = 0; i < NumLanes; i++) { Lanes.Add(MakeUnique<FLane>()); }
+	}
+
+	FArena::~FArena()
+	{
+		Reset();
+	}
+
+	void* FArena::Allocate(const SIZE_T InSize, const SIZE_T InAlignment)
+	{
+		FLane& Lane = GetLane();
+		FScopeLock Lock(&Lane.Lock);
+		return AllocateInLane(Lane, InSize, InAlignment);
+	}
+
+	void FArena::Reset()
+	{
+		// Run every destructor before freeing anything, objects may reference memory from other lanes
+		for (const TUniquePtr<FLane>& Lane : Lanes)
+		{
+			FScopeLock Lock(&Lane->Lock);
+			RunDestructors(*Lane);
+		}
+
+		for (const TUniquePtr<FLane>& Lane : Lanes)
+		{
+			FScopeLock Lock(&Lane->Lock);
+			FreeBlocks(*Lane);
+		}
+	}
+
+	int64 FArena::GetAllocatedSize() const
+	{
+		int64 Total = 0;
+		for (const TUniquePtr<FLane>& Lane : Lanes)
+		{
+			FScopeLock Lock(&Lane->Lock);
+			Total += Lane->AllocatedSize;
+		}
+		return Total;
+	}
+
+	FArena::FLane& FArena::GetLane() const
+	{
+		const uint32 ThreadId = FPlatformTLS::GetCurrentThreadId();
+		return *Lanes[(ThreadId * 2654435761U >> 16) & LaneMask];
+	}
+
+	void* FArena::AllocateInLane(FLane& Lane, const SIZE_T InSize, const SIZE_T InAlignment) const
+	{
+		const SIZE_T Size = FMath::Max<SIZE_T>(InSize, 1);
+
+		if (Lane.Cursor)
+		{
+			uint8* Aligned = Align(Lane.Cursor, InAlignment);
+			if (Aligned + Size <= Lane.End)
+			{
+				Lane.Cursor = Aligned + Size;
+				return Aligned;
+			}
+		}
+
+		// Large allocations get a dedicated block so they don't waste the remainder of the current one
+		if (Size > static_cast<SIZE_T>(BlockSize / 4))
+		{
+			void* Dedicated = FMemory::Malloc(Size, InAlignment);
+			Lane.Blocks.Add(Dedicated);
+			Lane.AllocatedSize += Size;
+			return Dedicated;
+		}
+
+		uint8* Block = static_cast<uint8*>(FMemory::Malloc(BlockSize, FMath::Max<SIZE_T>(InAlignment, 16)));
+		Lane.Blocks.Add(Block);
+		Lane.AllocatedSize += BlockSize;
+
+		Lane.Cursor = Block + Size;
+		Lane.End = Block + BlockSize;
+		return Block;
+	}
+
+	void FArena::AddDestructor(void* InObject, const FDestructFunc InDestruct)
+	{
+		FLane& Lane = GetLane();
+		FScopeLock Lock(&Lane.Lock);
+
+		FDestructor* Destructor = new(AllocateInLane(Lane, sizeof(FDestructor), alignof(FDestructor))) FDestructor();
+		Destructor->Object = InObject;
+		Destructor->Destruct = InDestruct;
+		Destructor->Next = Lane.Destructors;
+		Lane.Destructors = Destructor;
+	}
+
+	void FArena::RunDestructors(FLane& Lane)
+	{
+		// Most recent first, mirroring stack unwinding
+		for (FDestructor* Destructor = Lane.Destructors; Destructor; Destructor = Destructor->Next) { Destructor->Destruct(Destructor->Object); }
+		Lane.Destructors = nullptr;
+	}
+
+	void FArena::FreeBlocks(FLane& Lane)
+	{
+		for (void* Block : Lane.Blocks) { FMemory::Free(Block); }
+		Lane.Blocks.Empty();
+
+		Lane.Cursor = nullptr;
+		Lane.End = nullptr;
+		Lane.AllocatedSize = 0;
+	}
+}
@@ -14,6 +14,7 @@
 #include "Engine/AssetManager.h"
 #include "Helpers/PCGHelpers.h"
 #include "Async/Async.h"
+#include "Containers/PCGExArena.h"
 #include "Containers/PCGExManagedObjects.h"
 #include "Data/PCGExDataCommon.h"
 #include "Data/PCGExProxyData.h"
@@ -135,12 +136,14 @@ FPCGExContext::FPCGExContext()
 	ManagedObjects = MakeShared<PCGEx::FManagedObjects>(this, WorkHandle);
 	UniqueNameGenerator = MakeShared<FPCGExUniqueNameGenerator>();
 	BufferProxyPool = MakeShared<PCGExData::IBufferProxyPool>();
+	Arena = MakeShared<PCGExMT::FArena>();
 }
 
 FPCGExContext::~FPCGExContext()
 {
 	//WorkHandle.Reset();
 	ManagedObjects->Flush(); // So cleanups can be recursively triggered while manager is still alive
+	Arena.Reset();           // After managed objects, which may still point into it
 	PCGExHelpers::SafeReleaseHandles(TrackedAssets);
 }
 
@@ -945,6 +945,86 @@ namespace PCGExMT
 
 		return true;
 	}
+
+	bool FResumableJob::Start(const TSharedPtr<IAsyncHandleGroup>& InParent)
+	{
+		if (!InParent || !InParent->IsAvailable()) { return false; }
+
+		PCGEX_MAKE_SHARED(Task, FResumableJobTask, SharedThis(this))
+		InParent->Launch(Task);
+		return true;
+	}
+
+	bool FResumableJob::ShouldYield() const
+	{
+		return FPlatformTime::Seconds() >= SliceEndTime || IsCancelled();
+	}
+
+	bool FResumableJob::IsCancelled() const
+	{
+		return !ActiveManager || !ActiveManager->IsAvailable() || (ActiveTask && ActiveTask->IsCancelled());
+	}
+
+	bool FResumableJob::ExecuteSlice()
+	{
+		return !OnSliceCallback || OnSliceCallback(*this);
+	}
+
+	FResumableLoop::FResumableLoop(const int32 InNumIterations)
+		: Scope(FScope(0, InNumIterations, 0)), NumIterations(InNumIterations)
+	{
+	}
+
+	bool FResumableLoop::ExecuteSlice()
+	{
+		if (!OnIterationCallback || Scope.Start >= Scope.End) { return true; }
+
+		PCGEX_SCOPE_LOOP(Index)
+		{
+			OnIterationCallback(Index, Scope);
+			if (ShouldYield())
+			{
+				Scope.Start = Index + 1;
+				Scope.LoopIndex++;
+				SetProgress(static_cast<float>(Scope.Start) / static_cast<float>(NumIterations));
+				return Scope.Start >= Scope.End;
+			}
+		}
+
+		return true;
+	}
+
+	void FResumableJobTask::ExecuteTask(const TSharedPtr<FTaskManager>& TaskManager)
+	{
+		if (!Job || IsCancelled() || !TaskManager->IsAvailable()) { return; }
+
+		Job->ActiveTask = this;
+		Job->ActiveManager = TaskManager.Get();
+		Job->SliceEndTime = FPlatformTime::Seconds() + Job->SliceBudget;
+		Job->NumSlices++;
+
+		const bool bDone = Job->ExecuteSlice();
+
+		Job->ActiveTask = nullptr;
+		Job->ActiveManager = nullptr;
+
+		if (bDone)
+		{
+			Job->SetProgress(1);
+			if (Job->OnCompleteCallback)
+			{
+				const FCompletionCallback Callback = MoveTemp(Job->OnCompleteCallback);
+				Callback();
+			}
+			return;
+		}
+
+		if (IsCancelled() || !TaskManager->IsAvailable()) { return; }
+
+		// Launched while this task still runs, so the parent group can't complete in between
+		PCGEX_MAKE_SHARED(Next, FResumableJobTask, Job)
+		Launch(Next);
+	}
 }
 
 #undef PCGEX_TASK_LOG
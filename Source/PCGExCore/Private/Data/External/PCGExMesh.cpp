@@ -15,6 +15,7 @@
 #include "Data/External/PCGExMeshImportDetails.h"
 #include "Helpers/PCGExArrayHelpers.h"
 #include "Helpers/PCGExStreamingHelpers.h"
+#include "Sorting/PCGExSortingHelpers.h"
 
 namespace PCGExMesh
 {
@@ -45,136 +46,293 @@ namespace PCGExMesh
 		}
 	}
 
-#pragma region Lookup
+#pragma region Weld
 
 	namespace Internal
 	{
-		class IMeshLookup
+		constexpr int32 RunChunkSize = 16384;
+
+		// Calls Func(Start, End) for every run of equal keys, in parallel. Runs are never split across tasks.
+		template <typename FRunFunc>
+		void ParallelForEachRun(const TArray<PCGEx::FIndexKey>& InKeys, FRunFunc&& Func)
+		{
+			const int32 NumKeys = InKeys.Num();
+			const int32 NumChunks = FMath::DivideAndRoundUp(NumKeys, RunChunkSize);
+
+			ParallelFor(NumChunks, [&](const int32 Chunk)
+			{
+				int32 Start = Chunk * RunChunkSize;
+				const int32 ChunkEnd = FMath::Min(NumKeys, Start + RunChunkSize);
+
+				// Skip the tail of a run owned by the previous chunk
+				while (Start > 0 && Start < ChunkEnd && InKeys[Start].Key == InKeys[Start - 1].Key) { Start++; }
+
+				while (Start < ChunkEnd)
+				{
+					int32 End = Start + 1;
+					while (End < NumKeys && InKeys[End].Key == InKeys[Start].Key) { End++; }
+					Func(Start, End);
+					Start = End;
+				}
+			}, NumChunks < 2);
+		}
+
+		/**
+		 * Sort-based vertex weld. Output is identical to welding corners one at a time through a spatial hash, in index buffer order:
+		 * a corner reuses the vertex registered under its cell key (or its half-offset cell key, in precise mode),
+		 * otherwise it creates a new vertex registered under both keys.
+		 *
+		 * Corners sharing the same keys form a group, and only the first corner of a group can create a vertex.
+		 * Groups that do are a greedy independent set over groups sharing any key, taken in first-corner order;
+		 * it is resolved in parallel rounds. Every corner then picks the vertex the sequential lookup would have found.
+		 * 
+		 * @param OutCornerVertices Vertex index of each entry of the index buffer
+		 */
+		void WeldVertices(
+			const FPositionVertexBuffer& InPositions, const FIndexArrayView& InIndices,
+			const FVector& InTolerance, const bool bPrecise,
+			TArray<FVector>& OutVertices, TArray<int32>& OutRawIndices, TArray<int32>& OutCornerVertices)
 		{
-		protected:
-			uint32 InternalIdx = 0;
-			TArray<FVector>* Vertices = nullptr;
-			TArray<int32>* RawIndices = nullptr;
-			FVector HashTolerance = FVector(DefaultVertexMergeHashTolerance);
-			bool bPreciseVertexMerge = true;
-
-			/*
-			 * This will be set false in the constructor if the hash tolerance is zero.
-			 * That behavior is for future use in contexts other than Clusters, and the
-			 * MeshToClusters node intentionally clamps the tolerance nonzero to prevent
-			 * the behavior from triggering from that node.
-			 */
-			bool bEnableVertexMerge = true;
-
-		public:
-			virtual ~IMeshLookup() = default;
-			/* Primary vertex hash */
-			TMap<uint64, int32> Data;
-
-			explicit IMeshLookup(
-				const int32 Size,
-				TArray<FVector>* InVertices,
-				TArray<int32>* InRawIndices,
-				const FVector& InHashTolerance = FVector(DefaultVertexMergeHashTolerance))
-				: Vertices(InVertices), RawIndices(InRawIndices), HashTolerance(InHashTolerance)
+			TRACE_CPUPROFILER_EVENT_SCOPE(PCGExMesh::WeldVertices);
+
+			const int32 NumCorners = InIndices.Num();
+			const bool bForceSingleThread = NumCorners < RunChunkSize;
+
+			OutVertices.Reset();
+			OutRawIndices.Reset();
+			OutCornerVertices.SetNumUninitialized(NumCorners);
+
+			if (!NumCorners) { return; }
+
+			// Zero tolerance is left as-is, matching the hash lookup behavior
+			const FVector Tolerance = InTolerance.SizeSquared() > 0 ? PCGEx::SafeTolerance(InTolerance) : FVector::ZeroVector;
+
+			auto GetPosition = [&](const int32 Corner) { return FVector(InPositions.VertexPosition(InIndices[Corner])); };
+
+			TArray<uint64> CellKeys;
+			TArray<uint64> OffsetKeys;
+			CellKeys.SetNumUninitialized(NumCorners);
+			OffsetKeys.SetNumUninitialized(NumCorners);
+
+			ParallelFor(NumCorners, [&](const int32 i)
 			{
-				/* Optimization to skip processing if tolerance is zero. */
-				bEnableVertexMerge = HashTolerance.SizeSquared() > 0.0f;
+				const FVector Position = GetPosition(i);
+				CellKeys[i] = PCGEx::SH3(Position, Tolerance);
+				OffsetKeys[i] = bPrecise ? PCGEx::SH3(Position + (0.5 * Tolerance), Tolerance) : CellKeys[i];
+			}, bForceSingleThread);
+
+			// Sort corners by (cell, offset cell); stable sorts keep corners of a group in index order
 
-				HashTolerance = bEnableVertexMerge ? PCGEx::SafeTolerance(InHashTolerance) : FVector(0.0f);
-				Vertices->Reserve(Size);
-				if (RawIndices) { RawIndices->Reserve(Size); }
+			TArray<PCGEx::FIndexKey> Corners;
+			Corners.SetNumUninitialized(NumCorners);
+
+			if (bPrecise)
+			{
+				ParallelFor(NumCorners, [&](const int32 i) { Corners[i] = PCGEx::FIndexKey(i, OffsetKeys[i]); }, bForceSingleThread);
+				PCGExSortingHelpers::ParallelRadixSort(Corners);
+				ParallelFor(NumCorners, [&](const int32 i) { Corners[i].Key = CellKeys[Corners[i].Index]; }, bForceSingleThread);
 			}
+			else
+			{
+				ParallelFor(NumCorners, [&](const int32 i) { Corners[i] = PCGEx::FIndexKey(i, CellKeys[i]); }, bForceSingleThread);
+			}
+
+			PCGExSortingHelpers::ParallelRadixSort(Corners);
 
-			virtual uint32 Add_GetIdx(const FVector& Position, const int32 RawIndex) = 0;
+			auto IsGroupStart = [&](const int32 i)
+			{
+				if (i == 0) { return true; }
+				const int32 A = Corners[i - 1].Index;
+				const int32 B = Corners[i].Index;
+				return CellKeys[A] != CellKeys[B] || OffsetKeys[A] != OffsetKeys[B];
+			};
+
+			// Groups, identified by their first corner
 
-			/* Adds a vertex to the container and returns its index. */
-			FORCEINLINE int32 AddVertex(const FVector& Position, const int32 RawIndex) const
+			TArray<int32> GroupFirst;
+			TArray<int32> CornerGroups;
+			CornerGroups.SetNumUninitialized(NumCorners);
+
+			GroupFirst.Reserve(NumCorners / 4);
+			for (int32 i = 0; i < NumCorners; i++)
 			{
-				const int32 Idx = Vertices->Emplace(Position);
-				if (RawIndices) { RawIndices->Emplace(RawIndex); }
-				return Idx;
+				if (IsGroupStart(i)) { GroupFirst.Add(Corners[i].Index); }
+				CornerGroups[Corners[i].Index] = GroupFirst.Num() - 1;
 			}
 
-			FORCEINLINE int32 Num() const { return Data.Num(); }
-		};
+			const int32 NumGroups = GroupFirst.Num();
 
-		template <bool bCollapse = true, bool bPrecise = true>
-		class TMeshLookup : public IMeshLookup
-		{
-		public:
-			explicit TMeshLookup(
-				const int32 Size,
-				TArray<FVector>* InVertices,
-				TArray<int32>* InRawIndices,
-				const FVector& InHashTolerance = FVector(DefaultVertexMergeHashTolerance))
-				: IMeshLookup(Size, InVertices, InRawIndices, InHashTolerance)
+			// Groups in first-corner order, which is the order the sequential lookup would register them in
+
+			TArray<PCGEx::FIndexKey> GroupOrder;
+			GroupOrder.SetNumUninitialized(NumGroups);
+			ParallelFor(NumGroups, [&](const int32 g) { GroupOrder[g] = PCGEx::FIndexKey(g, GroupFirst[g]); }, bForceSingleThread);
+			PCGExSortingHelpers::ParallelRadixSort(GroupOrder);
+
+			// Key runs : groups sharing a cell or offset cell key conflict with each other
+
+			TArray<PCGEx::FIndexKey> KeyEntries;
+			KeyEntries.Reserve(NumGroups * 2);
+			for (int32 g = 0; g < NumGroups; g++)
 			{
-				if constexpr (bCollapse) { Data.Reserve(Size); }
+				const int32 First = GroupFirst[g];
+				KeyEntries.Emplace(g, CellKeys[First]);
+				if (OffsetKeys[First] != CellKeys[First]) { KeyEntries.Emplace(g, OffsetKeys[First]); }
 			}
 
-			virtual uint32 Add_GetIdx(const FVector& Position, const int32 RawIndex) override
+			PCGExSortingHelpers::ParallelRadixSort(KeyEntries);
+
+			// Run of each group's cell key (X) and offset cell key (Y), as [Start, End) ranges in KeyEntries
+			TArray<FInt32Point> CellRuns;
+			TArray<FInt32Point> OffsetRuns;
+			CellRuns.SetNumUninitialized(NumGroups);
+			OffsetRuns.SetNumUninitialized(NumGroups);
+
+			ParallelForEachRun(KeyEntries, [&](const int32 Start, const int32 End)
 			{
-				// Spatial hash-based vertex deduplication.
-				// Quantizes positions into grid cells of size HashTolerance and looks up by cell key.
-				// The "precise" variant also checks a half-offset cell to catch vertices that
-				// land near cell boundaries — without this, two vertices 0.01 apart could hash
-				// to different cells despite being within tolerance. Registering under both keys
-				// ensures consistent deduplication regardless of which cell a future vertex hashes to.
-				if constexpr (bCollapse)
+				for (int32 i = Start; i < End; i++)
 				{
-					const uint64 Key = PCGEx::SH3(Position, HashTolerance);
+					const int32 g = KeyEntries[i].Index;
+					const int32 First = GroupFirst[g];
+					if (KeyEntries[i].Key == CellKeys[First]) { CellRuns[g] = FInt32Point(Start, End); }
+					if (KeyEntries[i].Key == OffsetKeys[First]) { OffsetRuns[g] = FInt32Point(Start, End); }
+				}
+			});
+
+			// Greedy independent set in first-corner order.
+			// A group creates a vertex if no earlier conflicting group does; a group is decided once all earlier conflicting groups are.
+
+			enum EState : int8 { Pending = 0, Creates = 1, Reuses = 2 };
 
-					// Check if exact cell has a match
-					if (const int32* IdxPtr = Data.Find(Key)) { return *IdxPtr; }
+			TArray<int8> States;
+			States.Init(Pending, NumGroups);
 
-					if constexpr (bPrecise)
+			const int32 NumChunks = FMath::DivideAndRoundUp(NumGroups, RunChunkSize);
+			int32 NumPending = NumGroups;
+
+			while (NumPending > 0)
+			{
+				TArray<int32> ChunkPending;
+				ChunkPending.Init(0, NumChunks);
+
+				ParallelFor(NumChunks, [&](const int32 Chunk)
+				{
+					const int32 End = FMath::Min(NumGroups, (Chunk + 1) * RunChunkSize);
+					for (int32 i = Chunk * RunChunkSize; i < End; i++)
 					{
-						// Check offset cell to catch vertices straddling cell boundaries
-						const uint64 OffsetKey = PCGEx::SH3(Position + (0.5 * HashTolerance), HashTolerance);
-						if (OffsetKey != Key)
+						const int32 g = GroupOrder[i].Index;
+						if (FPlatformAtomics::AtomicRead(&States[g]) != Pending) { continue; }
+
+						const int32 First = GroupFirst[g];
+						EState State = Creates;
+
+						auto TestRun = [&](const FInt32Point& Run)
 						{
-							if (const int32* IdxPtr = Data.Find(OffsetKey)) { return *IdxPtr; }
-						}
-
-						// Register under both keys so future vertices can find us from either cell
-						const int32 Idx = AddVertex(Position, RawIndex);
-						Data.Add(Key, Idx);
-						if (OffsetKey != Key) { Data.Add(OffsetKey, Idx); }
-						return Idx;
-					}
-					else
-					{
-						const int32 Idx = AddVertex(Position, RawIndex);
-						Data.Add(Key, Idx);
-						return Idx;
+							for (int32 r = Run.X; r < Run.Y && State != Reuses; r++)
+							{
+								const int32 Other = KeyEntries[r].Index;
+								if (GroupFirst[Other] >= First) { continue; }
+
+								const int8 OtherState = FPlatformAtomics::AtomicRead(&States[Other]);
+								if (OtherState == Creates) { State = Reuses; }
+								else if (OtherState == Pending) { State = Pending; }
+							}
+						};
+
+						TestRun(CellRuns[g]);
+						TestRun(OffsetRuns[g]);
+
+						if (State == Pending) { ChunkPending[Chunk]++; }
+						else { FPlatformAtomics::AtomicStore(&States[g], static_cast<int8>(State)); }
 					}
-				}
-				else
+				}, NumChunks < 2);
+
+				const int32 LastPending = NumPending;
+
+				NumPending = 0;
+				for (const int32 Count : ChunkPending) { NumPending += Count; }
+
+				// The earliest pending group is always decided, so each round makes progress
+				if (!ensure(NumPending < LastPending)) { break; }
+			}
+
+			// Vertices are created in first-corner order
+
+			TArray<int32> GroupVertices;
+			GroupVertices.Init(-1, NumGroups);
+
+			TArray<int32> CreatingGroups;
+			CreatingGroups.Reserve(NumGroups);
+			for (const PCGEx::FIndexKey& Entry : GroupOrder)
+			{
+				if (States[Entry.Index] != Creates) { continue; }
+				GroupVertices[Entry.Index] = CreatingGroups.Add(Entry.Index);
+			}
+
+			OutVertices.SetNumUninitialized(CreatingGroups.Num());
+			OutRawIndices.SetNumUninitialized(CreatingGroups.Num());
+
+			ParallelFor(CreatingGroups.Num(), [&](const int32 i)
+			{
+				const int32 First = GroupFirst[CreatingGroups[i]];
+				OutVertices[i] = GetPosition(First);
+				OutRawIndices[i] = InIndices[First];
+			}, bForceSingleThread);
+
+			// Each key is registered by at most one group
+			TArray<int32> KeyOwners;
+			KeyOwners.SetNumUninitialized(KeyEntries.Num());
+
+			ParallelForEachRun(KeyEntries, [&](const int32 Start, const int32 End)
+			{
+				int32 Owner = -1;
+				for (int32 i = Start; i < End && Owner == -1; i++) { if (States[KeyEntries[i].Index] == Creates) { Owner = KeyEntries[i].Index; } }
+				for (int32 i = Start; i < End; i++) { KeyOwners[i] = Owner; }
+			});
+
+			// A corner finds its cell key if it was registered before it, otherwise its offset cell key
+			ParallelFor(NumCorners, [&](const int32 Corner)
+			{
+				const int32 g = CornerGroups[Corner];
+
+				const int32 CellOwner = KeyOwners[CellRuns[g].X];
+				if (CellOwner != -1 && GroupFirst[CellOwner] <= Corner)
 				{
-					return AddVertex(Position, RawIndex);
+					OutCornerVertices[Corner] = GroupVertices[CellOwner];
+					return;
 				}
-			}
-		};
-
-		TUniquePtr<IMeshLookup> CreateMeshLookup(
-			const int32 Size,
-			TArray<FVector>* InVertices,
-			TArray<int32>* InRawIndices,
-			const FVector& InHashTolerance = FVector(DefaultVertexMergeHashTolerance),
-			const bool bPreciseVertexMerge = true,
-			const bool bMerge = true)
+
+				const int32 OffsetOwner = KeyOwners[OffsetRuns[g].X];
+				OutCornerVertices[Corner] = ensure(OffsetOwner != -1 && GroupFirst[OffsetOwner] <= Corner) ? GroupVertices[OffsetOwner] : GroupVertices[g];
+			}, bForceSingleThread);
+		}
+
+		/**
+		 * Deduplicates edges, keeping the order in which they are first found.
+		 * @param InEdges Edge hashes, MAX_uint64 for entries to ignore. Sorted by hash on return; Index is the position in the input.
+		 * @param OutEdges Receives unique edges, in first-found order
+		 */
+		void AddUniqueEdges(TArray<PCGEx::FIndexKey>& InEdges, TSet<uint64>& OutEdges)
 		{
-			if (bPreciseVertexMerge)
+			PCGExSortingHelpers::ParallelRadixSort(InEdges);
+
+			// First occurrence of each edge; stable sort keeps it at the start of its run
+			TArray<PCGEx::FIndexKey> Unique;
+			Unique.Reserve(InEdges.Num() / 2);
+			for (int32 i = 0; i < InEdges.Num(); i++)
 			{
-				if (bMerge) { return MakeUnique<TMeshLookup<true, true>>(Size, InVertices, InRawIndices, InHashTolerance); }
-				return MakeUnique<TMeshLookup<false, true>>(Size, InVertices, InRawIndices, InHashTolerance);
+				if (InEdges[i].Key == MAX_uint64) { break; }
+				if (i == 0 || InEdges[i].Key != InEdges[i - 1].Key) { Unique.Emplace(i, InEdges[i].Index); }
 			}
 
-			if (bMerge) { return MakeUnique<TMeshLookup<true, false>>(Size, InVertices, InRawIndices, InHashTolerance); }
-			return MakeUnique<TMeshLookup<false, false>>(Size, InVertices, InRawIndices, InHashTolerance);
+			// Back to first-found order, so set iteration matches sequential insertion
+			PCGExSortingHelpers::ParallelRadixSort(Unique);
+
+			OutEdges.Reserve(OutEdges.Num() + Unique.Num());
+			for (const PCGEx::FIndexKey& Entry : Unique) { OutEdges.Add(InEdges[Entry.Index].Key); }
 		}
 	}
+
 #pragma endregion
 
 	FMeshData::FMeshData(const UStaticMesh* InStaticMesh)
@@ -304,6 +462,8 @@ namespace PCGExMesh
 
 	void FGeoStaticMesh::ExtractMeshSynchronous()
 	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FGeoStaticMesh::ExtractMeshSynchronous);
+
 		if (bIsLoaded) { return; }
 		if (!bIsValid) { return; }
 
@@ -319,23 +479,26 @@ namespace PCGExMesh
 		const FIndexArrayView Indices = RawData.Indices;
 		const int32 NumTriangles = RawData.NumTriangles();
 
-		TUniquePtr<Internal::IMeshLookup> MeshLookup = Internal::CreateMeshLookup(PositionBuffer.GetNumVertices() / 3, &Vertices, &RawIndices, CWTolerance, bPreciseVertexMerge);
-		Edges.Reserve(NumTriangles / 2);
+		TArray<int32> CornerVertices;
+		Internal::WeldVertices(PositionBuffer, Indices, CWTolerance, bPreciseVertexMerge, Vertices, RawIndices, CornerVertices);
 
-		for (int i = 0; i < Indices.Num(); i += 3)
+		// Triangle edges in AB, BC, CA order; collapsed edges are ignored
+		TArray<PCGEx::FIndexKey> TriEdges;
+		TriEdges.SetNumUninitialized(NumTriangles * 3);
+
+		ParallelFor(NumTriangles, [&](const int32 t)
 		{
-			const int32 RawA = Indices[i];
-			const int32 RawB = Indices[i + 1];
-			const int32 RawC = Indices[i + 2];
+			const int32 i = t * 3;
+			const uint32 A = CornerVertices[i];
+			const uint32 B = CornerVertices[i + 1];
+			const uint32 C = CornerVertices[i + 2];
 
-			const uint32 A = MeshLookup->Add_GetIdx(FVector(PositionBuffer.VertexPosition(RawA)), RawA);
-			const uint32 B = MeshLookup->Add_GetIdx(FVector(PositionBuffer.VertexPosition(RawB)), RawB);
-			const uint32 C = MeshLookup->Add_GetIdx(FVector(PositionBuffer.VertexPosition(RawC)), RawC);
+			TriEdges[i] = PCGEx::FIndexKey(i, A != B ? PCGEx::H64U(A, B) : MAX_uint64);
+			TriEdges[i + 1] = PCGEx::FIndexKey(i + 1, B != C ? PCGEx::H64U(B, C) : MAX_uint64);
+			TriEdges[i + 2] = PCGEx::FIndexKey(i + 2, C != A ? PCGEx::H64U(C, A) : MAX_uint64);
+		}, NumTriangles < Internal::RunChunkSize);
 
-			if (A != B) { Edges.Add(PCGEx::H64U(A, B)); }
-			if (B != C) { Edges.Add(PCGEx::H64U(B, C)); }
-			if (C != A) { Edges.Add(PCGEx::H64U(C, A)); }
-		}
+		Internal::AddUniqueEdges(TriEdges, Edges);
 
 		bIsLoaded = true;
 	}
@@ -361,76 +524,102 @@ namespace PCGExMesh
 
 		Edges.Empty();
 
-		TUniquePtr<Internal::IMeshLookup> MeshLookup = Internal::CreateMeshLookup(RawData.NumVertices() / 3, &Vertices, &RawIndices, CWTolerance, bPreciseVertexMerge);
+		TArray<int32> CornerVertices;
+		Internal::WeldVertices(PositionBuffer, Indices, CWTolerance, bPreciseVertexMerge, Vertices, RawIndices, CornerVertices);
+
+		// Drop triangles collapsed by the weld
+
+		Triangles.SetNumUninitialized(NumTriangles);
+
+		int32 NumValid = 0;
+		for (int32 t = 0; t < NumTriangles; t++)
+		{
+			const int32 A = CornerVertices[t * 3];
+			const int32 B = CornerVertices[t * 3 + 1];
+			const int32 C = CornerVertices[t * 3 + 2];
+
+			if (A == B || B == C || C == A) { continue; }
+			Triangles[NumValid++] = FIntVector3(A, B, C);
+		}
+
+		Triangles.SetNum(NumValid);
+		if (Triangles.IsEmpty())
+		{
+			bIsValid = false;
+			return;
+		}
 
-		Triangles.Init(FIntVector3(-1), NumTriangles);
 		Tri_Adjacency.Init(FIntVector3(-1), NumTriangles);
 
 		TBitArray<> Tri_IsOnHull;
 		Tri_IsOnHull.Init(true, NumTriangles);
 
-		TMap<uint64, int32> EdgeMap;
-		EdgeMap.Reserve(NumTriangles / 2);
+		const bool bForceSingleThread = NumValid < Internal::RunChunkSize;
 
-		auto PushAdjacency = [&](const int32 Tri, const int32 OtherTri)
-		{
-			FIntVector3& Adjacency = Tri_Adjacency[Tri];
-			for (int i = 0; i < 3; i++)
-			{
-				if (Adjacency[i] == -1)
-				{
-					Adjacency[i] = OtherTri;
-					if (i == 2) { Tri_IsOnHull[Tri] = false; }
-					break;
-				}
-			}
-		};
+		// Triangle edges in AB, BC, AC order. Entry index doubles as the time at which the edge is visited.
+		TArray<PCGEx::FIndexKey> TriEdges;
+		TriEdges.SetNumUninitialized(NumValid * 3);
 
-		auto PushEdge = [&](const int32 Tri, const uint64 Edge)
+		ParallelFor(NumValid, [&](const int32 t)
 		{
-			bool bIsAlreadySet = false;
-			Edges.Add(Edge, &bIsAlreadySet);
-			if (bIsAlreadySet)
-			{
-				if (int32 OtherTri = -1; EdgeMap.RemoveAndCopyValue(Edge, OtherTri))
-				{
-					PushAdjacency(OtherTri, Tri);
-					PushAdjacency(Tri, OtherTri);
-				}
-			}
-			else
-			{
-				EdgeMap.Add(Edge, Tri);
-			}
-		};
+			const FIntVector3& Tri = Triangles[t];
+			const int32 i = t * 3;
 
-		int32 Ti = 0;
-		for (int i = 0; i < Indices.Num(); i += 3)
+			TriEdges[i] = PCGEx::FIndexKey(i, PCGEx::H64U(Tri.X, Tri.Y));
+			TriEdges[i + 1] = PCGEx::FIndexKey(i + 1, PCGEx::H64U(Tri.Y, Tri.Z));
+			TriEdges[i + 2] = PCGEx::FIndexKey(i + 2, PCGEx::H64U(Tri.X, Tri.Z));
+		}, bForceSingleThread);
+
+		// Leaves TriEdges sorted by edge, each run in visit order
+		Internal::AddUniqueEdges(TriEdges, Edges);
+
+		// Only the first two triangles visiting an edge are paired; later ones on a non-manifold edge are ignored.
+		// An edge visited by a single triangle is left unmatched, making it a hull edge.
+
+		TArray<int8> UnmatchedEdges;
+		UnmatchedEdges.SetNumUninitialized(NumValid * 3);
+
+		// Adjacency pushes keyed by (triangle, visit time), to be replayed in the order they'd happen sequentially
+		TArray<PCGEx::FIndexKey> AdjacencyEvents;
+		AdjacencyEvents.SetNumUninitialized(NumValid * 3);
+
+		Internal::ParallelForEachRun(TriEdges, [&](const int32 Start, const int32 End)
 		{
-			const int32 RawA = Indices[i];
-			const int32 RawB = Indices[i + 1];
-			const int32 RawC = Indices[i + 2];
+			const int8 bUnmatched = (End - Start) == 1;
 
-			const uint32 A = MeshLookup->Add_GetIdx(FVector(PositionBuffer.VertexPosition(RawA)), RawA);
-			const uint32 B = MeshLookup->Add_GetIdx(FVector(PositionBuffer.VertexPosition(RawB)), RawB);
-			const uint32 C = MeshLookup->Add_GetIdx(FVector(PositionBuffer.VertexPosition(RawC)), RawC);
+			for (int32 i = Start; i < End; i++)
+			{
+				UnmatchedEdges[TriEdges[i].Index] = bUnmatched;
+				AdjacencyEvents[i] = PCGEx::FIndexKey(-1, MAX_uint64);
+			}
 
-			if (A == B || B == C || C == A) { continue; }
+			if (End - Start < 2) { return; }
 
-			Triangles[Ti] = FIntVector3(A, B, C);
+			const int32 TriA = TriEdges[Start].Index / 3;
+			const int32 TriB = TriEdges[Start + 1].Index / 3;
+			const uint64 Time = TriEdges[Start + 1].Index;
 
-			PushEdge(Ti, PCGEx::H64U(A, B));
-			PushEdge(Ti, PCGEx::H64U(B, C));
-			PushEdge(Ti, PCGEx::H64U(A, C));
+			AdjacencyEvents[Start] = PCGEx::FIndexKey(TriB, static_cast<uint64>(TriA) << 32 | Time);
+			AdjacencyEvents[Start + 1] = PCGEx::FIndexKey(TriA, static_cast<uint64>(TriB) << 32 | Time);
+		});
 
-			Ti++;
-		}
+		PCGExSortingHelpers::ParallelRadixSort(AdjacencyEvents);
 
-		Triangles.SetNum(Ti);
-		if (Triangles.IsEmpty())
+		for (const PCGEx::FIndexKey& Event : AdjacencyEvents)
 		{
-			bIsValid = false;
-			return;
+			if (Event.Key == MAX_uint64) { break; }
+
+			const int32 Tri = static_cast<int32>(Event.Key >> 32);
+			FIntVector3& Adjacency = Tri_Adjacency[Tri];
+			for (int i = 0; i < 3; i++)
+			{
+				if (Adjacency[i] == -1)
+				{
+					Adjacency[i] = Event.Index;
+					if (i == 2) { Tri_IsOnHull[Tri] = false; }
+					break;
+				}
+			}
 		}
 
 		for (int i = 0; i < Triangles.Num(); i++)
@@ -442,30 +631,26 @@ namespace PCGExMesh
 
 			if (Tri_IsOnHull[i])
 			{
-				const uint64 AB = PCGEx::H64U(A, B);
-				const uint64 BC = PCGEx::H64U(B, C);
-				const uint64 AC = PCGEx::H64U(A, C);
-
 				// Push edges that are still waiting to be matched
-				if (EdgeMap.Contains(AB))
+				if (UnmatchedEdges[i * 3])
 				{
 					HullIndices.Add(A);
 					HullIndices.Add(B);
-					HullEdges.Add(AB);
+					HullEdges.Add(PCGEx::H64U(A, B));
 				}
 
-				if (EdgeMap.Contains(BC))
+				if (UnmatchedEdges[i * 3 + 1])
 				{
 					HullIndices.Add(B);
 					HullIndices.Add(C);
-					HullEdges.Add(BC);
+					HullEdges.Add(PCGEx::H64U(B, C));
 				}
 
-				if (EdgeMap.Contains(AC))
+				if (UnmatchedEdges[i * 3 + 2])
 				{
 					HullIndices.Add(A);
 					HullIndices.Add(C);
-					HullEdges.Add(AC);
+					HullEdges.Add(PCGEx::H64U(A, C));
 				}
 			}
 		}
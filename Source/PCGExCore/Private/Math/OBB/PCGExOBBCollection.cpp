@@ -7,6 +7,12 @@
 
 namespace PCGExMath::OBB
 {
+	namespace CollectionDetails
+	{
+		// Below this, the octree alone is cheaper than building the packed copy
+		constexpr int32 MinPackedSize = 256;
+	}
+
 	void FCollection::Reserve(int32 Count)
 	{
 		Bounds.Reserve(Count);
@@ -27,6 +33,8 @@ namespace PCGExMath::OBB
 
 	void FCollection::BuildOctree()
 	{
+		Packed.Reset();
+
 		if (Bounds.IsEmpty())
 		{
 			Octree.Reset();
@@ -44,6 +52,12 @@ namespace PCGExMath::OBB
 			const FBounds& B = Bounds[i];
 			Octree->AddElement(PCGExOctree::FItem(i, FBoxSphereBounds(B.Origin, FVector(B.Radius), B.Radius)));
 		}
+
+		if (Count >= CollectionDetails::MinPackedSize)
+		{
+			Packed = MakeUnique<FPackedCollection>();
+			Packed->Build(Bounds, Orientations);
+		}
 	}
 
 	void FCollection::Reset()
@@ -51,6 +65,7 @@ namespace PCGExMath::OBB
 		Bounds.Reset();
 		Orientations.Reset();
 		Octree.Reset();
+		Packed.Reset();
 		WorldBounds = FBox(ForceInit);
 	}
 
@@ -142,6 +157,11 @@ namespace PCGExMath::OBB
 			return false;
 		}
 
+		if (UsePacked(Mode))
+		{
+			return !Packed->ForEachOverlap(Query, Mode == EPCGExBoxCheckMode::ExpandedBox ? Expansion : 0, [](const int32) { return false; });
+		}
+
 		const float R = Query.Bounds.Radius + Expansion;
 		const FBoxCenterAndExtent QueryBounds(Query.Bounds.Origin, FVector4(R, R, R, R));
 
@@ -166,6 +186,16 @@ namespace PCGExMath::OBB
 			return false;
 		}
 
+		if (UsePacked(Mode))
+		{
+			return !Packed->ForEachOverlap(
+				Query, Mode == EPCGExBoxCheckMode::ExpandedBox ? Expansion : 0, [&](const int32 Index)
+				{
+					OutIndex = Bounds[Index].Index;
+					return false;
+				});
+		}
+
 		const float R = Query.Bounds.Radius + Expansion;
 		const FBoxCenterAndExtent QueryBounds(Query.Bounds.Origin, FVector4(R, R, R, R));
 
@@ -191,6 +221,17 @@ namespace PCGExMath::OBB
 			return;
 		}
 
+		if (UsePacked(Mode))
+		{
+			Packed->ForEachOverlap(
+				Query, Mode == EPCGExBoxCheckMode::ExpandedBox ? Expansion : 0, [&](const int32 Index)
+				{
+					OutIndices.Add(Bounds[Index].Index);
+					return true;
+				});
+			return;
+		}
+
 		const float R = Query.Bounds.Radius + Expansion;
 		const FBoxCenterAndExtent QueryBounds(Query.Bounds.Origin, FVector4(R, R, R, R));
 
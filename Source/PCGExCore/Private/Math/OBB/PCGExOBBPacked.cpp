@@ -0,0 +1,261 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Math/OBB/PCGExOBBPacked.h"
+
+#include "Async/ParallelFor.h"
+#include "Sorting/PCGExSpatialSort.h"
+
+namespace PCGExMath::OBB
+{
+	namespace Packed
+	{
+		constexpr int32 LeafPackets = 4;
+
+		enum ERow : int32
+		{
+			CX = 0, CY, CZ,
+			XX, XY, XZ,
+			YX, YY, YZ,
+			ZX, ZY, ZZ,
+			EX, EY, EZ
+		};
+	}
+
+	void FPackedCollection::Build(TConstArrayView<FBounds> InBounds, TConstArrayView<FOrientation> InOrientations)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExMath::OBB::FPackedCollection::Build);
+
+		Reset();
+
+		const int32 NumBoxes = InBounds.Num();
+		if (!NumBoxes || InOrientations.Num() != NumBoxes) { return; }
+
+		TArray<FVector> Origins;
+		Origins.SetNumUninitialized(NumBoxes);
+
+		FBox OriginBounds(ForceInit);
+		for (int32 i = 0; i < NumBoxes; i++)
+		{
+			Origins[i] = InBounds[i].Origin;
+			OriginBounds += Origins[i];
+		}
+
+		Pivot = OriginBounds.GetCenter();
+
+		// Spatially coherent packets keep their bounds tight
+		TArray<int32> Order;
+		PCGExSorting::ComputeSpatialOrder(Origins, Order, EPCGExSpaceFillingCurve::Hilbert);
+
+		NumPackets = FMath::DivideAndRoundUp(NumBoxes, Width);
+
+		Rows.SetNumZeroed(NumPackets * NumRows * Width);
+		Items.Init(-1, NumPackets * Width);
+
+		TArray<FBox> PacketBounds;
+		PacketBounds.Init(FBox(ForceInit), NumPackets);
+
+		ParallelFor(NumPackets, [&](const int32 Packet)
+		{
+			float* PacketRows = Rows.GetData() + Packet * NumRows * Width;
+
+			for (int32 Lane = 0; Lane < Width; Lane++)
+			{
+				const int32 Slot = Packet * Width + Lane;
+				if (Slot >= NumBoxes) { break; }
+
+				const int32 Index = Order[Slot];
+				Items[Slot] = Index;
+
+				const FBounds& B = InBounds[Index];
+				const FOrientation& O = InOrientations[Index];
+				const FVector Axes[3] = {O.GetAxisX(), O.GetAxisY(), O.GetAxisZ()};
+				const FVector Center = B.Origin - Pivot;
+
+				auto Set = [&](const int32 Row, const double Value) { PacketRows[Row * Width + Lane] = static_cast<float>(Value); };
+
+				for (int32 c = 0; c < 3; c++)
+				{
+					Set(Packed::CX + c, Center[c]);
+					Set(Packed::XX + c, Axes[0][c]);
+					Set(Packed::YX + c, Axes[1][c]);
+					Set(Packed::ZX + c, Axes[2][c]);
+					Set(Packed::EX + c, B.Extents[c]);
+				}
+
+				const FVector Extent = Axes[0].GetAbs() * B.Extents.X + Axes[1].GetAbs() * B.Extents.Y + Axes[2].GetAbs() * B.Extents.Z;
+				PacketBounds[Packet] += FBox(B.Origin - Extent, B.Origin + Extent);
+			}
+		});
+
+		// Bottom-up BVH over consecutive packets, the curve order makes siblings spatial neighbors
+
+		const int32 NumLeaves = FMath::DivideAndRoundUp(NumPackets, Packed::LeafPackets);
+		Nodes.Reserve(NumLeaves * 2);
+
+		TArray<int32> Level;
+		Level.Reserve(NumLeaves);
+
+		for (int32 i = 0; i < NumLeaves; i++)
+		{
+			FNode& Leaf = Nodes.Emplace_GetRef();
+			Leaf.FirstPacket = i * Packed::LeafPackets;
+			Leaf.NumPackets = FMath::Min(Packed::LeafPackets, NumPackets - Leaf.FirstPacket);
+			for (int32 p = Leaf.FirstPacket; p < Leaf.FirstPacket + Leaf.NumPackets; p++) { Leaf.Bounds += PacketBounds[p]; }
+			Level.Add(i);
+		}
+
+		TArray<int32> NextLevel;
+		while (Level.Num() > 1)
+		{
+			NextLevel.Reset();
+			for (int32 i = 0; i < Level.Num(); i += 2)
+			{
+				if (i + 1 == Level.Num())
+				{
+					// Odd one out is carried over to the next level as-is
+					NextLevel.Add(Level[i]);
+					continue;
+				}
+
+				const int32 NodeIndex = Nodes.Num();
+				FNode& Node = Nodes.Emplace_GetRef();
+				Node.Left = Level[i];
+				Node.Right = Level[i + 1];
+				Node.Bounds = Nodes[Node.Left].Bounds + Nodes[Node.Right].Bounds;
+				NextLevel.Add(NodeIndex);
+			}
+
+			Swap(Level, NextLevel);
+		}
+
+		// A carried-over node may end up as the root without being last
+		if (Level[0] != Nodes.Num() - 1)
+		{
+			FNode& Root = Nodes.Emplace_GetRef();
+			Root.Left = Level[0];
+			Root.Bounds = Nodes[Level[0]].Bounds;
+		}
+	}
+
+	void FPackedCollection::Reset()
+	{
+		Pivot = FVector::ZeroVector;
+		NumPackets = 0;
+		Rows.Reset();
+		Items.Reset();
+		Nodes.Reset();
+	}
+
+	FPackedCollection::FQuery FPackedCollection::MakeQuery(const FOBB& InQuery, const float Expansion) const
+	{
+		FQuery Query;
+
+		const FVector Axes[3] = {InQuery.Orientation.GetAxisX(), InQuery.Orientation.GetAxisY(), InQuery.Orientation.GetAxisZ()};
+		const FVector& Extents = InQuery.Bounds.Extents;
+		const FVector Center = InQuery.Bounds.Origin - Pivot;
+
+		for (int32 i = 0; i < 3; i++)
+		{
+			Query.Origin[i] = static_cast<float>(Center[i]);
+			Query.Extents[i] = static_cast<float>(Extents[i]);
+			for (int32 c = 0; c < 3; c++) { Query.Axes[i][c] = static_cast<float>(Axes[i][c]); }
+		}
+
+		// Packed boxes are expanded, not the query; grow its bounds by the worst-case growth of an expanded box's AABB
+		const FVector Extent = Axes[0].GetAbs() * Extents.X + Axes[1].GetAbs() * Extents.Y + Axes[2].GetAbs() * Extents.Z + FVector(FMath::Max(0.0f, Expansion) * UE_DOUBLE_SQRT_3);
+		Query.Bounds = FBox(InQuery.Bounds.Origin - Extent, InQuery.Bounds.Origin + Extent);
+
+		return Query;
+	}
+
+	uint32 FPackedCollection::TestPacket(const FQuery& Query, const int32 Packet, const float Expansion) const
+	{
+		// Same separating axes & epsilon as SATOverlap, query is A, packet lanes are B
+
+		const float* PacketRows = Rows.GetData() + Packet * NumRows * Width;
+		auto Load = [&](const int32 Row) { return VectorLoadAligned(PacketRows + Row * Width); };
+
+		const VectorRegister4Float Epsilon = VectorSetFloat1(KINDA_SMALL_NUMBER);
+		const VectorRegister4Float Expand = VectorSetFloat1(Expansion);
+
+		const VectorRegister4Float D[3] = {
+			VectorSubtract(Load(Packed::CX), VectorSetFloat1(Query.Origin[0])),
+			VectorSubtract(Load(Packed::CY), VectorSetFloat1(Query.Origin[1])),
+			VectorSubtract(Load(Packed::CZ), VectorSetFloat1(Query.Origin[2]))
+		};
+
+		const VectorRegister4Float EB[3] = {
+			VectorAdd(Load(Packed::EX), Expand),
+			VectorAdd(Load(Packed::EY), Expand),
+			VectorAdd(Load(Packed::EZ), Expand)
+		};
+
+		VectorRegister4Float AxesB[3][3];
+		for (int32 k = 0; k < 3; k++) { for (int32 c = 0; c < 3; c++) { AxesB[k][c] = Load(Packed::XX + k * 3 + c); } }
+
+		auto Dot = [](const float* A, const VectorRegister4Float* B)
+		{
+			return VectorMultiplyAdd(VectorSetFloat1(A[0]), B[0], VectorMultiplyAdd(VectorSetFloat1(A[1]), B[1], VectorMultiply(VectorSetFloat1(A[2]), B[2])));
+		};
+
+		VectorRegister4Float R[3][3];
+		VectorRegister4Float AbsR[3][3];
+		for (int32 i = 0; i < 3; i++)
+		{
+			for (int32 k = 0; k < 3; k++)
+			{
+				R[i][k] = Dot(Query.Axes[i], AxesB[k]);
+				AbsR[i][k] = VectorAdd(VectorAbs(R[i][k]), Epsilon);
+			}
+		}
+
+		VectorRegister4Float Separated = VectorZeroFloat();
+		auto Separate = [&](const VectorRegister4Float& Distance, const VectorRegister4Float& Radius)
+		{
+			Separated = VectorBitwiseOr(Separated, VectorCompareGT(VectorAbs(Distance), Radius));
+		};
+
+		// A's axes
+		VectorRegister4Float TA[3];
+		for (int32 i = 0; i < 3; i++)
+		{
+			TA[i] = Dot(Query.Axes[i], D);
+			const VectorRegister4Float rb = VectorMultiplyAdd(EB[0], AbsR[i][0], VectorMultiplyAdd(EB[1], AbsR[i][1], VectorMultiply(EB[2], AbsR[i][2])));
+			Separate(TA[i], VectorAdd(VectorSetFloat1(Query.Extents[i]), rb));
+		}
+
+		// B's axes
+		for (int32 k = 0; k < 3; k++)
+		{
+			const VectorRegister4Float TB = VectorMultiplyAdd(D[0], AxesB[k][0], VectorMultiplyAdd(D[1], AxesB[k][1], VectorMultiply(D[2], AxesB[k][2])));
+			const VectorRegister4Float ra = VectorMultiplyAdd(
+				VectorSetFloat1(Query.Extents[0]), AbsR[0][k], VectorMultiplyAdd(
+					VectorSetFloat1(Query.Extents[1]), AbsR[1][k], VectorMultiply(
+						VectorSetFloat1(Query.Extents[2]), AbsR[2][k])));
+			Separate(TB, VectorAdd(ra, EB[k]));
+		}
+
+		if (VectorMaskBits(Separated) == 0xF) { return 0; }
+
+		// Cross products, Ai x Bk
+		for (int32 i = 0; i < 3; i++)
+		{
+			const int32 i1 = (i + 1) % 3;
+			const int32 i2 = (i + 2) % 3;
+
+			for (int32 k = 0; k < 3; k++)
+			{
+				const int32 k1 = (k + 1) % 3;
+				const int32 k2 = (k + 2) % 3;
+
+				const VectorRegister4Float ra = VectorMultiplyAdd(VectorSetFloat1(Query.Extents[i1]), AbsR[i2][k], VectorMultiply(VectorSetFloat1(Query.Extents[i2]), AbsR[i1][k]));
+				const VectorRegister4Float rb = VectorMultiplyAdd(EB[k1], AbsR[i][k2], VectorMultiply(EB[k2], AbsR[i][k1]));
+				const VectorRegister4Float T = VectorSubtract(VectorMultiply(TA[i2], R[i1][k]), VectorMultiply(TA[i1], R[i2][k]));
+				Separate(T, VectorAdd(ra, rb));
+			}
+		}
+
+		return ~static_cast<uint32>(VectorMaskBits(Separated)) & 0xF;
+	}
+}
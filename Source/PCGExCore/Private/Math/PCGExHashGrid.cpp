@@ -0,0 +1,220 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Math/PCGExHashGrid.h"
+
+#include "Async/ParallelFor.h"
+#include "Sorting/PCGExSortingHelpers.h"
+
+namespace PCGExSpatial
+{
+	namespace HashGrid
+	{
+		constexpr int32 MinParallelItems = 4096;
+		constexpr int32 CellsPerTask = 256;
+	}
+
+	void FHashGrid::Build(TConstArrayView<FVector> InPositions, const double InCellSize)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSpatial::FHashGrid::Build);
+
+		const int32 NumPositions = InPositions.Num();
+		const bool bForceSingleThread = NumPositions < HashGrid::MinParallelItems;
+
+		Positions.SetNumUninitialized(NumPositions);
+		Indices.SetNumUninitialized(NumPositions);
+		CellKeys.Reset();
+		CellStarts.Reset();
+		Table.Reset();
+		MinCell = FIntVector(0);
+		MaxCell = FIntVector(-1);
+
+		if (!NumPositions) { return; }
+
+		// Center cells on the positions' bounds, and grow cells if needed so they all fit in the key range
+
+		const int32 NumBoundsChunks = FMath::DivideAndRoundUp(NumPositions, HashGrid::MinParallelItems);
+		TArray<FBox> ChunkBounds;
+		ChunkBounds.Init(FBox(ForceInit), NumBoundsChunks);
+
+		ParallelFor(NumBoundsChunks, [&](const int32 Chunk)
+		{
+			const int32 End = FMath::Min(NumPositions, (Chunk + 1) * HashGrid::MinParallelItems);
+			for (int32 i = Chunk * HashGrid::MinParallelItems; i < End; i++) { ChunkBounds[Chunk] += InPositions[i]; }
+		}, bForceSingleThread);
+
+		FBox Bounds(ForceInit);
+		for (const FBox& Box : ChunkBounds) { Bounds += Box; }
+
+		Origin = Bounds.GetCenter();
+		CellSize = FMath::Max3(InCellSize, UE_KINDA_SMALL_NUMBER, Bounds.GetExtent().GetMax() / (CellBias - 1));
+		InvCellSize = 1 / CellSize;
+
+		// Sort positions by cell, so each cell maps to a contiguous range
+
+		TArray<PCGEx::FIndexKey> Keys;
+		Keys.SetNumUninitialized(NumPositions);
+		ParallelFor(NumPositions, [&](const int32 i) { Keys[i] = PCGEx::FIndexKey(i, PackCell(GetCell(InPositions[i]))); }, bForceSingleThread);
+
+		PCGExSortingHelpers::ParallelRadixSort(Keys);
+
+		ParallelFor(NumPositions, [&](const int32 i)
+		{
+			Indices[i] = Keys[i].Index;
+			Positions[i] = InPositions[Keys[i].Index];
+		}, bForceSingleThread);
+
+		// Occupied cells & their bounds
+
+		CellKeys.Reserve(NumPositions / 2);
+		CellStarts.Reserve(NumPositions / 2 + 1);
+
+		MinCell = FIntVector(MAX_int32);
+		MaxCell = FIntVector(MIN_int32);
+
+		for (int32 i = 0; i < NumPositions; i++)
+		{
+			if (i > 0 && Keys[i].Key == Keys[i - 1].Key) { continue; }
+
+			CellKeys.Add(Keys[i].Key);
+			CellStarts.Add(i);
+
+			const FIntVector Cell = GetCell(Positions[i]);
+			MinCell = FIntVector(FMath::Min(MinCell.X, Cell.X), FMath::Min(MinCell.Y, Cell.Y), FMath::Min(MinCell.Z, Cell.Z));
+			MaxCell = FIntVector(FMath::Max(MaxCell.X, Cell.X), FMath::Max(MaxCell.Y, Cell.Y), FMath::Max(MaxCell.Z, Cell.Z));
+		}
+
+		CellStarts.Add(NumPositions);
+
+		// Open-addressing lookup, kept at most half full
+
+		const int32 NumCells = CellKeys.Num();
+		const int32 TableSize = FMath::RoundUpToPowerOfTwo(FMath::Max(2, NumCells * 2));
+		TableMask = TableSize - 1;
+		Table.Init(-1, TableSize);
+
+		for (int32 Cell = 0; Cell < NumCells; Cell++)
+		{
+			uint32 Slot = HashCell(CellKeys[Cell]) & TableMask;
+			while (Table[Slot] != -1) { Slot = (Slot + 1) & TableMask; }
+			Table[Slot] = Cell;
+		}
+	}
+
+	void FHashGrid::Build(TConstArrayView<FTransform> InTransforms, const double InCellSize)
+	{
+		TArray<FVector> Locations;
+		Locations.SetNumUninitialized(InTransforms.Num());
+		ParallelFor(InTransforms.Num(), [&](const int32 i) { Locations[i] = InTransforms[i].GetLocation(); }, InTransforms.Num() < HashGrid::MinParallelItems);
+		Build(Locations, InCellSize);
+	}
+
+	int32 FHashGrid::FindNearest(const FVector& InCenter, const double InMaxRadius, const int32 InIgnoreIndex) const
+	{
+		TArray<int32> Nearest;
+		FindKNearest(InCenter, 1, Nearest, InMaxRadius, InIgnoreIndex);
+		return Nearest.IsEmpty() ? -1 : Nearest[0];
+	}
+
+	void FHashGrid::FindKNearest(const FVector& InCenter, const int32 K, TArray<int32>& OutIndices, const double InMaxRadius, const int32 InIgnoreIndex) const
+	{
+		OutIndices.Reset();
+		if (K <= 0 || IsEmpty()) { return; }
+
+		const double MaxRadiusSquared = InMaxRadius >= MAX_dbl ? MAX_dbl : InMaxRadius * InMaxRadius;
+
+		// Candidates sorted by (distance, index), worst last
+		TArray<TPair<double, int32>, TInlineAllocator<32>> Best;
+
+		auto Insert = [&](const double DistSquared, const int32 Index)
+		{
+			if (Best.Num() == K && !(TPair<double, int32>(DistSquared, Index) < Best.Last())) { return; }
+			if (Best.Num() == K) { Best.Pop(EAllowShrinking::No); }
+
+			int32 At = Best.Num();
+			while (At > 0 && TPair<double, int32>(DistSquared, Index) < Best[At - 1]) { At--; }
+			Best.Insert(TPair<double, int32>(DistSquared, Index), At);
+		};
+
+		// Search rings of cells outward; anything beyond ring R is at least R cells away
+
+		const FIntVector Center = GetCell(InCenter);
+		const int32 MaxRing = FMath::Max3(
+			FMath::Max(FMath::Abs(Center.X - MinCell.X), FMath::Abs(MaxCell.X - Center.X)),
+			FMath::Max(FMath::Abs(Center.Y - MinCell.Y), FMath::Abs(MaxCell.Y - Center.Y)),
+			FMath::Max(FMath::Abs(Center.Z - MinCell.Z), FMath::Abs(MaxCell.Z - Center.Z)));
+
+		for (int32 Ring = 0; Ring <= MaxRing; Ring++)
+		{
+			if (Ring > 1 && FMath::Square((Ring - 1) * CellSize) > MaxRadiusSquared) { break; }
+
+			for (int32 X = FMath::Max(Center.X - Ring, MinCell.X); X <= FMath::Min(Center.X + Ring, MaxCell.X); X++)
+			{
+				for (int32 Y = FMath::Max(Center.Y - Ring, MinCell.Y); Y <= FMath::Min(Center.Y + Ring, MaxCell.Y); Y++)
+				{
+					for (int32 Z = FMath::Max(Center.Z - Ring, MinCell.Z); Z <= FMath::Min(Center.Z + Ring, MaxCell.Z); Z++)
+					{
+						// Ring shell only, inner cells were visited already
+						if (FMath::Max3(FMath::Abs(X - Center.X), FMath::Abs(Y - Center.Y), FMath::Abs(Z - Center.Z)) != Ring) { continue; }
+
+						const int32 Cell = FindCell(FIntVector(X, Y, Z));
+						if (Cell == -1) { continue; }
+
+						for (int32 i = CellStarts[Cell]; i < CellStarts[Cell + 1]; i++)
+						{
+							if (Indices[i] == InIgnoreIndex) { continue; }
+
+							const double DistSquared = FVector::DistSquared(InCenter, Positions[i]);
+							if (DistSquared <= MaxRadiusSquared) { Insert(DistSquared, Indices[i]); }
+						}
+					}
+				}
+			}
+
+			if (Best.Num() == K && Best.Last().Key < FMath::Square(Ring * CellSize)) { break; }
+		}
+
+		OutIndices.Reserve(Best.Num());
+		for (const TPair<double, int32>& Entry : Best) { OutIndices.Add(Entry.Value); }
+	}
+
+	void FHashGrid::FindPairsInRadius(const double InRadius, TArray<FInt32Point>& OutPairs) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSpatial::FHashGrid::FindPairsInRadius);
+
+		OutPairs.Reset();
+
+		const int32 NumCells = CellKeys.Num();
+		const int32 NumChunks = FMath::DivideAndRoundUp(NumCells, HashGrid::CellsPerTask);
+
+		TArray<TArray<FInt32Point>> ChunkPairs;
+		ChunkPairs.SetNum(NumChunks);
+
+		ParallelFor(NumChunks, [&](const int32 Chunk)
+		{
+			const int32 End = FMath::Min(NumCells, (Chunk + 1) * HashGrid::CellsPerTask);
+			for (int32 Cell = Chunk * HashGrid::CellsPerTask; Cell < End; Cell++)
+			{
+				ForEachPairInCell(Cell, InRadius, [&](const int32 A, const int32 B, const double) { ChunkPairs[Chunk].Emplace(A, B); });
+			}
+		}, Num() < HashGrid::MinParallelItems);
+
+		int32 NumPairs = 0;
+		for (const TArray<FInt32Point>& Pairs : ChunkPairs) { NumPairs += Pairs.Num(); }
+
+		OutPairs.Reserve(NumPairs);
+		for (const TArray<FInt32Point>& Pairs : ChunkPairs) { OutPairs.Append(Pairs); }
+	}
+
+	void FHashGrid::ParallelForCells(TFunctionRef<void(int32)> Func) const
+	{
+		const int32 NumCells = CellKeys.Num();
+		const int32 NumChunks = FMath::DivideAndRoundUp(NumCells, HashGrid::CellsPerTask);
+
+		ParallelFor(NumChunks, [&](const int32 Chunk)
+		{
+			const int32 End = FMath::Min(NumCells, (Chunk + 1) * HashGrid::CellsPerTask);
+			for (int32 Cell = Chunk * HashGrid::CellsPerTask; Cell < End; Cell++) { Func(Cell); }
+		}, Num() < HashGrid::MinParallelItems);
+	}
+}
@@ -0,0 +1,166 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Math/PCGExSweepAndPrune.h"
+
+#include "Async/ParallelFor.h"
+#include "Sorting/PCGExSortingHelpers.h"
+
+namespace PCGExMath::SweepAndPrune
+{
+	namespace Sweep
+	{
+		constexpr int32 ChunkSize = 1024;
+
+		struct FItem
+		{
+			double Min = 0;
+			double Max = 0;
+			int32 Index = -1;
+		};
+
+		static int32 GetDominantAxis(TConstArrayView<FBox> InA, TConstArrayView<FBox> InB)
+		{
+			FBox Centers(ForceInit);
+			for (const FBox& Box : InA) { if (Box.IsValid) { Centers += Box.GetCenter(); } }
+			for (const FBox& Box : InB) { if (Box.IsValid) { Centers += Box.GetCenter(); } }
+
+			const FVector Size = Centers.GetSize();
+			return Size.X >= Size.Y && Size.X >= Size.Z ? 0 : Size.Y >= Size.Z ? 1 : 2;
+		}
+
+		// Valid boxes projected on the axis, sorted by interval start
+		static void Project(TConstArrayView<FBox> InBoxes, const int32 Axis, TArray<FItem>& OutItems)
+		{
+			TArray<PCGEx::FIndexKey> Keys;
+			Keys.Reserve(InBoxes.Num());
+
+			for (int32 i = 0; i < InBoxes.Num(); i++)
+			{
+				if (InBoxes[i].IsValid) { Keys.Emplace(i, PCGExSortingHelpers::ToSortableKey(InBoxes[i].Min[Axis])); }
+			}
+
+			PCGExSortingHelpers::ParallelRadixSort(Keys);
+
+			OutItems.SetNumUninitialized(Keys.Num());
+			ParallelFor(Keys.Num(), [&](const int32 i)
+			{
+				const FBox& Box = InBoxes[Keys[i].Index];
+				OutItems[i] = FItem{Box.Min[Axis], Box.Max[Axis], Keys[i].Index};
+			}, Keys.Num() < ChunkSize);
+		}
+
+		// First item whose Min is >= (or > if bStrict) Value
+		static int32 LowerBound(const TArray<FItem>& Items, const double Value, const bool bStrict)
+		{
+			int32 Lo = 0;
+			int32 Hi = Items.Num();
+			while (Lo < Hi)
+			{
+				const int32 Mid = (Lo + Hi) / 2;
+				if (bStrict ? Items[Mid].Min <= Value : Items[Mid].Min < Value) { Lo = Mid + 1; }
+				else { Hi = Mid; }
+			}
+			return Lo;
+		}
+
+		// Runs Func(ItemIndex, OutChunkPairs) over chunks of items in parallel, then concatenates chunk results in order
+		template <typename FSweepFunc>
+		static void SweepChunks(const int32 NumItems, TArray<FInt32Point>& OutPairs, FSweepFunc&& Func)
+		{
+			if (!NumItems) { return; }
+
+			const int32 NumChunks = FMath::DivideAndRoundUp(NumItems, ChunkSize);
+
+			TArray<TArray<FInt32Point>> ChunkPairs;
+			ChunkPairs.SetNum(NumChunks);
+
+			ParallelFor(NumChunks, [&](const int32 Chunk)
+			{
+				const int32 End = FMath::Min(NumItems, (Chunk + 1) * ChunkSize);
+				for (int32 i = Chunk * ChunkSize; i < End; i++) { Func(i, ChunkPairs[Chunk]); }
+			});
+
+			int32 NumPairs = OutPairs.Num();
+			for (const TArray<FInt32Point>& Pairs : ChunkPairs) { NumPairs += Pairs.Num(); }
+
+			OutPairs.Reserve(NumPairs);
+			for (const TArray<FInt32Point>& Pairs : ChunkPairs) { OutPairs.Append(Pairs); }
+		}
+	}
+
+	void FindOverlaps(TConstArrayView<FBox> InA, TConstArrayView<FBox> InB, TArray<FInt32Point>& OutPairs)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExMath::SweepAndPrune::FindOverlaps);
+
+		OutPairs.Reset();
+		if (InA.IsEmpty() || InB.IsEmpty()) { return; }
+
+		const int32 Axis = Sweep::GetDominantAxis(InA, InB);
+
+		TArray<Sweep::FItem> A;
+		TArray<Sweep::FItem> B;
+		Sweep::Project(InA, Axis, A);
+		Sweep::Project(InB, Axis, B);
+
+		// Each pair is found from the side whose interval starts first; A wins ties
+
+		Sweep::SweepChunks(A.Num(), OutPairs, [&](const int32 i, TArray<FInt32Point>& OutChunkPairs)
+		{
+			const Sweep::FItem& Item = A[i];
+			const FBox& Box = InA[Item.Index];
+
+			for (int32 j = Sweep::LowerBound(B, Item.Min, false); j < B.Num() && B[j].Min <= Item.Max; j++)
+			{
+				if (Box.Intersect(InB[B[j].Index])) { OutChunkPairs.Emplace(Item.Index, B[j].Index); }
+			}
+		});
+
+		Sweep::SweepChunks(B.Num(), OutPairs, [&](const int32 i, TArray<FInt32Point>& OutChunkPairs)
+		{
+			const Sweep::FItem& Item = B[i];
+			const FBox& Box = InB[Item.Index];
+
+			for (int32 j = Sweep::LowerBound(A, Item.Min, true); j < A.Num() && A[j].Min <= Item.Max; j++)
+			{
+				if (Box.Intersect(InA[A[j].Index])) { OutChunkPairs.Emplace(A[j].Index, Item.Index); }
+			}
+		});
+	}
+
+	void FindOverlaps(TConstArrayView<FBox> InBoxes, TArray<FInt32Point>& OutPairs)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExMath::SweepAndPrune::FindOverlapsSelf);
+
+		OutPairs.Reset();
+		if (InBoxes.Num() < 2) { return; }
+
+		const int32 Axis = Sweep::GetDominantAxis(InBoxes, {});
+
+		TArray<Sweep::FItem> Items;
+		Sweep::Project(InBoxes, Axis, Items);
+
+		Sweep::SweepChunks(Items.Num(), OutPairs, [&](const int32 i, TArray<FInt32Point>& OutChunkPairs)
+		{
+			const Sweep::FItem& Item = Items[i];
+			const FBox& Box = InBoxes[Item.Index];
+
+			for (int32 j = i + 1; j < Items.Num() && Items[j].Min <= Item.Max; j++)
+			{
+				if (!Box.Intersect(InBoxes[Items[j].Index])) { continue; }
+				OutChunkPairs.Emplace(FMath::Min(Item.Index, Items[j].Index), FMath::Max(Item.Index, Items[j].Index));
+			}
+		});
+	}
+
+	void GroupPairs(TConstArrayView<FInt32Point> InPairs, const int32 NumItems, TArray<int32>& OutOffsets, TArray<int32>& OutAdjacency)
+	{
+		OutOffsets.Init(0, NumItems + 1);
+		for (const FInt32Point& Pair : InPairs) { OutOffsets[Pair.X + 1]++; }
+		for (int32 i = 0; i < NumItems; i++) { OutOffsets[i + 1] += OutOffsets[i]; }
+
+		TArray<int32> Cursors(OutOffsets.GetData(), NumItems);
+		OutAdjacency.SetNumUninitialized(InPairs.Num());
+		for (const FInt32Point& Pair : InPairs) { OutAdjacency[Cursors[Pair.X]++] = Pair.Y; }
+	}
+}
@@ -3,6 +3,11 @@
 
 #include "PCGExSubSystem.h"
 
+#include "PCGExSettingsCacheBody.h"
+#include "PCGExCoreSettingsCache.h"
+#include "Clusters/PCGExCluster.h"
+#include "Clusters/PCGExClusterSnapshot.h"
+
 #if WITH_EDITOR
 #include "Editor.h"
 #include "ObjectTools.h"
@@ -19,10 +24,14 @@ UPCGExSubSystem::UPCGExSubSystem()
 void UPCGExSubSystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+
+	// Snapshots from previous sessions may exceed the current budget
+	if (PCGEX_CORE_SETTINGS.bClusterSnapshots) { PCGExClusters::Snapshot::PruneAsync(); }
 }
 
 void UPCGExSubSystem::Deinitialize()
 {
+	FlushClusterCache();
 	Super::Deinitialize();
 }
 
@@ -123,6 +132,98 @@ TArrayView<const int32> UPCGExSubSystem::GetIndexRange(const int32 Start, const
 	return TArrayView<const int32>(IndexBuffer.GetData() + Start, Count);
 }
 
+// Persistent cluster cache, survives across executions for as long as the world does.
+// Entries are keyed by a 128-bit content hash; data keys (vtx/edges UIDs) are aliases so unchanged
+// inputs skip hashing entirely. Least recently used entries are dropped once over budget.
+TSharedPtr<PCGExClusters::FCluster> UPCGExSubSystem::FindCachedClusterByData(const PCGExClusters::FClusterDataKey& InDataKey, PCGExClusters::FClusterContentKey* OutContentKey)
+{
+	FWriteScopeLock WriteScopeLock(ClusterCacheLock);
+
+	const PCGExClusters::FClusterContentKey* ContentKey = CachedClusterAliases.Find(InDataKey);
+	if (!ContentKey) { return nullptr; }
+
+	FCachedCluster* Entry = CachedClusters.Find(*ContentKey);
+	if (!Entry) { return nullptr; }
+
+	Entry->LastAccess = ++ClusterCacheClock;
+	if (OutContentKey) { *OutContentKey = *ContentKey; }
+	return Entry->Cluster;
+}
+
+TSharedPtr<PCGExClusters::FCluster> UPCGExSubSystem::FindCachedClusterByContent(const PCGExClusters::FClusterDataKey& InDataKey, const PCGExClusters::FClusterContentKey& InContentKey)
+{
+	FWriteScopeLock WriteScopeLock(ClusterCacheLock);
+
+	FCachedCluster* Entry = CachedClusters.Find(InContentKey);
+	if (!Entry) { return nullptr; }
+
+	Entry->LastAccess = ++ClusterCacheClock;
+	Entry->DataKeys.AddUnique(InDataKey);
+	CachedClusterAliases.Add(InDataKey, InContentKey);
+
+	return Entry->Cluster;
+}
+
+void UPCGExSubSystem::CacheCluster(const PCGExClusters::FClusterDataKey& InDataKey, const PCGExClusters::FClusterContentKey& InContentKey, const TSharedPtr<PCGExClusters::FCluster>& InCluster)
+{
+	if (!InCluster) { return; }
+
+	const SIZE_T Budget = static_cast<SIZE_T>(PCGEX_CORE_SETTINGS.PersistentClusterCacheBudget) * 1024 * 1024;
+	const SIZE_T Size = InCluster->GetAllocatedSize();
+
+	if (Size > Budget) { return; }
+
+	FWriteScopeLock WriteScopeLock(ClusterCacheLock);
+
+	RemoveCachedCluster_Unsafe(InContentKey);
+	TrimClusterCache_Unsafe(Budget - Size);
+
+	FCachedCluster& Entry = CachedClusters.Add(InContentKey);
+	Entry.Cluster = InCluster;
+	Entry.DataKeys.Add(InDataKey);
+	Entry.Size = Size;
+	Entry.LastAccess = ++ClusterCacheClock;
+
+	CachedClusterAliases.Add(InDataKey, InContentKey);
+	CachedClustersSize += Size;
+}
+
+void UPCGExSubSystem::FlushClusterCache()
+{
+	FWriteScopeLock WriteScopeLock(ClusterCacheLock);
+	CachedClusters.Empty();
+	CachedClusterAliases.Empty();
+	CachedClustersSize = 0;
+}
+
+void UPCGExSubSystem::TrimClusterCache_Unsafe(const SIZE_T InBudget)
+{
+	while (CachedClustersSize > InBudget && !CachedClusters.IsEmpty())
+	{
+		// Entry count stays low (one per distinct cluster), a linear scan beats maintaining a list
+		PCGExClusters::FClusterContentKey OldestKey;
+		uint64 OldestAccess = MAX_uint64;
+
+		for (const TPair<PCGExClusters::FClusterContentKey, FCachedCluster>& Pair : CachedClusters)
+		{
+			if (Pair.Value.LastAccess >= OldestAccess) { continue; }
+			OldestAccess = Pair.Value.LastAccess;
+			OldestKey = Pair.Key;
+		}
+
+		RemoveCachedCluster_Unsafe(OldestKey);
+	}
+}
+
+void UPCGExSubSystem::RemoveCachedCluster_Unsafe(const PCGExClusters::FClusterContentKey& InContentKey)
+{
+	FCachedCluster Removed;
+	if (!CachedClusters.RemoveAndCopyValue(InContentKey, Removed)) { return; }
+
+	for (const PCGExClusters::FClusterDataKey& DataKey : Removed.DataKeys) { CachedClusterAliases.Remove(DataKey); }
+	CachedClustersSize -= Removed.Size;
+}
+
 double UPCGExSubSystem::GetTickBudgetInSeconds()
 {
 	float Val = 5000.0;
@@ -4,6 +4,9 @@
 #include "Paths/PCGExPath.h"
 
 #include "GeomTools.h"
+#include "PCGExCoreSettingsCache.h"
+#include "Async/ParallelFor.h"
+#include "Core/PCGExMTCommon.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointIO.h"
 #include "Math/PCGExMathAxis.h"
@@ -48,6 +51,34 @@ namespace PCGExPaths
 		return Start == Other->Start || Start == Other->End || End == Other->Start || End == Other->End;
 	}
 
+	int32 GetNumSegments(const int32 NumItems, const int32 Stencil)
+	{
+		if (NumItems <= 0) { return 0; }
+		const int32 SegmentSize = FMath::Max(PCGEX_CORE_SETTINGS.PathSegmentSize, Stencil * 4);
+		return FMath::DivideAndRoundUp(NumItems, SegmentSize);
+	}
+
+	void ForEachSegment(const int32 NumItems, const int32 Stencil, const TFunctionRef<void(const PCGExMT::FScope&)>& Func)
+	{
+		const int32 NumSegments = GetNumSegments(NumItems, Stencil);
+		if (!NumSegments) { return; }
+
+		if (NumSegments == 1)
+		{
+			Func(PCGExMT::FScope(0, NumItems, 0));
+			return;
+		}
+
+		// Even split, so the last segment isn't a leftover sliver
+		const int32 SegmentSize = FMath::DivideAndRoundUp(NumItems, NumSegments);
+		ParallelFor(NumSegments, [&](const int32 SegmentIndex)
+		{
+			const int32 Start = SegmentIndex * SegmentSize;
+			const int32 Count = FMath::Min(SegmentSize, NumItems - Start);
+			if (Count > 0) { Func(PCGExMT::FScope(Start, Count, SegmentIndex)); }
+		});
+	}
+
 	void IPathEdgeExtra::ProcessingDone(const FPath* Path)
 	{
 	}
@@ -211,6 +242,60 @@ namespace PCGExPaths
 		PCGExMath::CheckConvex(Positions[A].GetLocation(), Positions[Index].GetLocation(), Positions[B].GetLocation(), bIsConvex, ConvexitySign);
 	}
 
+	void FPath::ComputeConvexity()
+	{
+		if (!bIsConvex) { return; }
+
+		struct FSegmentConvexity
+		{
+			bool bIsConvex = true;
+			int32 Sign = 0;
+		};
+
+		// Each segment tracks its own first sign, then segments are folded in order
+		// exactly like the sequential test would have observed them.
+		TArray<FSegmentConvexity> Segments;
+		Segments.SetNum(GetNumSegments(NumPoints, 1));
+
+		ForEachSegment(NumPoints, 1, [&](const PCGExMT::FScope& Scope)
+		{
+			FSegmentConvexity& Segment = Segments[Scope.LoopIndex];
+			PCGEX_SCOPE_LOOP(Index)
+			{
+				if (!Segment.bIsConvex) { return; }
+
+				const int32 A = SafePointIndex(Index - 1);
+				const int32 B = SafePointIndex(Index + 1);
+				if (A == B)
+				{
+					Segment.bIsConvex = false;
+					return;
+				}
+
+				PCGExMath::CheckConvex(Positions[A].GetLocation(), Positions[Index].GetLocation(), Positions[B].GetLocation(), Segment.bIsConvex, Segment.Sign);
+			}
+		});
+
+		for (const FSegmentConvexity& Segment : Segments)
+		{
+			if (Segment.Sign != 0)
+			{
+				if (ConvexitySign == 0) { ConvexitySign = Segment.Sign; }
+				else if (ConvexitySign != Segment.Sign)
+				{
+					bIsConvex = false;
+					return;
+				}
+			}
+
+			if (!Segment.bIsConvex)
+			{
+				bIsConvex = false;
+				return;
+			}
+		}
+	}
+
 	void FPath::ComputeEdgeExtra(const int32 Index)
 	{
 		if (NumEdges == 1)
@@ -233,18 +318,41 @@ namespace PCGExPaths
 
 	void FPath::ComputeAllEdgeExtra()
 	{
+		ProcessAllEdges(Extras, true);
+		ExtraComputingDone();
+	}
+
+	void FPath::ProcessAllEdges(TConstArrayView<TSharedPtr<IPathEdgeExtra>> InExtras, const bool bProcessEnds) const
+	{
+		if (InExtras.IsEmpty() || NumEdges <= 0) { return; }
+
 		if (NumEdges == 1)
 		{
-			for (const TSharedPtr<IPathEdgeExtra>& Extra : Extras) { Extra->ProcessSingleEdge(this, Edges[0]); }
+			for (const TSharedPtr<IPathEdgeExtra>& Extra : InExtras) { Extra->ProcessSingleEdge(this, Edges[0]); }
+			return;
 		}
-		else
+
+		bool bSegmented = true;
+		for (const TSharedPtr<IPathEdgeExtra>& Extra : InExtras) { bSegmented &= Extra->SupportsSegments(); }
+
+		const int32 FirstMiddle = bProcessEnds ? 1 : 0;
+		const int32 NumMiddle = (bProcessEnds ? LastEdge : NumEdges) - FirstMiddle;
+
+		auto ProcessMiddle = [&](const PCGExMT::FScope& Scope)
 		{
-			for (const TSharedPtr<IPathEdgeExtra>& Extra : Extras) { Extra->ProcessFirstEdge(this, Edges[0]); }
-			for (int i = 1; i < LastEdge; i++) { for (const TSharedPtr<IPathEdgeExtra>& Extra : Extras) { Extra->ProcessEdge(this, Edges[i]); } }
-			for (const TSharedPtr<IPathEdgeExtra>& Extra : Extras) { Extra->ProcessLastEdge(this, Edges[LastEdge]); }
-		}
+			for (int i = Scope.Start; i < Scope.End; i++)
+			{
+				const FPathEdge& Edge = Edges[FirstMiddle + i];
+				for (const TSharedPtr<IPathEdgeExtra>& Extra : InExtras) { Extra->ProcessEdge(this, Edge); }
+			}
+		};
 
-		ExtraComputingDone();
+		if (bProcessEnds) { for (const TSharedPtr<IPathEdgeExtra>& Extra : InExtras) { Extra->ProcessFirstEdge(this, Edges[0]); } }
+
+		if (bSegmented) { ForEachSegment(NumMiddle, 1, ProcessMiddle); }
+		else if (NumMiddle > 0) { ProcessMiddle(PCGExMT::FScope(0, NumMiddle, 0)); }
+
+		if (bProcessEnds) { for (const TSharedPtr<IPathEdgeExtra>& Extra : InExtras) { Extra->ProcessLastEdge(this, Edges[LastEdge]); } }
 	}
 
 	bool FPath::IsInsideProjection(const FVector& WorldPosition) const
@@ -346,12 +454,23 @@ namespace PCGExPaths
 
 		Edges.SetNumUninitialized(NumEdges);
 
-		for (int i = 0; i < NumEdges; i++)
+		TArray<FBox> SegmentBounds;
+		SegmentBounds.Init(FBox(ForceInit), GetNumSegments(NumEdges, 1));
+
+		ForEachSegment(NumEdges, 1, [&](const PCGExMT::FScope& Scope)
 		{
-			const FPathEdge& E = (Edges[i] = FPathEdge(i, (i + 1) % NumPoints, Positions, Expansion));
-			TotalLength += E.Length;
-			Bounds += E.Bounds.GetBox();
-		}
+			FBox& LocalBounds = SegmentBounds[Scope.LoopIndex];
+			PCGEX_SCOPE_LOOP(i)
+			{
+				const FPathEdge& E = (Edges[i] = FPathEdge(i, (i + 1) % NumPoints, Positions, Expansion));
+				LocalBounds += E.Bounds.GetBox();
+			}
+		});
+
+		for (const FBox& Box : SegmentBounds) { Bounds += Box; }
+
+		// Summed in edge order so the total doesn't depend on how the path was segmented
+		for (const FPathEdge& E : Edges) { TotalLength += E.Length; }
 	}
 
 #pragma region Edge extras
@@ -361,15 +480,19 @@ namespace PCGExPaths
 	void FPathEdgeLength::ProcessEdge(const FPath* Path, const FPathEdge& Edge)
 	{
 		GetMutable(Edge.Start) = Edge.Length;
-		TotalLength += Edge.Length;
 	}
 
 	void FPathEdgeLength::ProcessingDone(const FPath* Path)
 	{
 		TPathEdgeExtra<double>::ProcessingDone(Path);
+		if (Data.IsEmpty()) { return; }
+
 		CumulativeLength.SetNumUninitialized(Data.Num());
 		CumulativeLength[0] = Data[0];
 		for (int i = 1; i < Data.Num(); i++) { CumulativeLength[i] = CumulativeLength[i - 1] + Data[i]; }
+
+		// Accumulated here rather than per-edge so edges can be processed concurrently
+		TotalLength = CumulativeLength.Last();
 	}
 
 #pragma endregion
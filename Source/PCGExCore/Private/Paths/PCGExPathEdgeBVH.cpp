@@ -0,0 +1,213 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Paths/PCGExPathEdgeBVH.h"
+
+#include "Async/ParallelFor.h"
+#include "Paths/PCGExPath.h"
+
+namespace PCGExPaths
+{
+	namespace PathEdgeBVH
+	{
+		constexpr int32 MaxLeafSize = 8;
+		constexpr int32 MinSubtreeSize = 2048;
+		constexpr int32 MaxSubtrees = 64;
+
+		static FBox ComputeBounds(const int32 Start, const int32 Count, const TArray<FPathEdgeBVH::FItem>& Items, const TArray<int32>& Order)
+		{
+			FBox Bounds = FBox(ForceInit);
+			for (int32 i = Start; i < Start + Count; i++) { Bounds += Items[Order[i]].Bounds; }
+			return Bounds;
+		}
+
+		// Median split along the largest axis of the centers' bounds
+		static void SortAlongLargestAxis(const int32 Start, const int32 Count, const TArray<FVector>& Centers, TArray<int32>& Order)
+		{
+			FBox CenterBounds = FBox(ForceInit);
+			for (int32 i = Start; i < Start + Count; i++) { CenterBounds += Centers[Order[i]]; }
+
+			const FVector Size = CenterBounds.GetSize();
+			const int32 Axis = Size.X >= Size.Y && Size.X >= Size.Z ? 0 : Size.Y >= Size.Z ? 1 : 2;
+
+			TArrayView<int32> Range = MakeArrayView(Order.GetData() + Start, Count);
+			Range.Sort([&](const int32 A, const int32 B) { return Centers[A][Axis] < Centers[B][Axis]; });
+		}
+
+		static void BuildNode(
+			TArray<FPathEdgeBVH::FNode>& OutNodes, const int32 NodeIndex, const int32 Start, const int32 Count,
+			const TArray<FPathEdgeBVH::FItem>& Items, const TArray<FVector>& Centers, TArray<int32>& Order)
+		{
+			OutNodes[NodeIndex].Bounds = ComputeBounds(Start, Count, Items, Order);
+
+			if (Count <= MaxLeafSize)
+			{
+				// Leaf content is swept along X at query time
+				TArrayView<int32> Range = MakeArrayView(Order.GetData() + Start, Count);
+				Range.Sort([&](const int32 A, const int32 B) { return Items[A].Bounds.Min.X < Items[B].Bounds.Min.X; });
+
+				OutNodes[NodeIndex].Start = Start;
+				OutNodes[NodeIndex].Count = Count;
+				return;
+			}
+
+			SortAlongLargestAxis(Start, Count, Centers, Order);
+
+			const int32 HalfCount = Count / 2;
+			const int32 ChildIndex = OutNodes.Num();
+
+			OutNodes.AddDefaulted(2);
+			OutNodes[NodeIndex].Start = ChildIndex;
+			OutNodes[NodeIndex].Count = -1;
+
+			BuildNode(OutNodes, ChildIndex, Start, HalfCount, Items, Centers, Order);
+			BuildNode(OutNodes, ChildIndex + 1, Start + HalfCount, Count - HalfCount, Items, Centers, Order);
+		}
+	}
+
+	void FPathEdgeBVH::Build(const TArray<TSharedPtr<FPath>>& InPaths, const TArray<const TBitArray<>*>& InFilters)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPaths::FPathEdgeBVH::Build);
+
+		Items.Reset();
+		Nodes.Reset();
+
+		const int32 NumPaths = InPaths.Num();
+
+		auto IsIndexed = [&](const FPath* Path, const TBitArray<>* Filter, const int32 EdgeIndex)
+		{
+			return (!Filter || (*Filter)[EdgeIndex]) && Path->IsEdgeValid(EdgeIndex);
+		};
+
+		// Count then gather edges, one path per task
+
+		TArray<int32> PathOffsets;
+		PathOffsets.SetNumZeroed(NumPaths + 1);
+
+		ParallelFor(NumPaths, [&](const int32 PathIndex)
+		{
+			const FPath* Path = InPaths[PathIndex].Get();
+			if (!Path) { return; }
+
+			const TBitArray<>* Filter = InFilters.IsValidIndex(PathIndex) ? InFilters[PathIndex] : nullptr;
+
+			int32 Count = 0;
+			for (int32 e = 0; e < Path->NumEdges; e++) { if (IsIndexed(Path, Filter, e)) { Count++; } }
+			PathOffsets[PathIndex + 1] = Count;
+		});
+
+		for (int32 i = 0; i < NumPaths; i++) { PathOffsets[i + 1] += PathOffsets[i]; }
+
+		const int32 NumItems = PathOffsets[NumPaths];
+		if (!NumItems) { return; }
+
+		Items.SetNum(NumItems);
+
+		TArray<FVector> Centers;
+		TArray<int32> Order;
+
+		Centers.SetNumUninitialized(NumItems);
+		Order.SetNumUninitialized(NumItems);
+
+		ParallelFor(NumPaths, [&](const int32 PathIndex)
+		{
+			const FPath* Path = InPaths[PathIndex].Get();
+			if (!Path) { return; }
+
+			const TBitArray<>* Filter = InFilters.IsValidIndex(PathIndex) ? InFilters[PathIndex] : nullptr;
+
+			int32 WriteIndex = PathOffsets[PathIndex];
+			for (int32 e = 0; e < Path->NumEdges; e++)
+			{
+				if (!IsIndexed(Path, Filter, e)) { continue; }
+
+				FItem& Item = Items[WriteIndex];
+				Item.Bounds = Path->Edges[e].Bounds.GetBox();
+				Item.PathIndex = PathIndex;
+				Item.EdgeIndex = e;
+
+				Centers[WriteIndex] = Item.Bounds.GetCenter();
+				Order[WriteIndex] = WriteIndex;
+				WriteIndex++;
+			}
+		});
+
+		// Split the top of the tree serially, until ranges are small enough to be built as independent subtrees
+
+		struct FSubtree
+		{
+			int32 NodeIndex = 0;
+			int32 Start = 0;
+			int32 Count = 0;
+			TArray<FNode> Nodes;
+		};
+
+		TArray<FSubtree> Subtrees;
+		const int32 SubtreeSize = FMath::Max(PathEdgeBVH::MinSubtreeSize, NumItems / PathEdgeBVH::MaxSubtrees);
+
+		Nodes.Reserve(FMath::Max(1, (NumItems / PathEdgeBVH::MaxLeafSize) * 2 + 1));
+		Nodes.AddDefaulted();
+
+		TArray<FInt32Vector3> Pending; // Node, Start, Count
+		Pending.Emplace(0, 0, NumItems);
+
+		while (!Pending.IsEmpty())
+		{
+			const FInt32Vector3 Range = Pending.Pop(EAllowShrinking::No);
+			const int32 NodeIndex = Range.X;
+			const int32 Start = Range.Y;
+			const int32 Count = Range.Z;
+
+			if (Count <= SubtreeSize)
+			{
+				FSubtree& Subtree = Subtrees.Emplace_GetRef();
+				Subtree.NodeIndex = NodeIndex;
+				Subtree.Start = Start;
+				Subtree.Count = Count;
+				continue;
+			}
+
+			Nodes[NodeIndex].Bounds = PathEdgeBVH::ComputeBounds(Start, Count, Items, Order);
+			PathEdgeBVH::SortAlongLargestAxis(Start, Count, Centers, Order);
+
+			const int32 HalfCount = Count / 2;
+			const int32 ChildIndex = Nodes.Num();
+
+			Nodes.AddDefaulted(2);
+			Nodes[NodeIndex].Start = ChildIndex;
+			Nodes[NodeIndex].Count = -1;
+
+			Pending.Emplace(ChildIndex, Start, HalfCount);
+			Pending.Emplace(ChildIndex + 1, Start + HalfCount, Count - HalfCount);
+		}
+
+		ParallelFor(Subtrees.Num(), [&](const int32 i)
+		{
+			FSubtree& Subtree = Subtrees[i];
+			Subtree.Nodes.Reserve(FMath::Max(1, (Subtree.Count / PathEdgeBVH::MaxLeafSize) * 2 + 1));
+			Subtree.Nodes.AddDefaulted();
+			PathEdgeBVH::BuildNode(Subtree.Nodes, 0, Subtree.Start, Subtree.Count, Items, Centers, Order);
+		});
+
+		// Stitch subtrees : local root replaces its placeholder, other local nodes are appended
+		for (FSubtree& Subtree : Subtrees)
+		{
+			const int32 Base = Nodes.Num() - 1;
+
+			auto Remap = [&](FNode InNode)
+			{
+				if (InNode.Count < 0) { InNode.Start += Base; }
+				return InNode;
+			};
+
+			Nodes[Subtree.NodeIndex] = Remap(Subtree.Nodes[0]);
+			for (int32 i = 1; i < Subtree.Nodes.Num(); i++) { Nodes.Add(Remap(Subtree.Nodes[i])); }
+		}
+
+		// Reorder items so leaves reference contiguous ranges
+		TArray<FItem> Sorted;
+		Sorted.SetNumUninitialized(NumItems);
+		ParallelFor(NumItems, [&](const int32 i) { Sorted[i] = Items[Order[i]]; });
+		Items = MoveTemp(Sorted);
+	}
+}
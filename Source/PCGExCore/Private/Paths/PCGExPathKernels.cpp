@@ -0,0 +1,124 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Paths/PCGExPathKernels.h"
+
+#include "Data/PCGBasePointData.h"
+#include "Paths/PCGExPathsHelpers.h"
+
+namespace PCGExPaths
+{
+	void FPathSoA::Load(const UPCGBasePointData* InPointData)
+	{
+		Load(InPointData->GetConstTransformValueRange(), Helpers::GetClosedLoop(InPointData));
+	}
+
+	void FPathSoA::Load(const TConstPCGValueRange<FTransform>& InTransforms, const bool bInClosedLoop)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPaths::FPathSoA::Load);
+
+		const int32 NumPoints = InTransforms.Num();
+		bClosedLoop = bInClosedLoop;
+
+		X.SetNumUninitialized(NumPoints);
+		Y.SetNumUninitialized(NumPoints);
+		Z.SetNumUninitialized(NumPoints);
+
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			const FVector Position = InTransforms[i].GetLocation();
+			X[i] = Position.X;
+			Y[i] = Position.Y;
+			Z[i] = Position.Z;
+		}
+
+		const int32 NumLengths = NumPoints + (bClosedLoop && NumPoints > 0 ? 1 : 0);
+		Cumulative.SetNumUninitialized(FMath::Max(1, NumLengths));
+		Cumulative[0] = 0;
+
+		// Edge lengths first, free of loop-carried dependencies; the prefix sum comes after
+		for (int32 i = 1; i < NumPoints; i++)
+		{
+			const double DX = X[i] - X[i - 1];
+			const double DY = Y[i] - Y[i - 1];
+			const double DZ = Z[i] - Z[i - 1];
+			Cumulative[i] = FMath::Sqrt(DX * DX + DY * DY + DZ * DZ);
+		}
+
+		if (NumLengths > NumPoints)
+		{
+			const double DX = X[0] - X[NumPoints - 1];
+			const double DY = Y[0] - Y[NumPoints - 1];
+			const double DZ = Z[0] - Z[NumPoints - 1];
+			Cumulative[NumPoints] = FMath::Sqrt(DX * DX + DY * DY + DZ * DZ);
+		}
+
+		for (int32 i = 1; i < NumLengths; i++) { Cumulative[i] += Cumulative[i - 1]; }
+	}
+
+	void FPathSamples::SetNum(const int32 InNum)
+	{
+		Distances.SetNumUninitialized(InNum);
+		Edges.SetNumUninitialized(InNum);
+		Alphas.SetNumUninitialized(InNum);
+		X.SetNumUninitialized(InNum);
+		Y.SetNumUninitialized(InNum);
+		Z.SetNumUninitialized(InNum);
+	}
+
+	namespace Kernels
+	{
+		void Sample(const FPathSoA& InPath, FPathSamples& InOutSamples)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPaths::Kernels::Sample);
+
+			const int32 NumSamples = InOutSamples.Num();
+			const int32 NumEdges = InPath.NumEdges();
+
+			InOutSamples.Edges.SetNumUninitialized(NumSamples);
+			InOutSamples.Alphas.SetNumUninitialized(NumSamples);
+			InOutSamples.X.SetNumUninitialized(NumSamples);
+			InOutSamples.Y.SetNumUninitialized(NumSamples);
+			InOutSamples.Z.SetNumUninitialized(NumSamples);
+
+			if (NumEdges <= 0)
+			{
+				for (int32 i = 0; i < NumSamples; i++)
+				{
+					InOutSamples.Edges[i] = 0;
+					InOutSamples.Alphas[i] = 0;
+					InOutSamples.X[i] = InPath.Num() ? InPath.X[0] : 0;
+					InOutSamples.Y[i] = InPath.Num() ? InPath.Y[0] : 0;
+					InOutSamples.Z[i] = InPath.Num() ? InPath.Z[0] : 0;
+				}
+				return;
+			}
+
+			const double* Cumulative = InPath.Cumulative.GetData();
+
+			// Samples are ascending, so the edge cursor only ever moves forward
+			int32 Edge = 0;
+			for (int32 i = 0; i < NumSamples; i++)
+			{
+				const double Distance = InOutSamples.Distances[i];
+				while (Edge < NumEdges - 1 && Cumulative[Edge + 1] < Distance) { Edge++; }
+
+				const double EdgeLength = Cumulative[Edge + 1] - Cumulative[Edge];
+				InOutSamples.Edges[i] = Edge;
+				InOutSamples.Alphas[i] = EdgeLength > 0 ? FMath::Clamp((Distance - Cumulative[Edge]) / EdgeLength, 0.0, 1.0) : 0;
+			}
+
+			const int32 LastIndex = InPath.Num() - 1;
+			for (int32 i = 0; i < NumSamples; i++)
+			{
+				const int32 A = InOutSamples.Edges[i];
+				const int32 B = A == LastIndex ? 0 : A + 1;
+				const double Alpha = InOutSamples.Alphas[i];
+
+				InOutSamples.X[i] = InPath.X[A] + (InPath.X[B] - InPath.X[A]) * Alpha;
+				InOutSamples.Y[i] = InPath.Y[A] + (InPath.Y[B] - InPath.Y[A]) * Alpha;
+				InOutSamples.Z[i] = InPath.Z[A] + (InPath.Z[B] - InPath.Z[A]) * Alpha;
+			}
+		}
+	}
+}
@@ -11,6 +11,7 @@
 #include "Math/PCGExBestFitPlane.h"
 #include "Paths/PCGExPathsHelpers.h"
 #include "Paths/PCGExPathsCommon.h"
+#include "Paths/PCGExSplineBVH.h"
 
 #if PCGEX_ENGINE_VERSION > 506
 #include "Data/PCGPolygon2DData.h"
@@ -119,9 +120,20 @@ namespace PCGExPaths
 		}
 	}
 
+	void FPolyPath::BuildSplineBVH(const double Tolerance)
+	{
+		if (SplineBVH || !Spline) { return; }
+		SplineBVH = MakeShared<FSplineBVH>(*Spline, Tolerance);
+	}
+
+	float FPolyPath::FindClosestKey(const FVector& WorldPosition) const
+	{
+		return SplineBVH ? static_cast<float>(SplineBVH->FindInputKeyClosestToWorldLocation(WorldPosition)) : Spline->FindInputKeyClosestToWorldLocation(WorldPosition);
+	}
+
 	FTransform FPolyPath::GetClosestTransform(const FVector& WorldPosition, int32& OutEdgeIndex, float& OutLerp, const bool bUseScale) const
 	{
-		const float ClosestKey = Spline->FindInputKeyClosestToWorldLocation(WorldPosition);
+		const float ClosestKey = FindClosestKey(WorldPosition);
 		OutEdgeIndex = FMath::FloorToInt32(ClosestKey);
 		OutLerp = ClosestKey - OutEdgeIndex;
 		return Spline->GetTransformAtSplineInputKey(ClosestKey, ESplineCoordinateSpace::World, bUseScale);
@@ -129,7 +141,7 @@ namespace PCGExPaths
 
 	FTransform FPolyPath::GetClosestTransform(const FVector& WorldPosition, float& OutAlpha, const bool bUseScale) const
 	{
-		const float ClosestKey = Spline->FindInputKeyClosestToWorldLocation(WorldPosition);
+		const float ClosestKey = FindClosestKey(WorldPosition);
 		OutAlpha = ClosestKey / Spline->GetNumberOfSplineSegments();
 		return Spline->GetTransformAtSplineInputKey(ClosestKey, ESplineCoordinateSpace::World, bUseScale);
 	}
@@ -137,12 +149,12 @@ namespace PCGExPaths
 	FTransform FPolyPath::GetClosestTransform(const FVector& WorldPosition, bool& bIsInside, const bool bUseScale) const
 	{
 		bIsInside = IsInsideProjection(WorldPosition);
-		return Spline->GetTransformAtSplineInputKey(Spline->FindInputKeyClosestToWorldLocation(WorldPosition), ESplineCoordinateSpace::World, bUseScale);
+		return Spline->GetTransformAtSplineInputKey(FindClosestKey(WorldPosition), ESplineCoordinateSpace::World, bUseScale);
 	}
 
 	FTransform FPolyPath::GetClosestTransform(const FVector& WorldPosition, const bool bUseScale) const
 	{
-		return Spline->GetTransformAtSplineInputKey(Spline->FindInputKeyClosestToWorldLocation(WorldPosition), ESplineCoordinateSpace::World, bUseScale);
+		return Spline->GetTransformAtSplineInputKey(FindClosestKey(WorldPosition), ESplineCoordinateSpace::World, bUseScale);
 	}
 
 	bool FPolyPath::GetClosestPosition(const FVector& WorldPosition, FVector& OutPosition) const
@@ -161,7 +173,7 @@ namespace PCGExPaths
 
 	int32 FPolyPath::GetClosestEdge(const FVector& WorldPosition, float& OutLerp) const
 	{
-		const float ClosestKey = Spline->FindInputKeyClosestToWorldLocation(WorldPosition);
+		const float ClosestKey = FindClosestKey(WorldPosition);
 		const int32 OutEdgeIndex = FMath::FloorToInt32(ClosestKey);
 		OutLerp = ClosestKey - OutEdgeIndex;
 		return FMath::Min(OutEdgeIndex, this->LastEdge);
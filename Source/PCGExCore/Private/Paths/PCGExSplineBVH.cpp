@@ -0,0 +1,333 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Paths/PCGExSplineBVH.h"
+
+#include "Async/ParallelFor.h"
+#include "Data/PCGSplineStruct.h"
+
+namespace PCGExPaths
+{
+	namespace SplineBVH
+	{
+		constexpr int32 MaxLeafSize = 4;
+		constexpr int32 NewtonIterations = 4;
+
+		// Cubic segment expressed as Bezier control points, so the curve is bounded by their convex hull
+		struct FBezier
+		{
+			FVector P[4];
+
+			// Upper bound of the distance between the curve & its chord : distance to a segment is convex,
+			// so its max over the control points' hull is reached at one of the control points.
+			double GetSlack() const
+			{
+				return FMath::Max(FMath::PointDistToSegment(P[1], P[0], P[3]), FMath::PointDistToSegment(P[2], P[0], P[3]));
+			}
+
+			// de Casteljau split at the parameter midpoint, which is also the key midpoint
+			void Split(FBezier& OutLeft, FBezier& OutRight) const
+			{
+				const FVector P01 = (P[0] + P[1]) * 0.5;
+				const FVector P12 = (P[1] + P[2]) * 0.5;
+				const FVector P23 = (P[2] + P[3]) * 0.5;
+				const FVector P012 = (P01 + P12) * 0.5;
+				const FVector P123 = (P12 + P23) * 0.5;
+				const FVector Mid = (P012 + P123) * 0.5;
+
+				OutLeft = {{P[0], P01, P012, Mid}};
+				OutRight = {{Mid, P123, P23, P[3]}};
+			}
+		};
+
+		static void Subdivide(
+			TArray<FSplineSegment>& OutSegments, const FBezier& Bezier,
+			const double K0, const double K1, const double Tolerance, const int32 Depth)
+		{
+			const double Slack = Bezier.GetSlack();
+
+			if (Slack > Tolerance && Depth > 0)
+			{
+				const double KM = (K0 + K1) * 0.5;
+				FBezier Left;
+				FBezier Right;
+				Bezier.Split(Left, Right);
+				Subdivide(OutSegments, Left, K0, KM, Tolerance, Depth - 1);
+				Subdivide(OutSegments, Right, KM, K1, Tolerance, Depth - 1);
+				return;
+			}
+
+			// Slack is a true bound, not a sampled estimate; segments deeper than MaxDepth are simply looser
+			OutSegments.Emplace(Bezier.P[0], Bezier.P[3], K0, K1, Slack);
+		}
+	}
+
+	FSplineBVH::FSplineBVH(const FPCGSplineStruct& InSpline, const double Tolerance, const int32 MaxDepth)
+		: Spline(&InSpline), SplineTransform(InSpline.GetTransform())
+	{
+		Tessellate(FMath::Max(Tolerance, UE_KINDA_SMALL_NUMBER), MaxDepth);
+
+		const int32 NumSegments = Segments.Num();
+		if (!NumSegments) { return; }
+
+		TArray<FVector> Centers;
+		TArray<int32> Order;
+
+		Centers.SetNumUninitialized(NumSegments);
+		Order.SetNumUninitialized(NumSegments);
+
+		for (int i = 0; i < NumSegments; i++)
+		{
+			Centers[i] = Segments[i].GetCenter();
+			Order[i] = i;
+		}
+
+		Nodes.Reserve(FMath::Max(1, (NumSegments / SplineBVH::MaxLeafSize) * 2 + 1));
+		Nodes.AddDefaulted();
+		BuildNode(0, 0, NumSegments, Centers, Order);
+
+		// Reorder segments so leaves reference contiguous ranges
+		TArray<FSplineSegment> Sorted;
+		Sorted.SetNumUninitialized(NumSegments);
+		for (int i = 0; i < NumSegments; i++) { Sorted[i] = Segments[Order[i]]; }
+		Segments = MoveTemp(Sorted);
+
+		LocalBounds = Nodes[0].Bounds;
+		WorldBounds = LocalBounds.TransformBy(SplineTransform);
+	}
+
+	double FSplineBVH::FindInputKeyClosestToWorldLocation(const FVector& WorldLocation) const
+	{
+		double Key = 0;
+		FindClosestLocal(SplineTransform.InverseTransformPosition(WorldLocation), MAX_dbl, Key);
+		return Key;
+	}
+
+	bool FSplineBVH::FindInputKeyClosestToWorldLocation(const FVector& WorldLocation, const double MaxDistance, double& OutKey) const
+	{
+		// Query runs in local space; widen the radius by the smallest scale so we never reject a valid candidate
+		const double MinScale = SplineTransform.GetMinimumAxisScale();
+		const double LocalMaxDistance = MinScale > UE_SMALL_NUMBER ? MaxDistance / MinScale : MAX_dbl;
+		return FindClosestLocal(SplineTransform.InverseTransformPosition(WorldLocation), LocalMaxDistance >= MAX_dbl ? MAX_dbl : FMath::Square(LocalMaxDistance), OutKey);
+	}
+
+	FTransform FSplineBVH::GetClosestTransform(const FVector& WorldLocation, const bool bUseScale) const
+	{
+		return Spline->GetTransformAtSplineInputKey(static_cast<float>(FindInputKeyClosestToWorldLocation(WorldLocation)), ESplineCoordinateSpace::World, bUseScale);
+	}
+
+	void FSplineBVH::Tessellate(const double Tolerance, const int32 MaxDepth)
+	{
+		const FInterpCurveVector& Curve = Spline->GetSplinePointsPosition();
+		const int32 NumPoints = Curve.Points.Num();
+		const int32 NumSplineSegments = Spline->GetNumberOfSplineSegments();
+
+		if (NumPoints == 0) { return; }
+
+		if (NumPoints == 1 || NumSplineSegments <= 0)
+		{
+			const FVector P = Curve.Points[0].OutVal;
+			Segments.Emplace(P, P, Curve.Points[0].InVal, Curve.Points[0].InVal, 0);
+			return;
+		}
+
+		Segments.Reserve(NumSplineSegments * 4);
+
+		for (int i = 0; i < NumSplineSegments; i++)
+		{
+			const int32 NextIndex = i + 1;
+			const double K0 = Curve.Points[i].InVal;
+			const double K1 = NextIndex < NumPoints ? Curve.Points[NextIndex].InVal : Curve.Points.Last().InVal + Curve.LoopKeyOffset;
+
+			const FInterpCurvePoint<FVector>& Prev = Curve.Points[i];
+			const FInterpCurvePoint<FVector>& Next = Curve.Points[NextIndex < NumPoints ? NextIndex : 0];
+
+			const FVector P0 = Prev.OutVal;
+			const FVector P1 = Next.OutVal;
+
+			if (Prev.InterpMode == CIM_Constant)
+			{
+				// Curve holds P0 over the whole range, the chord to P1 would overestimate its reach
+				Segments.Emplace(P0, P0, K0, K1, 0);
+				continue;
+			}
+
+			if (Prev.InterpMode == CIM_Linear)
+			{
+				Segments.Emplace(P0, P1, K0, K1, 0);
+				continue;
+			}
+
+			// Same Hermite form FInterpCurve::Eval uses, converted to Bezier
+			const double Diff = (K1 - K0) / 3.0;
+			const SplineBVH::FBezier Bezier = {{P0, P0 + Prev.LeaveTangent * Diff, P1 - Next.ArriveTangent * Diff, P1}};
+
+			SplineBVH::Subdivide(Segments, Bezier, K0, K1, Tolerance, MaxDepth);
+		}
+	}
+
+	void FSplineBVH::BuildNode(const int32 NodeIndex, const int32 Start, const int32 Count, const TArray<FVector>& Centers, TArray<int32>& Order)
+	{
+		FBox Bounds = FBox(ForceInit);
+		FBox CenterBounds = FBox(ForceInit);
+
+		for (int i = Start; i < Start + Count; i++)
+		{
+			Bounds += Segments[Order[i]].GetBounds();
+			CenterBounds += Centers[Order[i]];
+		}
+
+		Nodes[NodeIndex].Bounds = Bounds;
+
+		if (Count <= SplineBVH::MaxLeafSize)
+		{
+			Nodes[NodeIndex].Start = Start;
+			Nodes[NodeIndex].Count = Count;
+			return;
+		}
+
+		const FVector Size = CenterBounds.GetSize();
+		const int32 Axis = Size.X >= Size.Y && Size.X >= Size.Z ? 0 : Size.Y >= Size.Z ? 1 : 2;
+
+		TArrayView<int32> Range = MakeArrayView(Order.GetData() + Start, Count);
+		Range.Sort([&](const int32 A, const int32 B) { return Centers[A][Axis] < Centers[B][Axis]; });
+
+		const int32 HalfCount = Count / 2;
+		const int32 ChildIndex = Nodes.Num();
+
+		Nodes.AddDefaulted(2);
+		Nodes[NodeIndex].Start = ChildIndex;
+		Nodes[NodeIndex].Count = -1;
+
+		BuildNode(ChildIndex, Start, HalfCount, Centers, Order);
+		BuildNode(ChildIndex + 1, Start + HalfCount, Count - HalfCount, Centers, Order);
+	}
+
+	double FSplineBVH::RefineKey(const FVector& LocalLocation, const FSplineSegment& Segment, double& OutDistSquared) const
+	{
+		const FInterpCurveVector& Curve = Spline->GetSplinePointsPosition();
+
+		// Initial guess from the chord projection
+		const FVector Chord = Segment.End - Segment.Start;
+		const double ChordLengthSquared = Chord.SizeSquared();
+		const double Alpha = ChordLengthSquared > UE_SMALL_NUMBER ? FMath::Clamp(FVector::DotProduct(LocalLocation - Segment.Start, Chord) / ChordLengthSquared, 0.0, 1.0) : 0;
+
+		double Key = FMath::Lerp(Segment.KeyStart, Segment.KeyEnd, Alpha);
+
+		double BestKey = Key;
+		double BestDistSquared = FVector::DistSquared(Curve.Eval(static_cast<float>(Key), FVector::ZeroVector), LocalLocation);
+
+		for (int i = 0; i < SplineBVH::NewtonIterations; i++)
+		{
+			const FVector Delta = Curve.Eval(static_cast<float>(Key), FVector::ZeroVector) - LocalLocation;
+			const FVector D1 = Curve.EvalDerivative(static_cast<float>(Key), FVector::ZeroVector);
+			const FVector D2 = Curve.EvalSecondDerivative(static_cast<float>(Key), FVector::ZeroVector);
+
+			const double Numerator = FVector::DotProduct(D1, Delta);
+			const double Denominator = FVector::DotProduct(D2, Delta) + FVector::DotProduct(D1, D1);
+
+			if (FMath::IsNearlyZero(Denominator)) { break; }
+
+			Key = FMath::Clamp(Key - Numerator / Denominator, Segment.KeyStart, Segment.KeyEnd);
+
+			const double DistSquared = FVector::DistSquared(Curve.Eval(static_cast<float>(Key), FVector::ZeroVector), LocalLocation);
+			if (DistSquared < BestDistSquared)
+			{
+				BestDistSquared = DistSquared;
+				BestKey = Key;
+			}
+		}
+
+		OutDistSquared = BestDistSquared;
+		return BestKey;
+	}
+
+	bool FSplineBVH::FindClosestLocal(const FVector& LocalLocation, const double MaxDistSquared, double& OutKey) const
+	{
+		if (Nodes.IsEmpty()) { return false; }
+
+		struct FCandidate
+		{
+			int32 Index;
+			double LowerBound;
+		};
+
+		TArray<FCandidate, TInlineAllocator<16>> Candidates;
+		TArray<int32, TInlineAllocator<64>> Stack;
+
+		double BestUpper = MaxDistSquared;
+
+		Stack.Add(0);
+		while (!Stack.IsEmpty())
+		{
+			const FNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+			if (Node.Bounds.ComputeSquaredDistanceToPoint(LocalLocation) > BestUpper) { continue; }
+
+			if (Node.Count < 0)
+			{
+				const FNode& A = Nodes[Node.Start];
+				const FNode& B = Nodes[Node.Start + 1];
+
+				// Push farthest first so the closest child is visited first
+				if (A.Bounds.ComputeSquaredDistanceToPoint(LocalLocation) < B.Bounds.ComputeSquaredDistanceToPoint(LocalLocation))
+				{
+					Stack.Add(Node.Start + 1);
+					Stack.Add(Node.Start);
+				}
+				else
+				{
+					Stack.Add(Node.Start);
+					Stack.Add(Node.Start + 1);
+				}
+
+				continue;
+			}
+
+			for (int i = Node.Start; i < Node.Start + Node.Count; i++)
+			{
+				const FSplineSegment& Segment = Segments[i];
+				const double ChordDist = FMath::PointDistToSegment(LocalLocation, Segment.Start, Segment.End);
+				const double Lower = FMath::Square(FMath::Max(0.0, ChordDist - Segment.Slack));
+
+				if (Lower > BestUpper) { continue; }
+
+				// Chord endpoints lie on the curve, and every chord point is within slack of it
+				BestUpper = FMath::Min(BestUpper, FMath::Square(ChordDist + Segment.Slack));
+				Candidates.Add({i, Lower});
+			}
+		}
+
+		double BestDistSquared = MAX_dbl;
+		bool bFound = false;
+
+		for (const FCandidate& Candidate : Candidates)
+		{
+			if (Candidate.LowerBound > BestUpper) { continue; }
+
+			double DistSquared = MAX_dbl;
+			const double Key = RefineKey(LocalLocation, Segments[Candidate.Index], DistSquared);
+
+			if (DistSquared < BestDistSquared)
+			{
+				BestDistSquared = DistSquared;
+				OutKey = Key;
+				bFound = true;
+			}
+		}
+
+		return bFound && BestDistSquared <= MaxDistSquared;
+	}
+
+	namespace Helpers
+	{
+		void BuildSplineBVHs(const TArray<const FPCGSplineStruct*>& InSplines, TArray<TSharedPtr<FSplineBVH>>& OutBVHs, const double Tolerance)
+		{
+			OutBVHs.Init(nullptr, InSplines.Num());
+			ParallelFor(InSplines.Num(), [&](const int32 i)
+			{
+				if (!InSplines[i]) { return; }
+				OutBVHs[i] = MakeShared<FSplineBVH>(*InSplines[i], Tolerance);
+			});
+		}
+	}
+}
@@ -10,6 +10,7 @@
 #include "Data/PCGExProxyData.h"
 #include "Data/PCGExProxyDataHelpers.h"
 #include "Sorting/PCGExSortingDetails.h"
+#include "Sorting/PCGExSortingHelpers.h"
 
 namespace PCGExSorting
 {
@@ -373,6 +374,7 @@ namespace PCGExSorting
 
 			RuleCache.Tolerance = Handler->Tolerance;
 			RuleCache.bInvertRule = Handler->bInvertRule;
+			RuleCache.bConstant = Handler->bUseDataTag;
 			RuleCache.Values.SetNumUninitialized(InNumElements);
 
 			UseTagFlags[RuleIdx] = Handler->bUseDataTag;
@@ -425,5 +427,60 @@ namespace PCGExSorting
 		return Cache;
 	}
 
+	void FSortCache::Sort(TArray<int32>& InOutIndices) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FSortCache::Sort);
+
+		const int32 NumIndices = InOutIndices.Num();
+		if (NumIndices <= 1) { return; }
+
+		constexpr uint64 SignBit = 1ULL << 63;
+		constexpr double MaxSnapped = 4.0e18; // Keeps snapped values within int64
+
+		TArray<PCGEx::FIndexKey> Keys;
+		Keys.SetNumUninitialized(NumIndices);
+
+		// LSD over rules : stable passes from the least significant rule to the most significant one
+		for (int32 RuleIdx = CachedNumRules - 1; RuleIdx >= 0; RuleIdx--)
+		{
+			const FRuleCache& Rule = Rules[RuleIdx];
+			if (Rule.bConstant) { continue; }
+
+			const double* Values = Rule.Values.GetData();
+
+			// Snap to the tolerance grid so nearly-equal values share a key & fall through to the next rule, as Compare does
+			double MaxAbs = 0;
+			for (const double Value : Rule.Values) { MaxAbs = FMath::Max(MaxAbs, FMath::Abs(Value)); }
+
+			const double InvTolerance = Rule.Tolerance > 0 ? 1 / Rule.Tolerance : 0;
+			const bool bSnap = InvTolerance > 0 && MaxAbs * InvTolerance < MaxSnapped;
+
+			// Descending & inverted rules simply flip keys, which preserves stability
+			const bool bFlip = Rule.bInvertRule != bDescending;
+
+			PCGEX_PARALLEL_FOR(
+				NumIndices,
+				const int32 Index = InOutIndices[i];
+				const double Value = Values[Index];
+
+				uint64 Key;
+				if (bSnap)
+				{
+					Key = static_cast<uint64>(static_cast<int64>(FMath::RoundToDouble(Value * InvTolerance))) ^ SignBit;
+				}
+				else
+				{
+					Key = PCGExSortingHelpers::ToSortableKey(Value);
+				}
+
+				Keys[i] = PCGEx::FIndexKey(Index, bFlip ? ~Key : Key);
+			)
+
+			PCGExSortingHelpers::ParallelRadixSort(Keys);
+
+			PCGEX_PARALLEL_FOR(NumIndices, InOutIndices[i] = Keys[i].Index;)
+		}
+	}
+
 #pragma endregion
 }
@@ -0,0 +1,88 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Sorting/PCGExSortingHelpers.h"
+
+#include "Async/ParallelFor.h"
+
+namespace PCGExSortingHelpers
+{
+	namespace Radix
+	{
+		constexpr int32 NumBuckets = 256;
+		constexpr int32 MinParallelKeys = 65536;
+		constexpr int32 MinChunkSize = 16384;
+		constexpr int32 MaxChunks = 64;
+	}
+
+	void ParallelRadixSort(TArray<FIndexKey>& Keys)
+	{
+		const int32 N = Keys.Num();
+		if (N < Radix::MinParallelKeys)
+		{
+			RadixSort(Keys);
+			return;
+		}
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSortingHelpers::ParallelRadixSort);
+
+		const int32 NumChunks = FMath::Clamp(N / Radix::MinChunkSize, 1, Radix::MaxChunks);
+		const int32 ChunkSize = FMath::DivideAndRoundUp(N, NumChunks);
+
+		TArray<FIndexKey> Temp;
+		Temp.SetNumUninitialized(N);
+
+		FIndexKey* Curr = Keys.GetData();
+		FIndexKey* Out = Temp.GetData();
+
+		// One histogram per chunk, reused as scatter cursors once offsets are computed
+		TArray<int32> Histograms;
+		Histograms.SetNumUninitialized(NumChunks * Radix::NumBuckets);
+
+		for (int32 Pass = 0; Pass < static_cast<int32>(sizeof(uint64)); Pass++)
+		{
+			const int32 Shift = Pass * 8;
+
+			ParallelFor(NumChunks, [&](const int32 Chunk)
+			{
+				int32* Count = Histograms.GetData() + Chunk * Radix::NumBuckets;
+				FMemory::Memzero(Count, sizeof(int32) * Radix::NumBuckets);
+
+				const int32 End = FMath::Min(N, (Chunk + 1) * ChunkSize);
+				for (int32 i = Chunk * ChunkSize; i < End; i++) { Count[(Curr[i].Key >> Shift) & 0xFF]++; }
+			});
+
+			// Bucket-major exclusive scan keeps the sort stable across chunks
+			bool bSingleBucket = false;
+			int32 Sum = 0;
+			for (int32 b = 0; b < Radix::NumBuckets && !bSingleBucket; b++)
+			{
+				const int32 BucketStart = Sum;
+				for (int32 Chunk = 0; Chunk < NumChunks; Chunk++)
+				{
+					int32& Count = Histograms[Chunk * Radix::NumBuckets + b];
+					const int32 ChunkCount = Count;
+					Count = Sum;
+					Sum += ChunkCount;
+				}
+
+				// Every key shares this byte, the pass would be a plain copy
+				bSingleBucket = Sum - BucketStart == N;
+			}
+
+			if (bSingleBucket) { continue; }
+
+			ParallelFor(NumChunks, [&](const int32 Chunk)
+			{
+				int32* Cursor = Histograms.GetData() + Chunk * Radix::NumBuckets;
+
+				const int32 End = FMath::Min(N, (Chunk + 1) * ChunkSize);
+				for (int32 i = Chunk * ChunkSize; i < End; i++) { Out[Cursor[(Curr[i].Key >> Shift) & 0xFF]++] = Curr[i]; }
+			});
+
+			Swap(Curr, Out);
+		}
+
+		if (Curr != Keys.GetData()) { FMemory::Memcpy(Keys.GetData(), Curr, sizeof(FIndexKey) * N); }
+	}
+}
@@ -0,0 +1,105 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Sorting/PCGExSpatialSort.h"
+
+#include "Async/ParallelFor.h"
+#include "Data/PCGBasePointData.h"
+#include "Sorting/PCGExSortingHelpers.h"
+
+namespace PCGExSorting
+{
+	namespace SpatialSort
+	{
+		constexpr int32 ChunkSize = 16384;
+
+		template <typename FPositionFunc>
+		static void ComputeOrder(const int32 NumPoints, FPositionFunc&& GetPosition, TArray<int32>& OutOrder, const EPCGExSpaceFillingCurve Curve)
+		{
+			OutOrder.SetNumUninitialized(NumPoints);
+			if (NumPoints <= 1)
+			{
+				if (NumPoints) { OutOrder[0] = 0; }
+				return;
+			}
+
+			const int32 NumChunks = FMath::DivideAndRoundUp(NumPoints, ChunkSize);
+
+			TArray<FBox> ChunkBounds;
+			ChunkBounds.Init(FBox(ForceInit), NumChunks);
+
+			ParallelFor(NumChunks, [&](const int32 Chunk)
+			{
+				FBox& Bounds = ChunkBounds[Chunk];
+				const int32 End = FMath::Min(NumPoints, (Chunk + 1) * ChunkSize);
+				for (int32 i = Chunk * ChunkSize; i < End; i++) { Bounds += GetPosition(i); }
+			});
+
+			FBox Bounds(ForceInit);
+			for (const FBox& Box : ChunkBounds) { Bounds += Box; }
+
+			// Uniform scale on all axes so the curve doesn't stretch along flat dimensions
+			const FVector Min = Bounds.Min;
+			const double Scale = SpatialKeyMax / FMath::Max(Bounds.GetSize().GetMax(), UE_SMALL_NUMBER);
+
+			auto Quantize = [&](const double Value, const double InMin)
+			{
+				return static_cast<uint32>(FMath::Clamp((Value - InMin) * Scale, 0.0, static_cast<double>(SpatialKeyMax)));
+			};
+
+			TArray<PCGEx::FIndexKey> Keys;
+			Keys.SetNumUninitialized(NumPoints);
+
+			ParallelFor(NumChunks, [&](const int32 Chunk)
+			{
+				const int32 End = FMath::Min(NumPoints, (Chunk + 1) * ChunkSize);
+				for (int32 i = Chunk * ChunkSize; i < End; i++)
+				{
+					const FVector P = GetPosition(i);
+					const uint32 X = Quantize(P.X, Min.X);
+					const uint32 Y = Quantize(P.Y, Min.Y);
+					const uint32 Z = Quantize(P.Z, Min.Z);
+
+					Keys[i].Index = i;
+					Keys[i].Key = Curve == EPCGExSpaceFillingCurve::Hilbert ? HilbertKey(X, Y, Z) : MortonKey(X, Y, Z);
+				}
+			});
+
+			// Stable, so points sharing a cell keep their relative order
+			PCGExSortingHelpers::ParallelRadixSort(Keys);
+
+			ParallelFor(NumChunks, [&](const int32 Chunk)
+			{
+				const int32 End = FMath::Min(NumPoints, (Chunk + 1) * ChunkSize);
+				for (int32 i = Chunk * ChunkSize; i < End; i++) { OutOrder[i] = Keys[i].Index; }
+			});
+		}
+	}
+
+	void ComputeSpatialOrder(TConstArrayView<FVector> InPositions, TArray<int32>& OutOrder, const EPCGExSpaceFillingCurve Curve)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSorting::ComputeSpatialOrder);
+		SpatialSort::ComputeOrder(InPositions.Num(), [&](const int32 i) { return InPositions[i]; }, OutOrder, Curve);
+	}
+
+	void ComputeSpatialOrder(const UPCGBasePointData* InPointData, TArray<int32>& OutOrder, const EPCGExSpaceFillingCurve Curve)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSorting::ComputeSpatialOrder);
+
+		if (!InPointData)
+		{
+			OutOrder.Reset();
+			return;
+		}
+
+		const TConstPCGValueRange<FTransform> Transforms = InPointData->GetConstTransformValueRange();
+		SpatialSort::ComputeOrder(InPointData->GetNumPoints(), [&](const int32 i) { return Transforms[i].GetLocation(); }, OutOrder, Curve);
+	}
+
+	void InvertOrder(TConstArrayView<int32> InOrder, TArray<int32>& OutInverse)
+	{
+		const int32 Num = InOrder.Num();
+		OutInverse.SetNumUninitialized(Num);
+		ParallelFor(Num, [&](const int32 i) { OutInverse[InOrder[i]] = i; }, Num < SpatialSort::ChunkSize);
+	}
+}
@@ -1,4 +1,4 @@
-// Copyright 2026 Timothé Lapetite and contributors
+﻿// Copyright 2026 Timothé Lapetite and contributors
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #pragma once
@@ -55,6 +55,7 @@ namespace PCGExClusters
 		bool bIsMirror = false;
 
 		bool bEdgeLengthsDirty = true;
+		bool bVtxPositionsModified = false;
 		TSharedPtr<FCluster> OriginalCluster = nullptr;
 
 		mutable FRWLock ClusterLock;
@@ -120,6 +121,32 @@ namespace PCGExClusters
 		void SetCachedData(FName Key, const TSharedPtr<ICachedClusterData>& Data);
 		void ClearCachedData();
 
+		/**
+		 * Adopt portable cached data (see ICachedClusterData::IsPortable) from another cluster sharing the same structure. Existing entries are kept.
+		 * Does nothing if Other's vtx positions were modified, since everything it cached depends on them.
+		 * @return true if at least one cached data entry was adopted
+		 */
+		bool InheritCachedData(const FCluster& Other);
+
+		/** Whether both clusters have identical nodes, links & edges, regardless of whether the arrays are shared */
+		bool HasSameStructure(const FCluster& Other) const;
+
+		/** Copy structure arrays still shared with the original cluster, so in-place edits don't leak into it */
+		void DetachStructure();
+
+		/**
+		 * Drop edges that aren't fully valid in-place, compacting the remaining ones in order and relinking nodes.
+		 * Nodes, NodeIndexLookup & the node octree are untouched; edge-indexed data and cached data are discarded.
+		 * The cluster no longer mirrors its original one afterward.
+		 * @param OutKeptEdges Edge point index each kept edge was read from, in their new order
+		 */
+		void CompactEdges(TArray<int32>& OutKeptEdges);
+
+		/** Point the cluster at new vtx & edges data matching its current structure, i.e. the output of a CompactEdges */
+		void BindTo(const TSharedPtr<PCGExData::FPointIO>& InVtxIO, const TSharedPtr<PCGExData::FPointIO>& InEdgesIO);
+
+		void GetAllCachedData(TMap<FName, TSharedPtr<ICachedClusterData>>& OutCachedData) const;
+
 		FCluster(const TSharedPtr<PCGExData::FPointIO>& InVtxIO, const TSharedPtr<PCGExData::FPointIO>& InEdgesIO, const TSharedPtr<PCGEx::FIndexLookup>& InNodeIndexLookup);
 		FCluster(const TSharedRef<FCluster>& OtherCluster, const TSharedPtr<PCGExData::FPointIO>& InVtxIO, const TSharedPtr<PCGExData::FPointIO>& InEdgesIO, const TSharedPtr<PCGEx::FIndexLookup>& InNodeIndexLookup, bool bCopyNodes, bool bCopyEdges, bool bCopyLookup);
 
@@ -169,6 +196,9 @@ namespace PCGExClusters
 		void BuildFromSubgraphData(const TSharedPtr<PCGExData::FFacade>& InVtxFacade, const TSharedPtr<PCGExData::FFacade>& InEdgeFacade, const TArray<FEdge>& InEdges, const int32 InNumNodes);
 
 		bool IsValidWith(const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO) const;
+
+		/** Approximate heap footprint of the cluster structure (nodes, edges & lookups), excluding the underlying point data. */
+		SIZE_T GetAllocatedSize() const;
 		bool HasTag(const FString& InTag);
 
 		FORCEINLINE FNode* GetNode(const int32 Index) const { return (NodesDataPtr + Index); }
@@ -34,6 +34,20 @@ namespace PCGExClusters
 
 		/** Context hash for validation (e.g., projection settings hash). 0 = always valid. */
 		uint32 ContextHash = 0;
+
+		/**
+		 * Write this data into a cluster snapshot, see PCGExClusters::Snapshot.
+		 * Return false (default) if the data can't be serialized; it will be rebuilt on demand instead.
+		 * Must be readable back by the owning factory's LoadSnapshot.
+		 */
+		virtual bool SaveSnapshot(FArchive& Ar) const { return false; }
+
+		/**
+		 * Whether this data can be handed over to another cluster sharing the same structure & content key.
+		 * Only true if it depends solely on topology & vtx positions, and holds no pointer to the cluster it was built from.
+		 * Non-portable data (default) is never written back to persistent clusters.
+		 */
+		virtual bool IsPortable() const { return false; }
 	};
 
 	/**
@@ -78,6 +92,9 @@ namespace PCGExClusters
 		 * For opportunistic caches, this may return nullptr (processors build directly).
 		 */
 		virtual TSharedPtr<ICachedClusterData> Build(const FClusterCacheBuildContext& Context) const = 0;
+
+		/** Read data written by ICachedClusterData::SaveSnapshot, for a cluster restored from a snapshot. */
+		virtual TSharedPtr<ICachedClusterData> LoadSnapshot(const TSharedRef<FCluster>& InCluster, FArchive& Ar) const { return nullptr; }
 	};
 
 	/**
@@ -0,0 +1,53 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExClusters
+{
+	/** Exact identity of the vtx/edges data a cluster was built from. Only valid for the current session. */
+	struct PCGEXCORE_API FClusterDataKey
+	{
+		uint64 VtxUID = 0;
+		uint64 EdgesUID = 0;
+		uint32 BuildOptions = 0;
+
+		FClusterDataKey() = default;
+
+		FClusterDataKey(const uint64 InVtxUID, const uint64 InEdgesUID, const uint32 InBuildOptions)
+			: VtxUID(InVtxUID), EdgesUID(InEdgesUID), BuildOptions(InBuildOptions)
+		{
+		}
+
+		FORCEINLINE bool IsValid() const { return VtxUID != 0 || EdgesUID != 0; }
+		FORCEINLINE bool operator==(const FClusterDataKey& Other) const { return VtxUID == Other.VtxUID && EdgesUID == Other.EdgesUID && BuildOptions == Other.BuildOptions; }
+
+		friend FORCEINLINE uint32 GetTypeHash(const FClusterDataKey& Key) { return HashCombineFast(HashCombineFast(GetTypeHash(Key.VtxUID), GetTypeHash(Key.EdgesUID)), Key.BuildOptions); }
+	};
+
+	/**
+	 * 128-bit hash of everything a cluster build depends on.
+	 * Wide enough to be trusted as an identity across executions & sessions, unlike a 32/64-bit hash.
+	 */
+	struct PCGEXCORE_API FClusterContentKey
+	{
+		uint64 Low = 0;
+		uint64 High = 0;
+
+		FORCEINLINE bool IsValid() const { return Low != 0 || High != 0; }
+		FORCEINLINE bool operator==(const FClusterContentKey& Other) const { return Low == Other.Low && High == Other.High; }
+		FORCEINLINE bool operator!=(const FClusterContentKey& Other) const { return !(*this == Other); }
+
+		FORCEINLINE FString ToString() const { return FString::Printf(TEXT("%016llx%016llx"), High, Low); }
+
+		friend FORCEINLINE uint32 GetTypeHash(const FClusterContentKey& Key) { return GetTypeHash(Key.Low); }
+
+		friend FArchive& operator<<(FArchive& Ar, FClusterContentKey& Key)
+		{
+			Ar << Key.Low << Key.High;
+			return Ar;
+		}
+	};
+}
@@ -0,0 +1,57 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExClusterCacheKey.h"
+
+namespace PCGExData
+{
+	class FPointIO;
+}
+
+namespace PCGExClusters
+{
+	class FCluster;
+}
+
+/**
+ * Binary snapshot of a built cluster, so large static graphs can skip reconstruction across sessions.
+ *
+ * Layout is a fixed header followed by flat, native-endian sections :
+ * node -> point map, CSR adjacency (offsets & links), edge endpoints, edge point indices, validity flags,
+ * then cached data blobs for every ICachedClusterData that supports SaveSnapshot.
+ * Octrees aren't stored; the header only records which ones existed so they are rebuilt eagerly on load.
+ */
+namespace PCGExClusters::Snapshot
+{
+	constexpr uint32 Magic = 0x43584750; // "PGXC"
+	constexpr uint32 Version = 2;
+
+	PCGEXCORE_API bool Write(const FCluster& InCluster, const FClusterContentKey& InContentKey, FArchive& Ar);
+
+	/**
+	 * Restore a cluster bound to the given vtx & edges, without going through endpoints lookups.
+	 * @return nullptr if the snapshot is invalid, outdated, or doesn't match the provided data.
+	 */
+	PCGEXCORE_API TSharedPtr<FCluster> Read(FArchive& Ar, const FClusterContentKey& InContentKey, const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO);
+
+	/** Snapshot file for a given content key, under the project's Saved directory */
+	PCGEXCORE_API FString GetFilePath(const FClusterContentKey& InContentKey);
+
+	/** @param bOverwrite Replace an existing snapshot, i.e when the cluster has gathered more cached data since it was last saved */
+	PCGEXCORE_API bool SaveToDisk(const FCluster& InCluster, const FClusterContentKey& InContentKey, const bool bOverwrite = false);
+
+	/** Same as SaveToDisk, but serializes & writes on a background task then prunes the snapshot directory. Keeps InCluster alive until done. */
+	PCGEXCORE_API void SaveToDiskAsync(const TSharedPtr<FCluster>& InCluster, const FClusterContentKey& InContentKey, const bool bOverwrite = false);
+
+	/** Also marks the snapshot as recently used, so it is pruned last. */
+	PCGEXCORE_API TSharedPtr<FCluster> LoadFromDisk(const FClusterContentKey& InContentKey, const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO);
+
+	/** Delete least recently used snapshots until the snapshot directory fits in MaxBytes, as well as leftovers from interrupted writes. */
+	PCGEXCORE_API void Prune(const int64 MaxBytes);
+
+	/** Prune against the ClusterSnapshotsBudget setting on a background task. Does nothing if a prune is already running. */
+	PCGEXCORE_API void PruneAsync();
+}
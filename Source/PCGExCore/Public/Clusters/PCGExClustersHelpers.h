@@ -1,4 +1,4 @@
-// Copyright 2026 Timothé Lapetite and contributors
+﻿// Copyright 2026 Timothé Lapetite and contributors
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #pragma once
@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 #include "PCGExEdge.h"
 #include "PCGExNode.h"
+#include "PCGExClusterCacheKey.h"
 #include "Data/PCGExDataCommon.h"
 
 class UPCGMetadata;
@@ -35,4 +36,19 @@ namespace PCGExClusters::Helpers
 	PCGEXCORE_API void GetAdjacencyData(const FCluster* InCluster, FNode& InNode, TArray<FAdjacencyData>& OutData);
 
 	PCGEXCORE_API TSharedPtr<FCluster> TryGetCachedCluster(const TSharedRef<PCGExData::FPointIO>& VtxIO, const TSharedRef<PCGExData::FPointIO>& EdgeIO);
+
+	struct PCGEXCORE_API FPersistentClusterKey
+	{
+		FClusterDataKey DataKey;       // Vtx & edges data UIDs, stable as long as upstream data is unchanged
+		FClusterContentKey ContentKey; // Positions & topology hash, invalid until computed
+
+		FORCEINLINE bool IsValid() const { return DataKey.IsValid(); }
+	};
+
+	/** Looks up a cluster in the subsystem cache, first by data UIDs, then by content. OutKey can be used to cache the cluster if none was found. */
+	PCGEXCORE_API TSharedPtr<FCluster> TryGetPersistentCluster(const TSharedRef<PCGExData::FPointIO>& VtxIO, const TSharedRef<PCGExData::FPointIO>& EdgeIO, const uint32 InBuildOptions, FPersistentClusterKey& OutKey);
+	PCGEXCORE_API void CachePersistentCluster(const TSharedRef<PCGExData::FPointIO>& VtxIO, const TSharedRef<PCGExData::FPointIO>& EdgeIO, const uint32 InBuildOptions, FPersistentClusterKey& InKey, const TSharedPtr<FCluster>& InCluster);
+
+	/** Re-save a persistent cluster's snapshot, so cached data gathered after it was first built is available to later sessions. */
+	PCGEXCORE_API void UpdatePersistentClusterSnapshot(const FClusterContentKey& InContentKey, const TSharedPtr<FCluster>& InCluster);
 }
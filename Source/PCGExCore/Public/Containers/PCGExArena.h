@@ -0,0 +1,83 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include <type_traits>
+#include "CoreMinimal.h"
+
+namespace PCGExMT
+{
+	/**
+	 * Bump allocator for transient objects sharing a lifetime, typically a node execution.
+	 * Allocations are spread over per-worker lanes so concurrent tasks don't contend on a single lock or on the global allocator.
+	 * Memory is never released individually, only in bulk on Reset or destruction.
+	 */
+	class PCGEXCORE_API FArena : public TSharedFromThis<FArena>
+	{
+	public:
+		explicit FArena(const int32 InBlockSize = 64 * 1024);
+		~FArena();
+
+		FArena(const FArena&) = delete;
+		FArena& operator=(const FArena&) = delete;
+
+		void* Allocate(const SIZE_T InSize, const SIZE_T InAlignment = 16);
+
+		/** Constructs an object in the arena. Non-trivial destructors are run when the arena is reset. */
+		template <typename T, typename... TArgs>
+		T* New(TArgs&&... Args)
+		{
+			T* Object = new(Allocate(sizeof(T), alignof(T))) T(Forward<TArgs>(Args)...);
+			if constexpr (!std::is_trivially_destructible_v<T>) { AddDestructor(Object, [](void* InObject) { static_cast<T*>(InObject)->~T(); }); }
+			return Object;
+		}
+
+		/** Default-initialized scratch array, valid until the arena is reset. */
+		template <typename T>
+		TArrayView<T> NewArray(const int32 Num)
+		{
+			static_assert(std::is_trivially_destructible_v<T>, "Arena arrays don't track destructors");
+			if (Num <= 0) { return TArrayView<T>(); }
+
+			T* Data = static_cast<T*>(Allocate(sizeof(T) * Num, alignof(T)));
+			for (int32 i = 0; i < Num; i++) { new(Data + i) T(); }
+			return TArrayView<T>(Data, Num);
+		}
+
+		/** Runs pending destructors & frees every block. Nothing allocated before this call may be used afterward. */
+		void Reset();
+
+		int64 GetAllocatedSize() const;
+
+	protected:
+		using FDestructFunc = void (*)(void*);
+
+		struct FDestructor
+		{
+			void* Object = nullptr;
+			FDestructFunc Destruct = nullptr;
+			FDestructor* Next = nullptr;
+		};
+
+		struct alignas(PLATFORM_CACHE_LINE_SIZE) FLane
+		{
+			mutable FCriticalSection Lock;
+			uint8* Cursor = nullptr;
+			uint8* End = nullptr;
+			TArray<void*> Blocks;
+			FDestructor* Destructors = nullptr;
+			int64 AllocatedSize = 0;
+		};
+
+		int32 BlockSize = 0;
+		uint32 LaneMask = 0;
+		TArray<TUniquePtr<FLane>> Lanes;
+
+		FLane& GetLane() const;
+		void* AllocateInLane(FLane& Lane, const SIZE_T InSize, const SIZE_T InAlignment) const;
+		void AddDestructor(void* InObject, FDestructFunc InDestruct);
+		void RunDestructors(FLane& Lane);
+		void FreeBlocks(FLane& Lane);
+	};
+}
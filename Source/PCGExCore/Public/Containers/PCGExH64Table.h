@@ -0,0 +1,192 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include <atomic>
+#include "CoreMinimal.h"
+#include "HAL/PlatformProcess.h"
+
+namespace PCGExMT
+{
+	/**
+	 * Fixed-capacity open-addressing table for uint64 keys, with lock-free insert-or-get.
+	 * Keys are claimed with a CAS on their slot & probed linearly; values are published through a per-slot state
+	 * that doubles as a tiny spin lock for in-place updates. Slots never move, so value pointers stay valid until Reset.
+	 *
+	 * The table never grows. Past its load limit, the empty slot that ends a probe gets sealed instead of claimed,
+	 * and any probe reaching a sealed slot reports an overflow : the caller is expected to fall back to another container.
+	 * Since every insert of a given key walks the same probe sequence, a key always lives in exactly one place.
+	 */
+	template <typename T>
+	class TH64Table
+	{
+		static constexpr uint64 EmptyKey = MAX_uint64;
+		static constexpr uint64 SealedKey = MAX_uint64 - 1;
+
+		enum EState : int32
+		{
+			Pending = 0, // Key claimed, value not written yet
+			Live    = 1,
+			Busy    = 2, // Locked for update
+			Removed = 3,
+		};
+
+	public:
+		struct FSlot
+		{
+			std::atomic<uint64> Key{EmptyKey};
+			std::atomic<int32> State{Pending};
+			T Value = T();
+		};
+
+	private:
+		TUniquePtr<FSlot[]> Slots;
+		uint64 Capacity = 0;
+		uint64 Mask = 0;
+		int32 Shift = 64;
+		int64 MaxLoad = 0;
+		std::atomic<int64> NumClaims{0};
+
+	public:
+		TH64Table() = default;
+
+		TH64Table(const TH64Table&) = delete;
+		TH64Table& operator=(const TH64Table&) = delete;
+
+		/** Keys reserved as slot markers can't be stored, callers must route them elsewhere */
+		static FORCEINLINE bool IsSupportedKey(const uint64 Key) { return Key < SealedKey; }
+
+		FORCEINLINE bool IsEnabled() const { return Capacity > 0; }
+		FORCEINLINE bool IsEmpty() const { return NumClaims.load(std::memory_order_relaxed) == 0; }
+
+		/** Allocate room for ExpectedNum keys at roughly half load. Not thread-safe, drops any existing content. */
+		void Init(const int32 ExpectedNum)
+		{
+			Reset();
+			if (ExpectedNum <= 0) { return; }
+
+			Capacity = FMath::RoundUpToPowerOfTwo64(FMath::Max<uint64>(16, static_cast<uint64>(ExpectedNum) * 2));
+			Mask = Capacity - 1;
+			Shift = 64 - FMath::FloorLog2_64(Capacity);
+			MaxLoad = static_cast<int64>(Capacity - Capacity / 4);
+
+			Slots = MakeUnique<FSlot[]>(Capacity);
+		}
+
+		/** Not thread-safe */
+		void Reset()
+		{
+			Slots.Reset();
+			Capacity = 0;
+			Mask = 0;
+			Shift = 64;
+			MaxLoad = 0;
+			NumClaims.store(0, std::memory_order_relaxed);
+		}
+
+		/**
+		 * Lookup without insertion.
+		 * @return The slot holding Key if any, in which case its value is published.
+		 * bOutOverflow is set when the key, if present at all, lives in the caller's fallback container.
+		 */
+		FSlot* Find(const uint64 Key, bool& bOutOverflow) const
+		{
+			bOutOverflow = false;
+			for (uint64 i = Hash(Key);; i = (i + 1) & Mask)
+			{
+				FSlot& Slot = Slots[i];
+				const uint64 SlotKey = Slot.Key.load(std::memory_order_acquire);
+
+				if (SlotKey == EmptyKey) { return nullptr; }
+				if (SlotKey == SealedKey)
+				{
+					bOutOverflow = true;
+					return nullptr;
+				}
+
+				if (SlotKey == Key) { return WaitPublished(Slot) ? &Slot : nullptr; }
+			}
+		}
+
+		/**
+		 * Insert-or-get.
+		 * @return The slot for Key, or nullptr if the key belongs to the caller's fallback container.
+		 * When bOutClaimed is set, the caller owns the slot : it must write the value, then Publish it.
+		 */
+		FSlot* FindOrClaim(const uint64 Key, bool& bOutClaimed)
+		{
+			bOutClaimed = false;
+			for (uint64 i = Hash(Key);; i = (i + 1) & Mask)
+			{
+				FSlot& Slot = Slots[i];
+				uint64 SlotKey = Slot.Key.load(std::memory_order_acquire);
+
+				if (SlotKey == EmptyKey)
+				{
+					// Past the load limit, seal the slot so racing inserts of the same key divert as well
+					const uint64 NewKey = NumClaims.fetch_add(1, std::memory_order_relaxed) < MaxLoad ? Key : SealedKey;
+					if (Slot.Key.compare_exchange_strong(SlotKey, NewKey, std::memory_order_acq_rel, std::memory_order_acquire))
+					{
+						if (NewKey == SealedKey) { return nullptr; }
+						bOutClaimed = true;
+						return &Slot;
+					}
+
+					// Lost the race, SlotKey now holds the winner's key
+				}
+
+				if (SlotKey == SealedKey) { return nullptr; }
+				if (SlotKey == Key) { return &Slot; }
+			}
+		}
+
+		static FORCEINLINE void Publish(FSlot& Slot) { Slot.State.store(Live, std::memory_order_release); }
+
+		/** Spin until the claimer has published the slot. Returns false if the entry has been removed since. */
+		static bool WaitPublished(FSlot& Slot)
+		{
+			while (true)
+			{
+				const int32 State = Slot.State.load(std::memory_order_acquire);
+				if (State == Live || State == Removed) { return State == Live; }
+				FPlatformProcess::Yield();
+			}
+		}
+
+		/** Take exclusive access to a published slot. Returns true if the entry was removed, i.e the value must be reinitialized. */
+		static bool Lock(FSlot& Slot)
+		{
+			while (true)
+			{
+				int32 State = Slot.State.load(std::memory_order_acquire);
+				if ((State == Live || State == Removed) &&
+					Slot.State.compare_exchange_weak(State, Busy, std::memory_order_acquire, std::memory_order_relaxed))
+				{
+					return State == Removed;
+				}
+				FPlatformProcess::Yield();
+			}
+		}
+
+		static FORCEINLINE void Unlock(FSlot& Slot, const bool bRemoved = false) { Slot.State.store(bRemoved ? Removed : Live, std::memory_order_release); }
+
+		/** Calls Func(uint64 Key, T& Value) for each live entry. Not thread-safe. */
+		template <typename TFunc>
+		void ForEach(TFunc&& Func)
+		{
+			for (uint64 i = 0; i < Capacity; i++)
+			{
+				FSlot& Slot = Slots[i];
+				if (IsSupportedKey(Slot.Key.load(std::memory_order_relaxed)) &&
+					Slot.State.load(std::memory_order_relaxed) == Live)
+				{
+					Func(Slot.Key.load(std::memory_order_relaxed), Slot.Value);
+				}
+			}
+		}
+
+	private:
+		FORCEINLINE uint64 Hash(const uint64 Key) const { return (Key * 0x9E3779B97F4A7C15ULL) >> Shift; }
+	};
+}
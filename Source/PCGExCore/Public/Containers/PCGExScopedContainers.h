@@ -4,17 +4,29 @@
 #pragma once
 
 #include <functional>
+#include <type_traits>
 #include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
 #include "Misc/ScopeRWLock.h"
 #include "Core/PCGExMTCommon.h"
+#include "Containers/PCGExH64Table.h"
 
 namespace PCGExMT
 {
+	/**
+	 * Concurrent uint64 set.
+	 * Reserve sizes a lock-free open-addressing table from the expected count; locked shards only catch
+	 * what doesn't fit in it, or everything when Reserve was never called.
+	 */
 	template <int32 NumShards = 32>
 	struct TH64SetShards
 	{
 	private:
+		using FTable = TH64Table<uint8>;
+		using FSlot = FTable::FSlot;
+
 		const int32 Log2NumShards = FMath::FloorLog2(NumShards);
+		FTable Table;
 		TStaticArray<TSet<uint64>, NumShards> Shards;
 		mutable TStaticArray<FRWLock, NumShards> Locks;
 		const uint32 ShardMask = NumShards - 1;
@@ -27,23 +39,52 @@ namespace PCGExMT
 
 		void Reserve(const int32 ShardReserve)
 		{
+			if (!Table.IsEnabled() || Table.IsEmpty())
+			{
+				Table.Init(ShardReserve);
+				return;
+			}
+
 			int32 NumReserve = ShardReserve / NumShards;
 			for (int32 i = 0; i < NumShards; i++)
 			{
-				FReadScopeLock ScopeLock(Locks[i]);
+				FWriteScopeLock ScopeLock(Locks[i]);
 				Shards[i].Reserve(NumReserve);
 			}
 		}
 
 		void Add(uint64 Value)
 		{
-			const uint32 Index = FastHashToShard(Value);
-			FWriteScopeLock ScopeLock(Locks[Index]);
-			Shards[Index].Add(Value);
+			bool bIsAlreadySet = false;
+			Add(Value, bIsAlreadySet);
 		}
 
 		void Add(uint64 Value, bool& bIsAlreadySet)
 		{
+			if (UseTable(Value))
+			{
+				bool bClaimed = false;
+				if (FSlot* Slot = Table.FindOrClaim(Value, bClaimed))
+				{
+					if (bClaimed)
+					{
+						FTable::Publish(*Slot);
+						bIsAlreadySet = false;
+					}
+					else if (FTable::WaitPublished(*Slot))
+					{
+						bIsAlreadySet = true;
+					}
+					else
+					{
+						// Revive a removed entry; whoever locks it first is the one adding it
+						bIsAlreadySet = !FTable::Lock(*Slot);
+						FTable::Unlock(*Slot);
+					}
+					return;
+				}
+			}
+
 			const uint32 Index = FastHashToShard(Value);
 			FWriteScopeLock ScopeLock(Locks[Index]);
 			Shards[Index].Add(Value, &bIsAlreadySet);
@@ -51,6 +92,18 @@ namespace PCGExMT
 
 		int32 Remove(uint64 Value)
 		{
+			if (UseTable(Value))
+			{
+				bool bOverflow = false;
+				if (FSlot* Slot = Table.Find(Value, bOverflow))
+				{
+					const bool bWasRemoved = FTable::Lock(*Slot);
+					FTable::Unlock(*Slot, true);
+					return bWasRemoved ? 0 : 1;
+				}
+				if (!bOverflow) { return 0; }
+			}
+
 			const uint32 Index = FastHashToShard(Value);
 			FWriteScopeLock ScopeLock(Locks[Index]);
 			return Shards[Index].Remove(Value);
@@ -58,6 +111,13 @@ namespace PCGExMT
 
 		bool Contains(uint64 Value) const
 		{
+			if (UseTable(Value))
+			{
+				bool bOverflow = false;
+				if (Table.Find(Value, bOverflow)) { return true; }
+				if (!bOverflow) { return false; }
+			}
+
 			const uint32 Index = FastHashToShard(Value);
 			FReadScopeLock ScopeLock(Locks[Index]);
 			return Shards[Index].Contains(Value);
@@ -65,8 +125,9 @@ namespace PCGExMT
 
 		void Collapse(TSet<uint64>& OutMerged)
 		{
-			int32 Num = 0;
-			for (int32 i = 0; i < NumShards; i++) { Num += Shards[i].Num(); }
+			Table.ForEach([&](const uint64 Key, uint8&) { OutMerged.Add(Key); });
+			Table.Reset();
+
 			for (int32 i = 0; i < NumShards; i++)
 			{
 				OutMerged.Append(Shards[i]);
@@ -76,21 +137,33 @@ namespace PCGExMT
 
 		void Empty()
 		{
+			Table.Reset();
 			for (int32 i = 0; i < NumShards; i++) { Shards[i].Empty(); }
 		}
 
 	private:
+		FORCEINLINE bool UseTable(const uint64 Value) const { return Table.IsEnabled() && FTable::IsSupportedKey(Value); }
+
 		FORCEINLINE uint32 FastHashToShard(uint64 Value) const
 		{
 			return static_cast<uint32>((Value * 2654435761ULL) >> (64 - Log2NumShards));
 		}
 	};
 
+	/**
+	 * Concurrent uint64 -> T map, same layout as TH64SetShards.
+	 * Lookups & insert-or-get on the lock-free table never block, except on a slot whose value is still being written;
+	 * overwrites & updates lock that single slot.
+	 */
 	template <typename T, int32 NumShards = 32>
 	struct TH64MapShards
 	{
 	private:
+		using FTable = TH64Table<T>;
+		using FSlot = typename FTable::FSlot;
+
 		const int32 Log2NumShards = FMath::FloorLog2(NumShards);
+		FTable Table;
 		TStaticArray<TMap<uint64, T>, NumShards> Shards;
 		mutable TStaticArray<FRWLock, NumShards> Locks;
 		const uint32 ShardMask = NumShards - 1;
@@ -103,16 +176,24 @@ namespace PCGExMT
 
 		void Reserve(const int32 ShardReserve)
 		{
+			if (!Table.IsEnabled() || Table.IsEmpty())
+			{
+				Table.Init(ShardReserve);
+				return;
+			}
+
 			int32 NumReserve = ShardReserve / NumShards;
 			for (int32 i = 0; i < NumShards; i++)
 			{
-				FReadScopeLock ScopeLock(Locks[i]);
+				FWriteScopeLock ScopeLock(Locks[i]);
 				Shards[i].Reserve(NumReserve);
 			}
 		}
 
 		T& Add(uint64 Key, T Value)
 		{
+			if (T* Existing = TableUpdate(Key, [&](T& InValue, bool) { InValue = Value; })) { return *Existing; }
+
 			const uint32 Index = FastHashToShard(Key);
 			FWriteScopeLock ScopeLock(Locks[Index]);
 			return Shards[Index].Add(Key, Value);
@@ -120,6 +201,13 @@ namespace PCGExMT
 
 		T* Find(uint64 Key)
 		{
+			if (UseTable(Key))
+			{
+				bool bOverflow = false;
+				if (FSlot* Slot = Table.Find(Key, bOverflow)) { return &Slot->Value; }
+				if (!bOverflow) { return nullptr; }
+			}
+
 			const uint32 Index = FastHashToShard(Key);
 			FWriteScopeLock ScopeLock(Locks[Index]);
 			return Shards[Index].Find(Key);
@@ -127,13 +215,40 @@ namespace PCGExMT
 
 		const T* Find(uint64 Key) const
 		{
+			if (UseTable(Key))
+			{
+				bool bOverflow = false;
+				if (const FSlot* Slot = Table.Find(Key, bOverflow)) { return &Slot->Value; }
+				if (!bOverflow) { return nullptr; }
+			}
+
 			const uint32 Index = FastHashToShard(Key);
 			FReadScopeLock ScopeLock(Locks[Index]);
 			return Shards[Index].Find(Key);
 		}
 
+		// Insert-or-get : returns the existing value, or Value once inserted
 		T& FindOrAdd(uint64 Key, T& Value)
 		{
+			if (UseTable(Key))
+			{
+				bool bClaimed = false;
+				if (FSlot* Slot = Table.FindOrClaim(Key, bClaimed))
+				{
+					if (bClaimed)
+					{
+						Slot->Value = Value;
+						FTable::Publish(*Slot);
+					}
+					else if (!FTable::WaitPublished(*Slot))
+					{
+						if (FTable::Lock(*Slot)) { Slot->Value = Value; }
+						FTable::Unlock(*Slot);
+					}
+					return Slot->Value;
+				}
+			}
+
 			const uint32 Index = FastHashToShard(Key);
 			FWriteScopeLock ScopeLock(Locks[Index]);
 			return Shards[Index].FindOrAdd(Key, Value);
@@ -141,6 +256,18 @@ namespace PCGExMT
 
 		int32 Remove(uint64 Key)
 		{
+			if (UseTable(Key))
+			{
+				bool bOverflow = false;
+				if (FSlot* Slot = Table.Find(Key, bOverflow))
+				{
+					const bool bWasRemoved = FTable::Lock(*Slot);
+					FTable::Unlock(*Slot, true);
+					return bWasRemoved ? 0 : 1;
+				}
+				if (!bOverflow) { return 0; }
+			}
+
 			const uint32 Index = FastHashToShard(Key);
 			FWriteScopeLock ScopeLock(Locks[Index]);
 			return Shards[Index].Remove(Key);
@@ -151,6 +278,13 @@ namespace PCGExMT
 		template <typename TUpdateFunc>
 		void FindOrAddAndUpdate(uint64 Key, T DefaultValue, TUpdateFunc&& UpdateFunc)
 		{
+			if (TableUpdate(
+				Key, [&](T& Value, const bool bIsNew)
+				{
+					if (bIsNew) { Value = DefaultValue; }
+					UpdateFunc(Value, bIsNew);
+				})) { return; }
+
 			const uint32 Index = FastHashToShard(Key);
 			FWriteScopeLock ScopeLock(Locks[Index]);
 			const bool bIsNew = !Shards[Index].Contains(Key);
@@ -162,6 +296,13 @@ namespace PCGExMT
 		template <typename TUpdateFunc>
 		void FindOrAddAndUpdate(uint64 Key, TUpdateFunc&& UpdateFunc)
 		{
+			if (TableUpdate(
+				Key, [&](T& Value, const bool bIsNew)
+				{
+					if (bIsNew) { Value = T(); }
+					UpdateFunc(Value);
+				})) { return; }
+
 			const uint32 Index = FastHashToShard(Key);
 			FWriteScopeLock ScopeLock(Locks[Index]);
 			T& Value = Shards[Index].FindOrAdd(Key);
@@ -170,6 +311,13 @@ namespace PCGExMT
 
 		bool Contains(uint64 Key) const
 		{
+			if (UseTable(Key))
+			{
+				bool bOverflow = false;
+				if (Table.Find(Key, bOverflow)) { return true; }
+				if (!bOverflow) { return false; }
+			}
+
 			const uint32 Index = FastHashToShard(Key);
 			FReadScopeLock ScopeLock(Locks[Index]);
 			return Shards[Index].Contains(Key);
@@ -177,8 +325,9 @@ namespace PCGExMT
 
 		void Collapse(TMap<uint64, T>& OutMerged)
 		{
-			int32 Num = 0;
-			for (int32 i = 0; i < NumShards; i++) { Num += Shards[i].Num(); }
+			Table.ForEach([&](const uint64 Key, T& Value) { OutMerged.Add(Key, MoveTemp(Value)); });
+			Table.Reset();
+
 			for (int32 i = 0; i < NumShards; i++)
 			{
 				OutMerged.Append(Shards[i]);
@@ -188,10 +337,38 @@ namespace PCGExMT
 
 		void Empty()
 		{
+			Table.Reset();
 			for (int32 i = 0; i < NumShards; i++) { Shards[i].Empty(); }
 		}
 
 	private:
+		FORCEINLINE bool UseTable(const uint64 Key) const { return Table.IsEnabled() && FTable::IsSupportedKey(Key); }
+
+		// Runs Func(T& Value, bool bIsNew) with exclusive access to Key's slot. Returns nullptr if the key belongs to the shards.
+		template <typename TFunc>
+		T* TableUpdate(const uint64 Key, TFunc&& Func)
+		{
+			if (!UseTable(Key)) { return nullptr; }
+
+			bool bClaimed = false;
+			FSlot* Slot = Table.FindOrClaim(Key, bClaimed);
+			if (!Slot) { return nullptr; }
+
+			if (bClaimed)
+			{
+				Func(Slot->Value, true);
+				FTable::Publish(*Slot);
+			}
+			else
+			{
+				const bool bIsNew = FTable::Lock(*Slot);
+				Func(Slot->Value, bIsNew);
+				FTable::Unlock(*Slot);
+			}
+
+			return &Slot->Value;
+		}
+
 		FORCEINLINE uint32 FastHashToShard(uint64 Value) const
 		{
 			return static_cast<uint32>((Value * 2654435761ULL) >> (64 - Log2NumShards));
@@ -217,6 +394,92 @@ namespace PCGExMT
 		}
 	};
 
+	/**
+	 * Per-scope output ranges for two-pass "count then scatter" accumulation.
+	 * Scopes first report how many items they will emit, Compile turns counts into offsets,
+	 * then each scope writes straight into its own range of the final array. No per-scope container, no merge pass.
+	 */
+	class FScopedOffsets
+	{
+		TArray<int32> Counts;
+		TArray<int32> Starts;
+		int32 Total = 0;
+
+	public:
+		explicit FScopedOffsets(const int32 NumScopes)
+		{
+			Counts.Init(0, NumScopes);
+		}
+
+		explicit FScopedOffsets(const TArray<FScope>& InScopes)
+			: FScopedOffsets(InScopes.Num())
+		{
+		}
+
+		FORCEINLINE void SetCount(const int32 ScopeIndex, const int32 Count) { Counts[ScopeIndex] = Count; }
+		FORCEINLINE void SetCount(const FScope& InScope, const int32 Count) { Counts[InScope.LoopIndex] = Count; }
+
+		/** Exclusive prefix sum over reported counts. Returns the total item count. */
+		int32 Compile()
+		{
+			Starts.SetNumUninitialized(Counts.Num());
+
+			Total = 0;
+			for (int32 i = 0; i < Counts.Num(); i++)
+			{
+				Starts[i] = Total;
+				Total += Counts[i];
+			}
+
+			return Total;
+		}
+
+		FORCEINLINE int32 GetTotal() const { return Total; }
+		FORCEINLINE int32 GetCount(const int32 ScopeIndex) const { return Counts[ScopeIndex]; }
+		FORCEINLINE int32 GetStart(const int32 ScopeIndex) const { return Starts[ScopeIndex]; }
+
+		/** Scope's range in an array sized after Compile; Base is where the scattered items begin in that array */
+		template <typename T>
+		FORCEINLINE TArrayView<T> GetView(const int32 ScopeIndex, TArray<T>& InArray, const int32 Base = 0) const
+		{
+			return TArrayView<T>(InArray.GetData() + Base + Starts[ScopeIndex], Counts[ScopeIndex]);
+		}
+
+		template <typename T>
+		FORCEINLINE TArrayView<T> GetView(const FScope& InScope, TArray<T>& InArray, const int32 Base = 0) const
+		{
+			return GetView(InScope.LoopIndex, InArray, Base);
+		}
+	};
+
+	/**
+	 * Parallel count-then-scatter, appending to OutArray in slice order.
+	 * @param CountFunc int32(int32 Slice) : number of items the slice will emit
+	 * @param ScatterFunc void(int32 Slice, TArrayView<T> Range) : fills the slice's range, which is exactly as long as its count
+	 * @return Number of items appended
+	 */
+	template <typename T, typename TCountFunc, typename TScatterFunc>
+	int32 CountThenScatter(const int32 NumSlices, TArray<T>& OutArray, TCountFunc&& CountFunc, TScatterFunc&& ScatterFunc)
+	{
+		FScopedOffsets Offsets(NumSlices);
+		ParallelFor(NumSlices, [&](const int32 i) { Offsets.SetCount(i, CountFunc(i)); });
+
+		const int32 Total = Offsets.Compile();
+		if (!Total) { return 0; }
+
+		const int32 Base = OutArray.Num();
+		if constexpr (std::is_trivially_copyable_v<T>) { OutArray.SetNumUninitialized(Base + Total); }
+		else { OutArray.SetNum(Base + Total); }
+
+		ParallelFor(NumSlices, [&](const int32 i)
+		{
+			if (!Offsets.GetCount(i)) { return; }
+			ScatterFunc(i, Offsets.GetView(i, OutArray, Base));
+		});
+
+		return Total;
+	}
+
 	template <typename T>
 	class TScopedArray final : public TSharedFromThis<TScopedArray<T>>
 	{
@@ -257,15 +520,17 @@ namespace PCGExMT
 
 		void Collapse(TArray<T>& InTarget)
 		{
-			int32 Reserve = 0;
-			for (int i = 0; i < Arrays.Num(); i++) { Reserve += Arrays[i]->Num(); }
-			InTarget.Reserve(Reserve);
-
-			for (int i = 0; i < Arrays.Num(); i++)
-			{
-				InTarget.Append(*Arrays[i].Get());
-				Arrays[i] = nullptr;
-			}
+			// Scopes move their content to their final offset in parallel, releasing their own array as they go
+			CountThenScatter(
+				Arrays.Num(), InTarget,
+				[&](const int32 i) { return Arrays[i]->Num(); },
+				[&](const int32 i, TArrayView<T> Range)
+				{
+					TArray<T>& Source = *Arrays[i].Get();
+					if constexpr (std::is_trivially_copyable_v<T>) { FMemory::Memcpy(Range.GetData(), Source.GetData(), Range.Num() * sizeof(T)); }
+					else { for (int32 j = 0; j < Range.Num(); j++) { Range[j] = MoveTemp(Source[j]); } }
+					Arrays[i] = nullptr;
+				});
 
 			Arrays.Empty();
 		}
@@ -317,6 +582,22 @@ namespace PCGExMT
 
 			Sets.Empty();
 		}
+
+		/** Appends every scope's content to OutArray in parallel, without merging. Values shared by several scopes are kept once per scope. */
+		void Flatten(TArray<T>& OutArray)
+		{
+			CountThenScatter(
+				Sets.Num(), OutArray,
+				[&](const int32 i) { return Sets[i]->Num(); },
+				[&](const int32 i, TArrayView<T> Range)
+				{
+					int32 WriteIndex = 0;
+					for (const T& Value : *Sets[i].Get()) { Range[WriteIndex++] = Value; }
+					Sets[i] = nullptr;
+				});
+
+			Sets.Empty();
+		}
 	};
 
 	template <typename T>
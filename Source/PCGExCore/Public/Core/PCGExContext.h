@@ -23,6 +23,7 @@ class FPCGExUniqueNameGenerator;
 namespace PCGExMT
 {
 	class FAsyncToken;
+	class FArena;
 }
 
 class UPCGExInstancedFactory;
@@ -208,6 +209,9 @@ public:
 
 	TSharedPtr<PCGExData::IBufferProxyPool> BufferProxyPool;
 
+	// Transient allocations that live as long as this execution, released in bulk when the context goes away
+	TSharedPtr<PCGExMT::FArena> Arena;
+
 	virtual bool CancelExecution(const FString& InReason = FString());
 
 protected:
@@ -395,4 +395,78 @@ namespace PCGExMT
 	protected:
 		virtual bool Execute() override;
 	};
+
+	//
+	// FResumableJob - Cooperative time-slicing on worker threads, for algorithms with no parallel decomposition
+	//
+	// Each slice runs as its own task and should poll ShouldYield(), returning false to be resumed later.
+	// The worker is handed back to the scheduler between slices, and cancellation is honored at the next yield.
+	//
+	class PCGEXCORE_API FResumableJob : public TSharedFromThis<FResumableJob>
+	{
+		friend class FResumableJobTask;
+
+	public:
+		// Runs a slice of work, returns true once the job is done. State must be kept outside so the next slice can resume.
+		using FSliceCallback = std::function<bool(const FResumableJob&)>;
+		FSliceCallback OnSliceCallback;
+		FCompletionCallback OnCompleteCallback;
+
+		double SliceBudget = 0.005; // Seconds
+
+		FResumableJob() = default;
+		virtual ~FResumableJob() = default;
+
+		bool Start(const TSharedPtr<IAsyncHandleGroup>& InParent);
+
+		bool ShouldYield() const;
+		bool IsCancelled() const;
+
+		void SetProgress(const float InProgress) const { Progress.store(FMath::Clamp(InProgress, 0.f, 1.f), std::memory_order_relaxed); }
+		float GetProgress() const { return Progress.load(std::memory_order_relaxed); }
+		int32 GetNumSlices() const { return NumSlices; }
+
+	protected:
+		mutable std::atomic<float> Progress{0};
+		int32 NumSlices = 0;
+
+		// Only valid while a slice is running
+		double SliceEndTime = 0;
+		const FTask* ActiveTask = nullptr;
+		const FTaskManager* ActiveManager = nullptr;
+
+		virtual bool ExecuteSlice();
+	};
+
+	// Worker-side counterpart of FTimeSlicedMainThreadLoop
+	class PCGEXCORE_API FResumableLoop : public FResumableJob
+	{
+	protected:
+		FScope Scope = FScope{};
+		int32 NumIterations = 0;
+
+	public:
+		using FIterationCallback = std::function<void(const int32, const FScope&)>;
+		FIterationCallback OnIterationCallback;
+
+		explicit FResumableLoop(const int32 InNumIterations);
+
+	protected:
+		virtual bool ExecuteSlice() override;
+	};
+
+	class PCGEXCORE_API FResumableJobTask final : public FTask
+	{
+	public:
+		PCGEX_ASYNC_TASK_NAME(FResumableJobTask)
+
+		explicit FResumableJobTask(const TSharedPtr<FResumableJob>& InJob)
+			: FTask(), Job(InJob)
+		{
+		}
+
+		TSharedPtr<FResumableJob> Job;
+
+		virtual void ExecuteTask(const TSharedPtr<FTaskManager>& TaskManager) override;
+	};
 }
@@ -8,6 +8,7 @@
 #include "PCGExOBB.h"
 #include "PCGExOBBTests.h"
 #include "PCGExOBBIntersections.h"
+#include "PCGExOBBPacked.h"
 #include "PCGExOctree.h"
 #include "Math/PCGExMathBounds.h"
 
@@ -37,6 +38,14 @@ namespace PCGExMath::OBB
 		TUniquePtr<PCGExOctree::FItemOctree> Octree;
 		FBox WorldBounds = FBox(ForceInit);
 
+		// SoA copy used by SAT queries on large collections
+		TUniquePtr<FPackedCollection> Packed;
+
+		FORCEINLINE bool UsePacked(const EPCGExBoxCheckMode Mode) const
+		{
+			return Packed && (Mode == EPCGExBoxCheckMode::Box || Mode == EPCGExBoxCheckMode::ExpandedBox);
+		}
+
 	public:
 		FCollection() = default;
 
@@ -48,6 +57,7 @@ namespace PCGExMath::OBB
 
 		void Add(const FTransform& Transform, const FBox& LocalBox, int32 Index = -1);
 
+		/** Builds the octree, and the packed SoA copy if the collection is large enough to benefit from it */
 		void BuildOctree();
 
 		void Reset();
@@ -0,0 +1,105 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExOBB.h"
+
+namespace PCGExMath::OBB
+{
+	/**
+	 * Structure-of-arrays copy of a set of OBBs, packed by groups of four so a single SAT test covers a whole packet.
+	 * Boxes are ordered along a Hilbert curve, and packets are indexed by a BVH built bottom-up over that order.
+	 * Only supports SAT overlap (Box & ExpandedBox modes), sphere modes don't benefit from it.
+	 */
+	class PCGEXCORE_API FPackedCollection
+	{
+	public:
+		static constexpr int32 Width = 4;
+
+		// Rows stored per packet : center (3), X/Y/Z axes (9), extents (3)
+		static constexpr int32 NumRows = 15;
+
+		struct FQuery
+		{
+			float Origin[3];
+			float Axes[3][3];
+			float Extents[3];
+			FBox Bounds = FBox(ForceInit);
+		};
+
+	protected:
+		struct FNode
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Left = -1;
+			int32 Right = -1;
+			int32 FirstPacket = 0;
+			int32 NumPackets = 0; // > 0 for leaves
+		};
+
+		FVector Pivot = FVector::ZeroVector; // Centers are stored relative to it, so float precision holds far from the origin
+		int32 NumPackets = 0;
+
+		TArray<float, TAlignedHeapAllocator<16>> Rows; // [Packet][Row][Lane]
+		TArray<int32> Items;                           // [Packet * Width + Lane] -> Index of the box in the source arrays, -1 for padding
+		TArray<FNode> Nodes;                           // Root is last
+
+	public:
+		FPackedCollection() = default;
+
+		void Build(TConstArrayView<FBounds> InBounds, TConstArrayView<FOrientation> InOrientations);
+		void Reset();
+
+		FORCEINLINE bool IsEmpty() const { return Nodes.IsEmpty(); }
+
+		FQuery MakeQuery(const FOBB& InQuery, const float Expansion) const;
+
+		/** Returns a bitmask of the packet lanes whose box overlaps the query. Expansion is applied to packed boxes. */
+		uint32 TestPacket(const FQuery& Query, const int32 Packet, const float Expansion) const;
+
+		/**
+		 * Calls Func(int32 Index) for each box overlapping the query, Index being its position in the arrays the collection was built from.
+		 * Func returns false to stop the search. Returns false if the search was stopped.
+		 */
+		template <typename FOverlapFunc>
+		bool ForEachOverlap(const FOBB& InQuery, const float Expansion, FOverlapFunc&& Func) const
+		{
+			if (Nodes.IsEmpty()) { return true; }
+
+			const FQuery Query = MakeQuery(InQuery, Expansion);
+
+			TArray<int32, TInlineAllocator<64>> Stack;
+			Stack.Add(Nodes.Num() - 1);
+
+			while (!Stack.IsEmpty())
+			{
+				const FNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+				if (!Node.Bounds.Intersect(Query.Bounds)) { continue; }
+
+				if (!Node.NumPackets)
+				{
+					Stack.Add(Node.Left);
+					if (Node.Right != -1) { Stack.Add(Node.Right); }
+					continue;
+				}
+
+				for (int32 Packet = Node.FirstPacket; Packet < Node.FirstPacket + Node.NumPackets; Packet++)
+				{
+					uint32 Mask = TestPacket(Query, Packet, Expansion);
+					while (Mask)
+					{
+						const int32 Lane = FMath::CountTrailingZeros(Mask);
+						Mask &= Mask - 1;
+
+						const int32 Index = Items[Packet * Width + Lane];
+						if (Index != -1 && !Func(Index)) { return false; }
+					}
+				}
+			}
+
+			return true;
+		}
+	};
+}
@@ -0,0 +1,180 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExSpatial
+{
+	/**
+	 * Uniform grid over a static set of positions, for fixed-radius neighborhood queries.
+	 * Positions are sorted by cell so each occupied cell maps to a contiguous range, and occupied cells are found through an open-addressing table.
+	 * Best suited to radii in the order of the cell size over fairly uniform densities; otherwise prefer an octree.
+	 * Built in parallel. Queries are read-only and can run concurrently.
+	 */
+	class PCGEXCORE_API FHashGrid : public TSharedFromThis<FHashGrid>
+	{
+	protected:
+		FVector Origin = FVector::ZeroVector;
+		double CellSize = 1;
+		double InvCellSize = 1;
+
+		TArray<FVector> Positions; // Sorted by cell
+		TArray<int32> Indices;     // Original index of each sorted position
+
+		TArray<uint64> CellKeys;
+		TArray<int32> CellStarts; // Range of each cell in Positions, one extra entry at the end
+		FIntVector MinCell = FIntVector(0);
+		FIntVector MaxCell = FIntVector(-1);
+
+		TArray<int32> Table;
+		uint32 TableMask = 0;
+
+	public:
+		FHashGrid() = default;
+
+		/**
+		 * Sort positions into cells. Runs in parallel.
+		 * @param InCellSize Cell size, ideally close to the query radius. Grown if needed so the positions' bounds fit in 2^21 cells per axis.
+		 */
+		void Build(TConstArrayView<FVector> InPositions, const double InCellSize);
+		void Build(TConstArrayView<FTransform> InTransforms, const double InCellSize);
+
+		FORCEINLINE int32 Num() const { return Positions.Num(); }
+		FORCEINLINE bool IsEmpty() const { return Positions.IsEmpty(); }
+		FORCEINLINE double GetCellSize() const { return CellSize; }
+
+		/** Calls Func(Index) for every position inside InBox */
+		template <typename FFunc>
+		void ForEachInBox(const FBox& InBox, FFunc&& Func) const
+		{
+			ForEachCellInBox(InBox, [&](const int32 Cell)
+			{
+				for (int32 i = CellStarts[Cell]; i < CellStarts[Cell + 1]; i++) { if (InBox.IsInsideOrOn(Positions[i])) { Func(Indices[i]); } }
+			});
+		}
+
+		/** Calls Func(Index, DistSquared) for every position within InRadius of InCenter, inclusive */
+		template <typename FFunc>
+		void ForEachInRadius(const FVector& InCenter, const double InRadius, FFunc&& Func) const
+		{
+			const double RadiusSquared = InRadius * InRadius;
+			ForEachCellInBox(FBox(InCenter - FVector(InRadius), InCenter + FVector(InRadius)), [&](const int32 Cell)
+			{
+				for (int32 i = CellStarts[Cell]; i < CellStarts[Cell + 1]; i++)
+				{
+					const double DistSquared = FVector::DistSquared(InCenter, Positions[i]);
+					if (DistSquared <= RadiusSquared) { Func(Indices[i], DistSquared); }
+				}
+			});
+		}
+
+		/**
+		 * Closest position to InCenter, within InMaxRadius. Ties go to the lowest index.
+		 * @param InIgnoreIndex Optional index to skip, typically the query point itself
+		 * @return -1 if none was found
+		 */
+		int32 FindNearest(const FVector& InCenter, const double InMaxRadius = MAX_dbl, const int32 InIgnoreIndex = -1) const;
+
+		/**
+		 * Up to K closest positions to InCenter within InMaxRadius, sorted by distance then index.
+		 * @param InIgnoreIndex Optional index to skip, typically the query point itself
+		 */
+		void FindKNearest(const FVector& InCenter, const int32 K, TArray<int32>& OutIndices, const double InMaxRadius = MAX_dbl, const int32 InIgnoreIndex = -1) const;
+
+		/**
+		 * Calls Func(A, B, DistSquared) once for every pair of positions within InRadius of each other, with A < B.
+		 * Runs in parallel : Func is called concurrently, in no particular order.
+		 */
+		template <typename FFunc>
+		void ForEachPairInRadius(const double InRadius, FFunc&& Func) const
+		{
+			ParallelForCells([&](const int32 Cell)
+			{
+				ForEachPairInCell(Cell, InRadius, Func);
+			});
+		}
+
+		/** Same as ForEachPairInRadius, but gathers pairs (A < B) in a deterministic order */
+		void FindPairsInRadius(const double InRadius, TArray<FInt32Point>& OutPairs) const;
+
+	protected:
+		static constexpr int32 CellBias = 1 << 20;
+
+		FORCEINLINE FIntVector GetCell(const FVector& InPosition) const
+		{
+			const FVector Local = (InPosition - Origin) * InvCellSize;
+			return FIntVector(
+				static_cast<int32>(FMath::Clamp<double>(FMath::FloorToDouble(Local.X), -CellBias, CellBias - 1)),
+				static_cast<int32>(FMath::Clamp<double>(FMath::FloorToDouble(Local.Y), -CellBias, CellBias - 1)),
+				static_cast<int32>(FMath::Clamp<double>(FMath::FloorToDouble(Local.Z), -CellBias, CellBias - 1)));
+		}
+
+		static FORCEINLINE uint64 PackCell(const FIntVector& InCell)
+		{
+			return static_cast<uint64>(InCell.X + CellBias) << 42 | static_cast<uint64>(InCell.Y + CellBias) << 21 | static_cast<uint64>(InCell.Z + CellBias);
+		}
+
+		static FORCEINLINE uint32 HashCell(const uint64 InKey) { return static_cast<uint32>((InKey * 0x9E3779B97F4A7C15ULL) >> 32); }
+
+		/** Index of an occupied cell, -1 if the cell is empty */
+		FORCEINLINE int32 FindCell(const FIntVector& InCell) const
+		{
+			if (Table.IsEmpty()) { return -1; }
+
+			const uint64 Key = PackCell(InCell);
+			for (uint32 Slot = HashCell(Key) & TableMask;; Slot = (Slot + 1) & TableMask)
+			{
+				const int32 Cell = Table[Slot];
+				if (Cell == -1) { return -1; }
+				if (CellKeys[Cell] == Key) { return Cell; }
+			}
+		}
+
+		/** Calls Func(CellIndex) for every occupied cell overlapping InBox */
+		template <typename FFunc>
+		void ForEachCellInBox(const FBox& InBox, FFunc&& Func) const
+		{
+			const FIntVector Min = GetCell(InBox.Min);
+			const FIntVector Max = GetCell(InBox.Max);
+
+			for (int32 X = FMath::Max(Min.X, MinCell.X); X <= FMath::Min(Max.X, MaxCell.X); X++)
+			{
+				for (int32 Y = FMath::Max(Min.Y, MinCell.Y); Y <= FMath::Min(Max.Y, MaxCell.Y); Y++)
+				{
+					for (int32 Z = FMath::Max(Min.Z, MinCell.Z); Z <= FMath::Min(Max.Z, MaxCell.Z); Z++)
+					{
+						if (const int32 Cell = FindCell(FIntVector(X, Y, Z)); Cell != -1) { Func(Cell); }
+					}
+				}
+			}
+		}
+
+		void ParallelForCells(TFunctionRef<void(int32)> Func) const;
+
+		// Pairs whose lowest sorted position lies in Cell
+		template <typename FFunc>
+		void ForEachPairInCell(const int32 Cell, const double InRadius, FFunc&& Func) const
+		{
+			const double RadiusSquared = InRadius * InRadius;
+			for (int32 i = CellStarts[Cell]; i < CellStarts[Cell + 1]; i++)
+			{
+				const FVector& Position = Positions[i];
+				ForEachCellInBox(FBox(Position - FVector(InRadius), Position + FVector(InRadius)), [&](const int32 OtherCell)
+				{
+					for (int32 j = FMath::Max(i + 1, CellStarts[OtherCell]); j < CellStarts[OtherCell + 1]; j++)
+					{
+						const double DistSquared = FVector::DistSquared(Position, Positions[j]);
+						if (DistSquared > RadiusSquared) { continue; }
+
+						const int32 A = Indices[i];
+						const int32 B = Indices[j];
+						if (A < B) { Func(A, B, DistSquared); }
+						else { Func(B, A, DistSquared); }
+					}
+				});
+			}
+		}
+	};
+}
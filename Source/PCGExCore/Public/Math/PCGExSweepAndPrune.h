@@ -0,0 +1,24 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExMath::SweepAndPrune
+{
+	/**
+	 * Finds every (A, B) pair of overlapping boxes, using a parallel sort & sweep along the dominant axis.
+	 * Invalid boxes are ignored. Pairs are returned as (index in A, index in B), in a deterministic order.
+	 */
+	PCGEXCORE_API void FindOverlaps(TConstArrayView<FBox> InA, TConstArrayView<FBox> InB, TArray<FInt32Point>& OutPairs);
+
+	/** Same as above, within a single set of boxes. Each pair is returned once, with X < Y. */
+	PCGEXCORE_API void FindOverlaps(TConstArrayView<FBox> InBoxes, TArray<FInt32Point>& OutPairs);
+
+	/**
+	 * Groups pairs by their X component into compact adjacency lists.
+	 * Y values of X = i are OutAdjacency[OutOffsets[i]..OutOffsets[i + 1]], in the order they appear in InPairs.
+	 */
+	PCGEXCORE_API void GroupPairs(TConstArrayView<FInt32Point> InPairs, const int32 NumItems, TArray<int32>& OutOffsets, TArray<int32>& OutAdjacency);
+}
@@ -40,6 +40,10 @@ struct PCGEXCORE_API FPCGExCoreSettingsCache
 	bool bCacheClusters = true;
 	bool bDefaultScopedIndexLookupBuild = true;
 	bool bDefaultBuildAndCacheClusters = true;
+	bool bPersistentClusterCache = true;
+	int32 PersistentClusterCacheBudget = 256;
+	bool bClusterSnapshots = false;
+	int32 ClusterSnapshotsBudget = 1024;
 	EPCGExExecutionPolicy ExecutionPolicy = EPCGExExecutionPolicy::Default;
 
 	int32 SmallPointsSize = 1024;
@@ -50,6 +54,10 @@ struct PCGEXCORE_API FPCGExCoreSettingsCache
 	int32 PointsDefaultBatchChunkSize = 1024;
 	int32 GetPointsBatchChunkSize(const int32 In = -1) const { return FMath::Max(In <= -1 ? PointsDefaultBatchChunkSize : In, 1); }
 
+	bool bSizeAwareBatching = true;
+
+	int32 PathSegmentSize = 65536;
+
 	int32 ClusterDefaultBatchChunkSize = 512;
 	int32 GetClusterBatchChunkSize(const int32 In = -1) const { return FMath::Max(In <= -1 ? ClusterDefaultBatchChunkSize : In, 1); }
 
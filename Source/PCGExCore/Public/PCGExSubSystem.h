@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "Clusters/PCGExClusterCacheKey.h"
 
 #include "PCGExSubSystem.generated.h"
 
@@ -18,6 +19,11 @@ namespace PCGExPointFilter
 	class IFilter;
 }
 
+namespace PCGExClusters
+{
+	class FCluster;
+}
+
 class UPCGExGridIDTracker;
 
 UENUM()
@@ -60,6 +66,7 @@ class PCGEXCORE_API UPCGExSubSystem : public UTickableWorldSubsystem
 	FRWLock SubsystemLock;
 	FRWLock IndexBufferLock;
 	FRWLock BeaconsLock;
+	FRWLock ClusterCacheLock;
 
 public:
 	UPCGExSubSystem();
@@ -99,6 +106,37 @@ public:
 	TArrayView<const int32> GetIndexRange(const int32 Start, const int32 Count);
 
 
+#pragma endregion
+
+#pragma region Cluster cache
+
+	/** Fast path : clusters previously cached for this exact vtx/edges data pair */
+	TSharedPtr<PCGExClusters::FCluster> FindCachedClusterByData(const PCGExClusters::FClusterDataKey& InDataKey, PCGExClusters::FClusterContentKey* OutContentKey = nullptr);
+
+	/** Slow path : clusters previously built from identical content. Registers InDataKey as an alias on hit. */
+	TSharedPtr<PCGExClusters::FCluster> FindCachedClusterByContent(const PCGExClusters::FClusterDataKey& InDataKey, const PCGExClusters::FClusterContentKey& InContentKey);
+
+	void CacheCluster(const PCGExClusters::FClusterDataKey& InDataKey, const PCGExClusters::FClusterContentKey& InContentKey, const TSharedPtr<PCGExClusters::FCluster>& InCluster);
+	void FlushClusterCache();
+
+protected:
+	struct FCachedCluster
+	{
+		TSharedPtr<PCGExClusters::FCluster> Cluster;
+		TArray<PCGExClusters::FClusterDataKey> DataKeys;
+		SIZE_T Size = 0;
+		uint64 LastAccess = 0;
+	};
+
+	TMap<PCGExClusters::FClusterContentKey, FCachedCluster> CachedClusters;                  // Content key -> entry
+	TMap<PCGExClusters::FClusterDataKey, PCGExClusters::FClusterContentKey> CachedClusterAliases; // Data key -> content key
+	SIZE_T CachedClustersSize = 0;
+	uint64 ClusterCacheClock = 0;
+
+	void TrimClusterCache_Unsafe(const SIZE_T InBudget);
+	void RemoveCachedCluster_Unsafe(const PCGExClusters::FClusterContentKey& InContentKey);
+
+public:
 #pragma endregion
 
 	FORCEINLINE double GetEndTime() const { return EndTime; }
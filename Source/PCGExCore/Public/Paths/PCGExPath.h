@@ -57,6 +57,15 @@ namespace PCGExPaths
 
 	class FPath;
 
+	/**
+	 * Segmented processing, so a single very long path isn't bound to one core.
+	 * Ranges longer than the PathSegmentSize setting are split into contiguous segments run in parallel, shorter ones run as a single segment.
+	 * Func(const PCGExMT::FScope& Segment) may read up to Stencil items past either end of its segment but must only write inside it,
+	 * which keeps results identical to a sequential pass. Segment.LoopIndex is the segment's rank, for ordered merges of per-segment results.
+	 */
+	PCGEXCORE_API int32 GetNumSegments(const int32 NumItems, const int32 Stencil);
+	PCGEXCORE_API void ForEachSegment(const int32 NumItems, const int32 Stencil, const TFunctionRef<void(const PCGExMT::FScope&)>& Func);
+
 	class PCGEXCORE_API IPathEdgeExtra : public TSharedFromThis<IPathEdgeExtra>
 	{
 	protected:
@@ -75,6 +84,9 @@ namespace PCGExPaths
 		virtual void ProcessEdge(const FPath* Path, const FPathEdge& Edge) = 0;
 		virtual void ProcessLastEdge(const FPath* Path, const FPathEdge& Edge) { ProcessEdge(Path, Edge); }
 
+		/** Whether ProcessEdge only writes the edge's own slot, so edges can be processed out of order & concurrently */
+		virtual bool SupportsSegments() const { return true; }
+
 		virtual void ProcessingDone(const FPath* Path);
 	};
 
@@ -177,6 +189,9 @@ namespace PCGExPaths
 
 		void UpdateConvexity(const int32 Index);
 
+		/** Same as calling UpdateConvexity on every point in order, segmented on long paths */
+		void ComputeConvexity();
+
 		template <typename T, typename... Args>
 		TSharedPtr<T> AddExtra(const bool bImmediateCompute = false, Args&&... InArgs)
 		{
@@ -184,24 +199,7 @@ namespace PCGExPaths
 
 			if (bImmediateCompute)
 			{
-				if (NumEdges == 1)
-				{
-					Extra->ProcessSingleEdge(this, Edges[0]);
-				}
-				else
-				{
-					if (bClosedLoop)
-					{
-						for (int i = 0; i < NumEdges; ++i) { Extra->ProcessEdge(this, Edges[i]); }
-					}
-					else
-					{
-						Extra->ProcessFirstEdge(this, Edges[0]);
-						for (int i = 1; i < LastEdge; ++i) { Extra->ProcessEdge(this, Edges[i]); }
-						Extra->ProcessLastEdge(this, Edges[LastEdge]);
-					}
-				}
-
+				ProcessAllEdges({Extra}, !bClosedLoop);
 				Extra->ProcessingDone(this);
 			}
 			else
@@ -243,6 +241,9 @@ namespace PCGExPaths
 
 	protected:
 		void BuildPath(const double Expansion);
+
+		/** Runs extras over every edge, middle edges are segmented when all extras support it. Without ends, every edge goes through ProcessEdge. */
+		void ProcessAllEdges(TConstArrayView<TSharedPtr<IPathEdgeExtra>> InExtras, const bool bProcessEnds) const;
 	};
 
 #pragma region Edge Extras
@@ -263,6 +264,9 @@ namespace PCGExPaths
 		{
 			this->SetValue(Edge.Start, ProcessEdgeCallback(Path, Edge));
 		}
+
+		// Callbacks may not be thread-safe
+		virtual bool SupportsSegments() const override { return false; }
 	};
 
 	class PCGEXCORE_API FPathEdgeLength : public TPathEdgeExtra<double>
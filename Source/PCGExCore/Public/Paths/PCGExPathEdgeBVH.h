@@ -0,0 +1,79 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExPaths
+{
+	class FPath;
+
+	/**
+	 * BVH over the edges of a whole collection of paths, built once and shared by all queries.
+	 * Leaves are sorted along X so queries sweep-and-prune their content instead of testing every item.
+	 */
+	class PCGEXCORE_API FPathEdgeBVH : public TSharedFromThis<FPathEdgeBVH>
+	{
+	public:
+		struct FItem
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 PathIndex = -1; // Index in the paths array the BVH was built from
+			int32 EdgeIndex = -1;
+		};
+
+		struct FNode
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Start = 0;  // First item (leaf) or first child (inner)
+			int32 Count = -1; // Item count if leaf, -1 otherwise
+		};
+
+	protected:
+		TArray<FItem> Items;
+		TArray<FNode> Nodes;
+
+	public:
+		FPathEdgeBVH() = default;
+
+		/**
+		 * Gather edges & build the hierarchy. Both steps run in parallel.
+		 * @param InPaths Paths to gather edges from. Null entries are skipped.
+		 * @param InFilters Optional per-path edge filters, index-aligned with InPaths. Null entries mean all edges.
+		 */
+		void Build(const TArray<TSharedPtr<FPath>>& InPaths, const TArray<const TBitArray<>*>& InFilters = {});
+
+		FORCEINLINE bool IsValid() const { return !Nodes.IsEmpty(); }
+		FORCEINLINE int32 Num() const { return Items.Num(); }
+
+		/** Calls Func(const FItem&) for every edge whose bounds overlap InBounds */
+		template <typename FItemFunc>
+		void FindOverlaps(const FBox& InBounds, FItemFunc&& Func) const
+		{
+			if (Nodes.IsEmpty() || !Nodes[0].Bounds.Intersect(InBounds)) { return; }
+
+			TArray<int32, TInlineAllocator<64>> Stack;
+			Stack.Add(0);
+
+			while (!Stack.IsEmpty())
+			{
+				const FNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+
+				if (Node.Count < 0)
+				{
+					if (Nodes[Node.Start].Bounds.Intersect(InBounds)) { Stack.Add(Node.Start); }
+					if (Nodes[Node.Start + 1].Bounds.Intersect(InBounds)) { Stack.Add(Node.Start + 1); }
+					continue;
+				}
+
+				for (int32 i = Node.Start; i < Node.Start + Node.Count; i++)
+				{
+					const FItem& Item = Items[i];
+					if (Item.Bounds.Min.X > InBounds.Max.X) { break; } // Sorted along X, nothing further can overlap
+					if (Item.Bounds.Intersect(InBounds)) { Func(Item); }
+				}
+			}
+		}
+	};
+}
@@ -0,0 +1,69 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utils/PCGValueRange.h"
+
+class UPCGBasePointData;
+
+namespace PCGExPaths
+{
+	/**
+	 * Path positions as structure-of-arrays, loaded once.
+	 * Kernels below run straight loops over contiguous components so they vectorize,
+	 * instead of going through FTransforms & FPath accessors point by point.
+	 */
+	class PCGEXCORE_API FPathSoA
+	{
+	public:
+		TArray<double> X;
+		TArray<double> Y;
+		TArray<double> Z;
+
+		/** Arc length from the first point to each point. Closed loops get one extra entry : the length back to the first point. */
+		TArray<double> Cumulative;
+
+		bool bClosedLoop = false;
+
+		FPathSoA() = default;
+
+		void Load(const UPCGBasePointData* InPointData);
+		void Load(const TConstPCGValueRange<FTransform>& InTransforms, const bool bInClosedLoop);
+
+		FORCEINLINE int32 Num() const { return X.Num(); }
+		FORCEINLINE int32 NumEdges() const { return bClosedLoop ? X.Num() : X.Num() - 1; }
+		FORCEINLINE double GetLength() const { return Cumulative.IsEmpty() ? 0 : Cumulative.Last(); }
+
+		FORCEINLINE int32 GetEdgeEnd(const int32 Edge) const { return Edge + 1 == X.Num() ? 0 : Edge + 1; }
+		FORCEINLINE double GetEdgeLength(const int32 Edge) const { return Cumulative[Edge + 1] - Cumulative[Edge]; }
+
+		FORCEINLINE FVector GetPos(const int32 Index) const { return FVector(X[Index], Y[Index], Z[Index]); }
+	};
+
+	/** Samples along a path, as structure-of-arrays too. Distances are the input, everything else is filled by Kernels::Sample. */
+	struct PCGEXCORE_API FPathSamples
+	{
+		TArray<double> Distances;
+		TArray<int32> Edges;
+		TArray<double> Alphas; // Position along the edge, 0 at its start & 1 at its end
+		TArray<double> X;
+		TArray<double> Y;
+		TArray<double> Z;
+
+		void SetNum(const int32 InNum);
+
+		FORCEINLINE int32 Num() const { return Distances.Num(); }
+		FORCEINLINE FVector GetPos(const int32 Index) const { return FVector(X[Index], Y[Index], Z[Index]); }
+	};
+
+	namespace Kernels
+	{
+		/**
+		 * Locate every sample distance along the path in a single merge pass, then interpolate their positions.
+		 * Distances must be ascending; those beyond the path ends are clamped to it.
+		 */
+		PCGEXCORE_API void Sample(const FPathSoA& InPath, FPathSamples& InOutSamples);
+	}
+}
@@ -30,12 +30,15 @@ namespace PCGExData
 
 namespace PCGExPaths
 {
+	class FSplineBVH;
+
 	class PCGEXCORE_API FPolyPath : public FPath
 	{
 		TSharedPtr<FPCGSplineStruct> LocalSpline;
 		TArray<FTransform> LocalTransforms;
 
 		const FPCGSplineStruct* Spline = nullptr;
+		TSharedPtr<FSplineBVH> SplineBVH;
 
 	public:
 		FPolyPath(
@@ -64,9 +67,14 @@ namespace PCGExPaths
 #endif
 
 		FORCEINLINE const FPCGSplineStruct* GetSpline() const { return Spline; }
+		FORCEINLINE const FSplineBVH* GetSplineBVH() const { return SplineBVH.Get(); }
+
+		/** Build a segment BVH to accelerate closest-key lookups. Once built, all GetClosest* queries go through it. */
+		void BuildSplineBVH(const double Tolerance = 1);
 
 	protected:
 		void InitFromTransforms(const EPCGExWindingMutation WindingMutation = EPCGExWindingMutation::Unchanged);
+		float FindClosestKey(const FVector& WorldPosition) const;
 
 	public:
 		virtual FTransform GetClosestTransform(const FVector& WorldPosition, int32& OutEdgeIndex, float& OutLerp, const bool bUseScale = false) const override;
@@ -0,0 +1,96 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPCGSplineStruct;
+
+namespace PCGExPaths
+{
+	/**
+	 * A tessellated chunk of spline, expressed in spline local space.
+	 * Slack is an upper bound of the distance between the chord and the actual curve, derived from the curve's control points.
+	 */
+	struct PCGEXCORE_API FSplineSegment
+	{
+		FVector Start = FVector::ZeroVector;
+		FVector End = FVector::ZeroVector;
+		double KeyStart = 0;
+		double KeyEnd = 0;
+		double Slack = 0;
+
+		FSplineSegment() = default;
+
+		FSplineSegment(const FVector& InStart, const FVector& InEnd, const double InKeyStart, const double InKeyEnd, const double InSlack)
+			: Start(InStart), End(InEnd), KeyStart(InKeyStart), KeyEnd(InKeyEnd), Slack(InSlack)
+		{
+		}
+
+		FORCEINLINE FBox GetBounds() const { return FBox(Start.ComponentMin(End), Start.ComponentMax(End)).ExpandBy(Slack); }
+		FORCEINLINE FVector GetCenter() const { return (Start + End) * 0.5; }
+	};
+
+	/**
+	 * BVH over adaptively tessellated spline segments.
+	 * Nearest queries descend the tree to find candidate segments, then refine the input key
+	 * with a few Newton iterations restricted to the winning segments' key range.
+	 * Drop-in replacement for FPCGSplineStruct::FindInputKeyClosestToWorldLocation.
+	 */
+	class PCGEXCORE_API FSplineBVH : public TSharedFromThis<FSplineBVH>
+	{
+	public:
+		struct FNode
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Start = 0;  // First segment (leaf) or first child (inner)
+			int32 Count = -1; // Segment count if leaf, -1 otherwise
+		};
+
+	protected:
+		const FPCGSplineStruct* Spline = nullptr;
+		FTransform SplineTransform = FTransform::Identity;
+
+		TArray<FSplineSegment> Segments;
+		TArray<FNode> Nodes;
+
+		FBox LocalBounds = FBox(ForceInit);
+		FBox WorldBounds = FBox(ForceInit);
+
+	public:
+		/**
+		 * @param InSpline Spline to build from. Must outlive this object.
+		 * @param Tolerance Maximum chord deviation (local space) before a segment gets subdivided. Only affects query speed.
+		 * @param MaxDepth Maximum number of subdivisions per spline segment.
+		 */
+		explicit FSplineBVH(const FPCGSplineStruct& InSpline, const double Tolerance = 1, const int32 MaxDepth = 6);
+
+		FORCEINLINE const FPCGSplineStruct* GetSpline() const { return Spline; }
+		FORCEINLINE const FBox& GetWorldBounds() const { return WorldBounds; }
+		FORCEINLINE const TArray<FSplineSegment>& GetSegments() const { return Segments; }
+		FORCEINLINE bool IsValid() const { return !Nodes.IsEmpty(); }
+
+		/** Input key on the spline closest to the given world location. */
+		double FindInputKeyClosestToWorldLocation(const FVector& WorldLocation) const;
+
+		/** Same as above, but returns false if nothing on the spline is closer than MaxDistance (world space). */
+		bool FindInputKeyClosestToWorldLocation(const FVector& WorldLocation, const double MaxDistance, double& OutKey) const;
+
+		/** Closest transform on the spline, same semantic as PCGExPaths::Helpers::GetClosestTransform */
+		FTransform GetClosestTransform(const FVector& WorldLocation, const bool bUseScale = true) const;
+
+	protected:
+		void Tessellate(const double Tolerance, const int32 MaxDepth);
+		void BuildNode(const int32 NodeIndex, const int32 Start, const int32 Count, const TArray<FVector>& Centers, TArray<int32>& Order);
+
+		double RefineKey(const FVector& LocalLocation, const FSplineSegment& Segment, double& OutDistSquared) const;
+		bool FindClosestLocal(const FVector& LocalLocation, const double MaxDistSquared, double& OutKey) const;
+	};
+
+	namespace Helpers
+	{
+		/** Build one BVH per spline, in parallel. Output is index-aligned with input. */
+		PCGEXCORE_API void BuildSplineBVHs(const TArray<const FPCGSplineStruct*>& InSplines, TArray<TSharedPtr<FSplineBVH>>& OutBVHs, const double Tolerance = 1);
+	}
+}
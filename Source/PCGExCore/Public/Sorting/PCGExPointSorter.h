@@ -101,6 +101,7 @@ namespace PCGExSorting
 			TArray<double> Values;
 			double Tolerance = DBL_COMPARE_TOLERANCE;
 			bool bInvertRule = false;
+			bool bConstant = false; // Tag-based, same value for every element
 		};
 
 	private:
@@ -121,6 +122,13 @@ namespace PCGExSorting
 		/** Get number of rules */
 		FORCEINLINE int32 NumRules() const { return CachedNumRules; }
 
+		/**
+		 * Key-extraction sort. Each rule's values are mapped to order-preserving integer keys, snapped to the rule tolerance,
+		 * then radix sorted one rule at a time from the last to the first. Ties keep their relative order in InOutIndices.
+		 * Much faster than sorting with Compare on large inputs; results only differ for values straddling a tolerance step.
+		 */
+		void Sort(TArray<int32>& InOutIndices) const;
+
 		/** Fast comparison using cached values. No virtual calls. */
 		FORCEINLINE bool Compare(const int32 A, const int32 B) const
 		{
@@ -16,6 +16,13 @@ enum class EPCGExSortDirection : uint8
 	Descending = 1 UMETA(DisplayName = "Descending", ToolTip = "Descending", ActionIcon="Descending")
 };
 
+UENUM()
+enum class EPCGExSpaceFillingCurve : uint8
+{
+	Morton  = 0 UMETA(DisplayName = "Morton (Z-Order)", ToolTip = "Interleave quantized coordinates. Cheap, but the curve jumps across cell boundaries."),
+	Hilbert = 1 UMETA(DisplayName = "Hilbert", ToolTip = "Hilbert curve. Slightly more expensive keys, but neighbors along the curve are always spatially adjacent.")
+};
+
 namespace PCGExSorting::Labels
 {
 	const FName SourceSortingRules = TEXT("SortRules");
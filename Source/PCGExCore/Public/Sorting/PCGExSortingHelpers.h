@@ -32,6 +32,14 @@ namespace PCGExSortingHelpers
 		}
 	};
 
+	/** Maps a double to a key whose unsigned order matches the value order. -0 and +0 share a key. */
+	FORCEINLINE uint64 ToSortableKey(const double Value)
+	{
+		constexpr uint64 SignBit = 1ULL << 63;
+		const uint64 Bits = FPlatformMath::AsUInt(Value == 0 ? 0.0 : Value);
+		return (Bits & SignBit) ? ~Bits : Bits | SignBit;
+	}
+
 	static void RadixSort(TArray<FIndexKey>& Keys)
 	{
 		const int32 N = Keys.Num();
@@ -73,4 +81,7 @@ namespace PCGExSortingHelpers
 			Swap(Curr, Out);
 		}
 	}
+
+	/** Same as RadixSort, but histograms & scatter are split across workers. Small inputs fall back to the serial version. */
+	PCGEXCORE_API void ParallelRadixSort(TArray<FIndexKey>& Keys);
 }
@@ -0,0 +1,80 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Sorting/PCGExSortingCommon.h"
+
+class UPCGBasePointData;
+
+namespace PCGExSorting
+{
+	/** Bits per axis of spatial keys, three axes fit in 63 bits */
+	constexpr int32 SpatialKeyBits = 21;
+	constexpr uint32 SpatialKeyMax = (1U << SpatialKeyBits) - 1;
+
+	/** Spreads the lowest 21 bits of V so there are two zero bits between each of them */
+	FORCEINLINE uint64 SpreadBits3(const uint32 V)
+	{
+		uint64 X = V & SpatialKeyMax;
+		X = (X | X << 32) & 0x1f00000000ffffULL;
+		X = (X | X << 16) & 0x1f0000ff0000ffULL;
+		X = (X | X << 8) & 0x100f00f00f00f00fULL;
+		X = (X | X << 4) & 0x10c30c30c30c30c3ULL;
+		X = (X | X << 2) & 0x1249249249249249ULL;
+		return X;
+	}
+
+	FORCEINLINE uint64 MortonKey(const uint32 X, const uint32 Y, const uint32 Z)
+	{
+		return SpreadBits3(X) | (SpreadBits3(Y) << 1) | (SpreadBits3(Z) << 2);
+	}
+
+	/** Hilbert index of quantized coordinates, using Skilling's transpose form */
+	FORCEINLINE uint64 HilbertKey(const uint32 X, const uint32 Y, const uint32 Z)
+	{
+		uint32 A[3] = {X & SpatialKeyMax, Y & SpatialKeyMax, Z & SpatialKeyMax};
+
+		// Inverse undo
+		for (uint32 Q = 1U << (SpatialKeyBits - 1); Q > 1; Q >>= 1)
+		{
+			const uint32 P = Q - 1;
+			for (int32 i = 0; i < 3; i++)
+			{
+				if (A[i] & Q) { A[0] ^= P; }
+				else
+				{
+					const uint32 T = (A[0] ^ A[i]) & P;
+					A[0] ^= T;
+					A[i] ^= T;
+				}
+			}
+		}
+
+		// Gray encode
+		A[1] ^= A[0];
+		A[2] ^= A[1];
+
+		uint32 T = 0;
+		for (uint32 Q = 1U << (SpatialKeyBits - 1); Q > 1; Q >>= 1) { if (A[2] & Q) { T ^= Q - 1; } }
+
+		A[0] ^= T;
+		A[1] ^= T;
+		A[2] ^= T;
+
+		// Transposed form is read most significant axis first
+		return MortonKey(A[2], A[1], A[0]);
+	}
+
+	/**
+	 * Computes the order in which positions should be read so they follow a space-filling curve.
+	 * Keys are computed in parallel over a cubic quantization of the positions' bounds, then radix sorted.
+	 * @param OutOrder OutOrder[i] is the index of the position that should end up at i.
+	 */
+	PCGEXCORE_API void ComputeSpatialOrder(TConstArrayView<FVector> InPositions, TArray<int32>& OutOrder, const EPCGExSpaceFillingCurve Curve = EPCGExSpaceFillingCurve::Hilbert);
+	PCGEXCORE_API void ComputeSpatialOrder(const UPCGBasePointData* InPointData, TArray<int32>& OutOrder, const EPCGExSpaceFillingCurve Curve = EPCGExSpaceFillingCurve::Hilbert);
+
+	/** OutInverse[Order[i]] = i, i.e maps an original index to its position after reordering */
+	PCGEXCORE_API void InvertOrder(TConstArrayView<int32> InOrder, TArray<int32>& OutInverse);
+}
@@ -82,7 +82,15 @@ namespace PCGExClipper2
 
 	void FProcessingGroup::PreProcess(const UPCGExClipper2ProcessorSettings* InSettings)
 	{
-		if (InSettings->bUnionGroupBeforeOperation && SubjectPaths.size() > 1)
+		const bool bCascade = InSettings->bCascadeUnion;
+
+		if (InSettings->bUnionGroupBeforeOperation && bCascade && OpenSubjectPaths.empty() && static_cast<int32>(SubjectPaths.size()) > InSettings->CascadeTileSize)
+		{
+			PCGExClipper2Lib::Paths64 Union;
+			CascadedUnion(SubjectPaths, PCGExClipper2Lib::FillRule::NonZero, CreateZCallback(), InSettings->CascadeTileSize, Union);
+			SubjectPaths = MoveTemp(Union);
+		}
+		else if (InSettings->bUnionGroupBeforeOperation && SubjectPaths.size() > 1)
 		{
 			PCGExClipper2Lib::Paths64 Union;
 			PCGExClipper2Lib::Clipper64 Clipper;
@@ -93,7 +101,13 @@ namespace PCGExClipper2
 			SubjectPaths = Union;
 		}
 
-		if (InSettings->bUnionOperandsBeforeOperation && OperandPaths.size() > 1)
+		if (InSettings->bUnionOperandsBeforeOperation && bCascade && OpenOperandPaths.empty() && static_cast<int32>(OperandPaths.size()) > InSettings->CascadeTileSize)
+		{
+			PCGExClipper2Lib::Paths64 Union;
+			CascadedUnion(OperandPaths, PCGExClipper2Lib::FillRule::NonZero, CreateZCallback(), InSettings->CascadeTileSize, Union);
+			OperandPaths = MoveTemp(Union);
+		}
+		else if (InSettings->bUnionOperandsBeforeOperation && OperandPaths.size() > 1)
 		{
 			PCGExClipper2Lib::Paths64 Union;
 			PCGExClipper2Lib::Clipper64 Clipper;
@@ -118,6 +132,16 @@ namespace PCGExClipper2
 		return IntersectionBlendInfos.Find(Key);
 	}
 
+	bool FProcessingGroup::FindIntersectionBlendInfo(int64_t X, int64_t Y, FIntersectionBlendInfo& OutInfo) const
+	{
+		const uint64 Key = PCGEx::H64(static_cast<uint32>(X & 0xFFFFFFFF), static_cast<uint32>(Y & 0xFFFFFFFF));
+		FScopeLock Lock(&IntersectionLock);
+		const FIntersectionBlendInfo* Info = IntersectionBlendInfos.Find(Key);
+		if (!Info) { return false; }
+		OutInfo = *Info;
+		return true;
+	}
+
 	PCGExClipper2Lib::ZCallback64 FProcessingGroup::CreateZCallback()
 	{
 		TWeakPtr<FProcessingGroup> WeakSelf = AsWeak();
@@ -130,17 +154,6 @@ namespace PCGExClipper2
 			TSharedPtr<FProcessingGroup> Group = WeakSelf.Pin();
 			if (!Group) { return; }
 
-			// Decode the source info from each vertex
-			uint32 E1BotPtIdx, E1BotSrcIdx;
-			uint32 E1TopPtIdx, E1TopSrcIdx;
-			uint32 E2BotPtIdx, E2BotSrcIdx;
-			uint32 E2TopPtIdx, E2TopSrcIdx;
-
-			PCGEx::H64(static_cast<uint64>(e1bot.z), E1BotPtIdx, E1BotSrcIdx);
-			PCGEx::H64(static_cast<uint64>(e1top.z), E1TopPtIdx, E1TopSrcIdx);
-			PCGEx::H64(static_cast<uint64>(e2bot.z), E2BotPtIdx, E2BotSrcIdx);
-			PCGEx::H64(static_cast<uint64>(e2top.z), E2TopPtIdx, E2TopSrcIdx);
-
 			// Calculate alpha along each edge
 			auto CalcAlpha = [](const PCGExClipper2Lib::Point64& Bot, const PCGExClipper2Lib::Point64& Top, const PCGExClipper2Lib::Point64& Pt) -> double
 			{
@@ -154,17 +167,94 @@ namespace PCGExClipper2
 				return FMath::Clamp((PtDX * DX + PtDY * DY) / (Len * Len), 0.0, 1.0);
 			};
 
+			// A source edge, and where along it a vertex sits
+			struct FSourceEdge
+			{
+				uint32 BotPtIdx = 0;
+				uint32 BotSrcIdx = 0;
+				uint32 TopPtIdx = 0;
+				uint32 TopSrcIdx = 0;
+				double Alpha = 0;
+
+				bool HasBot(const uint32 PtIdx, const uint32 SrcIdx) const { return BotPtIdx == PtIdx && BotSrcIdx == SrcIdx; }
+				bool HasTop(const uint32 PtIdx, const uint32 SrcIdx) const { return TopPtIdx == PtIdx && TopSrcIdx == SrcIdx; }
+			};
+
+			// Edges coming out of a previous pass (i.e cascaded union merge rounds) may start or end at an intersection.
+			// Resolve those back to the source edge they're a fragment of, so chained intersections blend like a single pass would.
+			auto ResolveEdge = [&Group, &CalcAlpha](const PCGExClipper2Lib::Point64& Bot, const PCGExClipper2Lib::Point64& Top, const PCGExClipper2Lib::Point64& Pt, FSourceEdge& OutEdge)
+			{
+				uint32 BotPtIdx, BotSrcIdx;
+				uint32 TopPtIdx, TopSrcIdx;
+				PCGEx::H64(static_cast<uint64>(Bot.z), BotPtIdx, BotSrcIdx);
+				PCGEx::H64(static_cast<uint64>(Top.z), TopPtIdx, TopSrcIdx);
+
+				const double LocalAlpha = CalcAlpha(Bot, Top, Pt);
+				OutEdge = FSourceEdge{BotPtIdx, BotSrcIdx, TopPtIdx, TopSrcIdx, LocalAlpha};
+
+				const bool bBotIsIntersection = BotPtIdx == INTERSECTION_MARKER;
+				const bool bTopIsIntersection = TopPtIdx == INTERSECTION_MARKER;
+				if (!bBotIsIntersection && !bTopIsIntersection) { return; }
+
+				// Each intersection lies on two source edges
+				FSourceEdge BotCandidates[2];
+				FSourceEdge TopCandidates[2];
+
+				auto GetCandidates = [&Group](const PCGExClipper2Lib::Point64& At, FSourceEdge (&OutCandidates)[2])
+				{
+					FIntersectionBlendInfo Info;
+					if (!Group->FindIntersectionBlendInfo(At.x, At.y, Info)) { return false; }
+					OutCandidates[0] = FSourceEdge{Info.E1BotPointIdx, Info.E1BotSourceIdx, Info.E1TopPointIdx, Info.E1TopSourceIdx, Info.E1Alpha};
+					OutCandidates[1] = FSourceEdge{Info.E2BotPointIdx, Info.E2BotSourceIdx, Info.E2TopPointIdx, Info.E2TopSourceIdx, Info.E2Alpha};
+					return true;
+				};
+
+				if (bBotIsIntersection && !GetCandidates(Bot, BotCandidates)) { return; }
+				if (bTopIsIntersection && !GetCandidates(Top, TopCandidates)) { return; }
+
+				// Where an end of the clipped edge sits along a source edge, negative if it isn't on it
+				auto GetAlphaOn = [](const FSourceEdge& Edge, const bool bIsIntersection, const FSourceEdge (&Candidates)[2], const uint32 PtIdx, const uint32 SrcIdx) -> double
+				{
+					if (!bIsIntersection) { return Edge.HasBot(PtIdx, SrcIdx) ? 0 : Edge.HasTop(PtIdx, SrcIdx) ? 1 : -1; }
+
+					for (const FSourceEdge& C : Candidates)
+					{
+						if (Edge.HasBot(C.BotPtIdx, C.BotSrcIdx) && Edge.HasTop(C.TopPtIdx, C.TopSrcIdx)) { return C.Alpha; }
+						if (Edge.HasBot(C.TopPtIdx, C.TopSrcIdx) && Edge.HasTop(C.BotPtIdx, C.BotSrcIdx)) { return 1 - C.Alpha; }
+					}
+
+					return -1;
+				};
+
+				// The clipped edge is a fragment of whichever source edge both of its ends lie on
+				for (const FSourceEdge& Edge : bBotIsIntersection ? BotCandidates : TopCandidates)
+				{
+					const double BotAlpha = GetAlphaOn(Edge, bBotIsIntersection, BotCandidates, BotPtIdx, BotSrcIdx);
+					const double TopAlpha = GetAlphaOn(Edge, bTopIsIntersection, TopCandidates, TopPtIdx, TopSrcIdx);
+					if (BotAlpha < 0 || TopAlpha < 0) { continue; }
+
+					OutEdge = Edge;
+					OutEdge.Alpha = FMath::Clamp(FMath::Lerp(BotAlpha, TopAlpha, LocalAlpha), 0.0, 1.0);
+					return;
+				}
+			};
+
+			FSourceEdge E1;
+			FSourceEdge E2;
+			ResolveEdge(e1bot, e1top, pt, E1);
+			ResolveEdge(e2bot, e2top, pt, E2);
+
 			FIntersectionBlendInfo Info;
-			Info.E1BotPointIdx = E1BotPtIdx;
-			Info.E1BotSourceIdx = E1BotSrcIdx;
-			Info.E1TopPointIdx = E1TopPtIdx;
-			Info.E1TopSourceIdx = E1TopSrcIdx;
-			Info.E2BotPointIdx = E2BotPtIdx;
-			Info.E2BotSourceIdx = E2BotSrcIdx;
-			Info.E2TopPointIdx = E2TopPtIdx;
-			Info.E2TopSourceIdx = E2TopSrcIdx;
-			Info.E1Alpha = CalcAlpha(e1bot, e1top, pt);
-			Info.E2Alpha = CalcAlpha(e2bot, e2top, pt);
+			Info.E1BotPointIdx = E1.BotPtIdx;
+			Info.E1BotSourceIdx = E1.BotSrcIdx;
+			Info.E1TopPointIdx = E1.TopPtIdx;
+			Info.E1TopSourceIdx = E1.TopSrcIdx;
+			Info.E2BotPointIdx = E2.BotPtIdx;
+			Info.E2BotSourceIdx = E2.BotSrcIdx;
+			Info.E2TopPointIdx = E2.TopPtIdx;
+			Info.E2TopSourceIdx = E2.TopSrcIdx;
+			Info.E1Alpha = E1.Alpha;
+			Info.E2Alpha = E2.Alpha;
 
 			// Store intersection info
 			Group->AddIntersectionBlendInfo(pt.x, pt.y, Info);
@@ -175,6 +265,131 @@ namespace PCGExClipper2
 		};
 	}
 
+#pragma endregion
+
+#pragma region Cascaded Union
+
+	bool HasUniformWinding(const PCGExClipper2Lib::Paths64& InPaths)
+	{
+		const int32 NumPaths = static_cast<int32>(InPaths.size());
+
+		TArray<int8> Signs;
+		Signs.SetNumUninitialized(NumPaths);
+
+		ParallelFor(NumPaths, [&](const int32 i)
+		{
+			const double Area = PCGExClipper2Lib::Area(InPaths[i]);
+			Signs[i] = Area > 0 ? 1 : Area < 0 ? -1 : 0;
+		});
+
+		// Degenerate paths don't contribute to any winding number, so they don't break uniformity
+		int8 Sign = 0;
+		for (const int8 S : Signs)
+		{
+			if (!S) { continue; }
+			if (!Sign) { Sign = S; }
+			else if (Sign != S) { return false; }
+		}
+
+		return true;
+	}
+
+	void CascadedUnion(
+		const PCGExClipper2Lib::Paths64& InPaths,
+		const PCGExClipper2Lib::FillRule InFillRule,
+		const PCGExClipper2Lib::ZCallback64& InZCallback,
+		const int32 TileSize,
+		PCGExClipper2Lib::Paths64& OutPaths)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClipper2::CascadedUnion);
+
+		const int32 NumPaths = static_cast<int32>(InPaths.size());
+		const int32 SafeTileSize = FMath::Max(2, TileSize);
+
+		auto UnionPaths = [&](const PCGExClipper2Lib::Paths64& A, const PCGExClipper2Lib::Paths64* B, PCGExClipper2Lib::Paths64& Out)
+		{
+			PCGExClipper2Lib::Clipper64 Clipper;
+			if (InZCallback) { Clipper.SetZCallback(InZCallback); }
+			Clipper.AddSubject(A);
+			if (B) { Clipper.AddSubject(*B); }
+			Clipper.Execute(PCGExClipper2Lib::ClipType::Union, InFillRule, Out);
+		};
+
+		if (NumPaths <= SafeTileSize || !SupportsCascadedUnion(InFillRule) || !HasUniformWinding(InPaths))
+		{
+			UnionPaths(InPaths, nullptr, OutPaths);
+			return;
+		}
+
+		// Sort paths along a Morton curve so each tile covers a compact area,
+		// which keeps per-tile scanlines short and lets tiles merge with few crossings.
+		const PCGExClipper2Lib::Rect64 FullBounds = PCGExClipper2Lib::GetBounds(InPaths);
+		const double RangeX = FMath::Max(1.0, static_cast<double>(FullBounds.right - FullBounds.left));
+		const double RangeY = FMath::Max(1.0, static_cast<double>(FullBounds.bottom - FullBounds.top));
+
+		auto Spread = [](uint64 V)
+		{
+			V &= 0xFFFF;
+			V = (V | (V << 8)) & 0x00FF00FF;
+			V = (V | (V << 4)) & 0x0F0F0F0F;
+			V = (V | (V << 2)) & 0x33333333;
+			V = (V | (V << 1)) & 0x55555555;
+			return V;
+		};
+
+		TArray<uint64> Keys;
+		Keys.SetNumUninitialized(NumPaths);
+
+		ParallelFor(NumPaths, [&](const int32 i)
+		{
+			const PCGExClipper2Lib::Rect64 B = PCGExClipper2Lib::GetBounds(InPaths[i]);
+			const double CX = (static_cast<double>(B.left + B.right) * 0.5 - static_cast<double>(FullBounds.left)) / RangeX;
+			const double CY = (static_cast<double>(B.top + B.bottom) * 0.5 - static_cast<double>(FullBounds.top)) / RangeY;
+			const uint64 QX = static_cast<uint64>(FMath::Clamp(CX, 0.0, 1.0) * 65535.0);
+			const uint64 QY = static_cast<uint64>(FMath::Clamp(CY, 0.0, 1.0) * 65535.0);
+			// Morton code in the upper bits, path index in the lower bits for a stable order
+			Keys[i] = ((Spread(QX) | (Spread(QY) << 1)) << 32) | static_cast<uint32>(i);
+		});
+
+		Keys.Sort();
+
+		const int32 NumTiles = FMath::DivideAndRoundUp(NumPaths, SafeTileSize);
+		TArray<PCGExClipper2Lib::Paths64> Tiles;
+		Tiles.SetNum(NumTiles);
+
+		ParallelFor(NumTiles, [&](const int32 TileIndex)
+		{
+			const int32 Start = TileIndex * SafeTileSize;
+			const int32 End = FMath::Min(Start + SafeTileSize, NumPaths);
+
+			PCGExClipper2Lib::Paths64 TilePaths;
+			TilePaths.reserve(End - Start);
+			for (int32 i = Start; i < End; i++) { TilePaths.push_back(InPaths[static_cast<uint32>(Keys[i] & 0xFFFFFFFF)]); }
+
+			UnionPaths(TilePaths, nullptr, Tiles[TileIndex]);
+		});
+
+		// Merge neighboring tiles pairwise; Morton order keeps neighbors spatially close
+		while (Tiles.Num() > 1)
+		{
+			const int32 NumMerged = FMath::DivideAndRoundUp(Tiles.Num(), 2);
+			TArray<PCGExClipper2Lib::Paths64> Merged;
+			Merged.SetNum(NumMerged);
+
+			ParallelFor(NumMerged, [&](const int32 i)
+			{
+				const int32 A = i * 2;
+				const int32 B = A + 1;
+				if (B < Tiles.Num()) { UnionPaths(Tiles[A], &Tiles[B], Merged[i]); }
+				else { Merged[i] = MoveTemp(Tiles[A]); }
+			});
+
+			Tiles = MoveTemp(Merged);
+		}
+
+		OutPaths = MoveTemp(Tiles[0]);
+	}
+
 #pragma endregion
 }
 
@@ -66,6 +66,26 @@ void FPCGExClipper2BooleanContext::Process(const TSharedPtr<PCGExClipper2::FProc
 
 	if (!Group->IsValid()) { return; }
 
+	const PCGExClipper2Lib::FillRule FillRule = PCGExClipper2::ConvertFillRule(Settings->FillRule);
+
+	// Pure closed-path unions can be cascaded across cores
+	if (Settings->Operation == EPCGExClipper2BooleanOp::Union && Settings->bCascadeUnion
+		&& Group->OpenSubjectPaths.empty() && Group->OperandPaths.empty() && Group->OpenOperandPaths.empty()
+		&& PCGExClipper2::SupportsCascadedUnion(FillRule)
+		&& static_cast<int32>(Group->SubjectPaths.size()) > Settings->CascadeTileSize)
+	{
+		PCGExClipper2Lib::Paths64 ClosedResults;
+		PCGExClipper2::CascadedUnion(Group->SubjectPaths, FillRule, Group->CreateZCallback(), Settings->CascadeTileSize, ClosedResults);
+
+		if (!ClosedResults.empty())
+		{
+			TArray<TSharedPtr<PCGExData::FPointIO>> OutputPaths;
+			OutputPaths64(ClosedResults, Group, OutputPaths, true, 0);
+		}
+
+		return;
+	}
+
 	// Create clipper and set up ZCallback for intersection tracking
 	PCGExClipper2Lib::Clipper64 Clipper;
 	Clipper.SetZCallback(Group->CreateZCallback());
@@ -103,7 +123,7 @@ void FPCGExClipper2BooleanContext::Process(const TSharedPtr<PCGExClipper2::FProc
 	PCGExClipper2Lib::Paths64 ClosedResults;
 	PCGExClipper2Lib::Paths64 OpenResults;
 
-	if (!Clipper.Execute(ClipType, PCGExClipper2::ConvertFillRule(Settings->FillRule), ClosedResults, OpenResults)) { return; }
+	if (!Clipper.Execute(ClipType, FillRule, ClosedResults, OpenResults)) { return; }
 
 	if (!ClosedResults.empty())
 	{
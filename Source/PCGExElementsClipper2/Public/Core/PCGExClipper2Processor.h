@@ -201,9 +201,38 @@ namespace PCGExClipper2
 		// Get intersection blend info by position
 		const FIntersectionBlendInfo* GetIntersectionBlendInfo(int64_t X, int64_t Y) const;
 
+		// Copy intersection blend info by position (thread-safe, usable while clipping is ongoing)
+		bool FindIntersectionBlendInfo(int64_t X, int64_t Y, FIntersectionBlendInfo& OutInfo) const;
+
 		// Create the ZCallback for this group
 		PCGExClipper2Lib::ZCallback64 CreateZCallback();
 	};
+
+	/**
+	 * Union closed paths by sorting them along a Morton curve, unioning fixed-size tiles in parallel,
+	 * then merging tile results pairwise until a single result remains.
+	 * Tiling can separate an outer path from its oppositely wound hole, so this is only identical to a monolithic union
+	 * for NonZero/Positive fill rules and inputs that all share the same winding. Other inputs are unioned monolithically.
+	 * @param InPaths - Closed paths to union
+	 * @param InFillRule - Fill rule used for every pass
+	 * @param InZCallback - Intersection callback, must be thread-safe
+	 * @param TileSize - Number of paths unioned together in the first pass
+	 * @param OutPaths - Union result
+	 */
+	PCGEXELEMENTSCLIPPER2_API void CascadedUnion(
+		const PCGExClipper2Lib::Paths64& InPaths,
+		PCGExClipper2Lib::FillRule InFillRule,
+		const PCGExClipper2Lib::ZCallback64& InZCallback,
+		int32 TileSize,
+		PCGExClipper2Lib::Paths64& OutPaths);
+
+	/** True if every non-degenerate path has the same orientation */
+	PCGEXELEMENTSCLIPPER2_API bool HasUniformWinding(const PCGExClipper2Lib::Paths64& InPaths);
+
+	FORCEINLINE bool SupportsCascadedUnion(const PCGExClipper2Lib::FillRule InFillRule)
+	{
+		return InFillRule == PCGExClipper2Lib::FillRule::NonZero || InFillRule == PCGExClipper2Lib::FillRule::Positive;
+	}
 }
 
 /**
@@ -305,6 +334,16 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Output|Flags", EditFixedSize, meta = (ReadOnlyKeys, DisplayName=" └─ Mapping", EditCondition="bFlagJoints", HideEditConditionToggle))
 	TMap<EPCGExClipper2EndpointType, int32> JointTypeValueMapping;
 
+	/** If enabled, large unions are split into spatially coherent tiles that are unioned in parallel, then merged hierarchically.
+	 * Resulting geometry is the same as a single monolithic union; only applies to closed paths with NonZero/Positive fill rules
+	 * that all share the same winding, other inputs are unioned monolithically. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Tweaks", meta = (PCG_Overridable))
+	bool bCascadeUnion = true;
+
+	/** Number of paths unioned together in the first cascade pass. Unions with fewer paths than this run monolithically. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Tweaks", meta = (PCG_Overridable, DisplayName=" └─ Tile Size", EditCondition="bCascadeUnion", ClampMin=2))
+	int32 CascadeTileSize = 64;
+
 	/** (DEBUG) If enabled, performs a union of all paths in the group before proceeding to the operation */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_NotOverridable), AdvancedDisplay)
 	bool bUnionGroupBeforeOperation = false;
@@ -289,17 +289,9 @@ namespace PCGExFilterVtx
 			return;
 		}
 
-		if (Settings->Mode == EPCGExVtxFilterOutput::Clusters)
-		{
-			TArray<PCGExGraphs::FEdge> ValidEdges;
-			Cluster->GetValidEdges(ValidEdges);
-
-			if (ValidEdges.IsEmpty()) { return; }
-			ValidEdges.Sort();
+		// Clusters mode : the batch compiles straight from the cluster's node & edge validity
 
-			GraphBuilder->Graph->InsertEdges(ValidEdges);
-		}
-		else if (Settings->Mode == EPCGExVtxFilterOutput::Points)
+		if (Settings->Mode == EPCGExVtxFilterOutput::Points)
 		{
 			TArray<int32> ReadIndices;
 
@@ -192,6 +192,7 @@ namespace PCGExFilterVtx
 			PCGEX_TYPED_CONTEXT_AND_SETTINGS(FilterVtx)
 
 			bRequiresGraphBuilder = Settings->Mode == EPCGExVtxFilterOutput::Clusters;
+			bCompileFromClusters = bRequiresGraphBuilder;
 			bRequiresWriteStep = Settings->Mode == EPCGExVtxFilterOutput::Attribute;
 		}
 
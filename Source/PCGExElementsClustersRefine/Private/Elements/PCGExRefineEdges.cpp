@@ -528,17 +528,8 @@ namespace PCGExRefineEdges
 			(void)Context->KeptEdges->Pairs[EdgeDataFacade->Source->IOIndex]->InheritPoints(Mask, false);
 			(void)Context->RemovedEdges->Pairs[EdgeDataFacade->Source->IOIndex]->InheritPoints(Mask, true);
 		}
-		else if (Settings->Mode == EPCGExRefineEdgesOutput::Clusters)
-		{
-			if (!GraphBuilder) { return; }
-
-			TArray<PCGExGraphs::FEdge> ValidEdges;
-			Cluster->GetValidEdges(ValidEdges);
 
-			if (ValidEdges.IsEmpty()) { return; }
-
-			GraphBuilder->Graph->InsertEdges(ValidEdges);
-		}
+		// Clusters mode : the batch compiles straight from the cluster's edge validity
 	}
 
 	void FProcessor::CompleteWork()
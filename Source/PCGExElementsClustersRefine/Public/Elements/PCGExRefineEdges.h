@@ -192,6 +192,7 @@ namespace PCGExRefineEdges
 		{
 			PCGEX_TYPED_CONTEXT_AND_SETTINGS(RefineEdges)
 			bRequiresGraphBuilder = Settings->Mode == EPCGExRefineEdgesOutput::Clusters;
+			bCompileFromClusters = bRequiresGraphBuilder;
 		}
 
 		virtual void RegisterBuffersDependencies(PCGExData::FFacadePreloader& FacadePreloader) override;
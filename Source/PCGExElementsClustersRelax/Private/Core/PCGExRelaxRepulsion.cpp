@@ -0,0 +1,153 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExRelaxRepulsion.h"
+
+#include "Async/ParallelFor.h"
+
+namespace PCGExRelax
+{
+	namespace BarnesHut
+	{
+		constexpr int32 LeafSize = 8;
+		constexpr int32 MaxDepth = 20;
+		constexpr int32 ParallelThreshold = 4096;
+	}
+
+	void FBarnesHutTree::Build(const TArray<FTransform>& InTransforms)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExRelax::FBarnesHutTree::Build);
+
+		const int32 NumPoints = InTransforms.Num();
+
+		Positions.SetNumUninitialized(NumPoints);
+		Indices.SetNumUninitialized(NumPoints);
+		Cells.Reset();
+
+		if (!NumPoints) { return; }
+
+		ParallelFor(
+			NumPoints, [&](const int32 i)
+			{
+				Positions[i] = InTransforms[i].GetLocation();
+				Indices[i] = i;
+			}, NumPoints < BarnesHut::ParallelThreshold);
+
+		FBox Bounds(ForceInit);
+		for (const FVector& P : Positions) { Bounds += P; }
+
+		// Cubic root so subdivisions stay cubic
+		Cells.Reserve(NumPoints / 2 + 1);
+		FCell& Root = Cells.Emplace_GetRef();
+		Root.Center = Bounds.GetCenter();
+		Root.HalfSize = FMath::Max(Bounds.GetExtent().GetMax(), UE_KINDA_SMALL_NUMBER);
+		Root.Start = 0;
+		Root.Count = NumPoints;
+
+		if (NumPoints < BarnesHut::ParallelThreshold)
+		{
+			Subdivide(Cells, 0, 0);
+			return;
+		}
+
+		// Split the root only, then build each octant's subtree on its own
+
+		Subdivide(Cells, 0, 0, false);
+
+		const int32 FirstChild = Cells[0].FirstChild;
+		if (FirstChild == -1) { return; }
+
+		TArray<TArray<FCell>> SubTrees;
+		SubTrees.SetNum(8);
+
+		ParallelFor(
+			8, [&](const int32 c)
+			{
+				const FCell& Child = Cells[FirstChild + c];
+				if (!Child.Count) { return; }
+
+				TArray<FCell>& SubTree = SubTrees[c];
+				SubTree.Reserve(Child.Count / 2 + 1);
+				SubTree.Add(Child);
+				Subdivide(SubTree, 0, 1);
+			});
+
+		// Subtree roots go back in their reserved slot, everything below is appended.
+		// Local cell k > 0 lands at Base + k, children stay contiguous.
+		for (int32 c = 0; c < 8; c++)
+		{
+			TArray<FCell>& SubTree = SubTrees[c];
+			if (SubTree.IsEmpty()) { continue; }
+
+			const int32 Base = Cells.Num() - 1;
+			for (FCell& Cell : SubTree) { if (Cell.FirstChild != -1) { Cell.FirstChild += Base; } }
+
+			Cells[FirstChild + c] = SubTree[0];
+			Cells.Append(SubTree.GetData() + 1, SubTree.Num() - 1);
+		}
+	}
+
+	void FBarnesHutTree::Subdivide(TArray<FCell>& InCells, const int32 CellIndex, const int32 Depth, const bool bRecursive)
+	{
+		const int32 Start = InCells[CellIndex].Start;
+		const int32 Count = InCells[CellIndex].Count;
+		const FVector Center = InCells[CellIndex].Center;
+		const double HalfSize = InCells[CellIndex].HalfSize;
+
+		FVector Sum = FVector::ZeroVector;
+		for (int32 i = Start; i < Start + Count; i++) { Sum += Positions[Indices[i]]; }
+		InCells[CellIndex].Centroid = Sum / Count;
+
+		if (Count <= BarnesHut::LeafSize || Depth >= BarnesHut::MaxDepth) { return; }
+
+		// Counting sort of the cell's indices into octants
+
+		auto GetOctant = [&](const FVector& P) { return (P.X >= Center.X ? 1 : 0) | (P.Y >= Center.Y ? 2 : 0) | (P.Z >= Center.Z ? 4 : 0); };
+
+		int32 OctantCounts[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+		for (int32 i = Start; i < Start + Count; i++) { OctantCounts[GetOctant(Positions[Indices[i]])]++; }
+
+		int32 OctantStarts[8];
+		int32 Offset = Start;
+		for (int32 c = 0; c < 8; c++)
+		{
+			OctantStarts[c] = Offset;
+			Offset += OctantCounts[c];
+		}
+
+		TArray<int32> Sorted;
+		Sorted.SetNumUninitialized(Count);
+		int32 Cursors[8];
+		FMemory::Memcpy(Cursors, OctantStarts, sizeof(Cursors));
+		for (int32 i = Start; i < Start + Count; i++)
+		{
+			const int32 Index = Indices[i];
+			Sorted[Cursors[GetOctant(Positions[Index])]++ - Start] = Index;
+		}
+		FMemory::Memcpy(Indices.GetData() + Start, Sorted.GetData(), Count * sizeof(int32));
+
+		const int32 FirstChild = InCells.Num();
+		InCells[CellIndex].FirstChild = FirstChild;
+		InCells.AddDefaulted(8);
+
+		const double ChildHalfSize = HalfSize * 0.5;
+		for (int32 c = 0; c < 8; c++)
+		{
+			FCell& Child = InCells[FirstChild + c];
+			Child.Start = OctantStarts[c];
+			Child.Count = OctantCounts[c];
+			Child.HalfSize = ChildHalfSize;
+			Child.Center = Center + FVector(
+				(c & 1) ? ChildHalfSize : -ChildHalfSize,
+				(c & 2) ? ChildHalfSize : -ChildHalfSize,
+				(c & 4) ? ChildHalfSize : -ChildHalfSize);
+		}
+
+		if (!bRecursive) { return; }
+
+		for (int32 c = 0; c < 8; c++)
+		{
+			if (InCells[FirstChild + c].Count) { Subdivide(InCells, FirstChild + c, Depth + 1); }
+		}
+	}
+}
@@ -1,4 +1,4 @@
-// Copyright 2026 Timothé Lapetite and contributors
+﻿// Copyright 2026 Timothé Lapetite and contributors
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #include "Relaxations/PCGExForceDirectedRelax.h"
@@ -12,9 +12,24 @@ void UPCGExForceDirectedRelax::CopySettingsFrom(const UPCGExInstancedFactory* Ot
 	{
 		SpringConstant = TypedOther->SpringConstant;
 		ElectrostaticConstant = TypedOther->ElectrostaticConstant;
+		Repulsion = TypedOther->Repulsion;
+		Theta = TypedOther->Theta;
 	}
 }
 
+EPCGExClusterElement UPCGExForceDirectedRelax::PrepareNextStep(const int32 InStep)
+{
+	const EPCGExClusterElement Source = Super::PrepareNextStep(InStep); // Buffer swap needs to happen first
+
+	if (InStep == 0 && Repulsion == EPCGExRelaxRepulsionMode::Approximate)
+	{
+		if (!RepulsionTree) { RepulsionTree = MakeShared<PCGExRelax::FBarnesHutTree>(); }
+		RepulsionTree->Build(*ReadBuffer);
+	}
+
+	return Source;
+}
+
 void UPCGExForceDirectedRelax::Step1(const PCGExClusters::FNode& Node)
 {
 	const FVector Position = (ReadBuffer->GetData() + Node.Index)->GetLocation();
@@ -28,11 +43,24 @@ void UPCGExForceDirectedRelax::Step1(const PCGExClusters::FNode& Node)
 	}
 
 	// Repulsive forces: between ALL node pairs (electrostatic repulsion)
-	for (int32 OtherNodeIndex = 0; OtherNodeIndex < Cluster->Nodes->Num(); OtherNodeIndex++)
+	if (RepulsionTree && Repulsion == EPCGExRelaxRepulsionMode::Approximate)
+	{
+		RepulsionTree->ForEachSource(
+			Position, Node.Index, Theta, [&](const FVector& SourcePosition, const double Count)
+			{
+				FVector SourceForce = FVector::ZeroVector;
+				CalculateRepulsiveForce(SourceForce, Position, SourcePosition);
+				Force += SourceForce * Count;
+			});
+	}
+	else
 	{
-		if (OtherNodeIndex == Node.Index) { continue; }
-		const FVector OtherPosition = (ReadBuffer->GetData() + OtherNodeIndex)->GetLocation();
-		CalculateRepulsiveForce(Force, Position, OtherPosition);
+		for (int32 OtherNodeIndex = 0; OtherNodeIndex < Cluster->Nodes->Num(); OtherNodeIndex++)
+		{
+			if (OtherNodeIndex == Node.Index) { continue; }
+			const FVector OtherPosition = (ReadBuffer->GetData() + OtherNodeIndex)->GetLocation();
+			CalculateRepulsiveForce(Force, Position, OtherPosition);
+		}
 	}
 
 	(*WriteBuffer)[Node.Index].SetLocation(Position + Force);
@@ -1,4 +1,4 @@
-// Copyright 2026 Timothé Lapetite and contributors
+﻿// Copyright 2026 Timothé Lapetite and contributors
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #include "Relaxations/PCGExRadiusFittingRelax.h"
@@ -18,29 +18,52 @@ bool UPCGExRadiusFittingRelax::PrepareForCluster(FPCGExContext* InContext, const
 	RadiusBuffer = GetValueSettingRadius();
 	if (!RadiusBuffer->Init(PrimaryDataFacade)) { return false; }
 
+	MaxRadius = 0;
+	for (const PCGExClusters::FNode& Node : *Cluster->Nodes) { MaxRadius = FMath::Max(MaxRadius, RadiusBuffer->Read(Node.PointIndex)); }
+
 	return true;
 }
 
+EPCGExClusterElement UPCGExRadiusFittingRelax::PrepareNextStep(const int32 InStep)
+{
+	const EPCGExClusterElement Source = Super::PrepareNextStep(InStep);
+
+	// Positions are read-only until Step3, build the grid right before repulsion
+	if (InStep == 1 && MaxRadius > 0)
+	{
+		if (!RepulsionGrid) { RepulsionGrid = MakeShared<PCGExSpatial::FHashGrid>(); }
+		RepulsionGrid->Build(*ReadBuffer, MaxRadius * 2);
+	}
+
+	return Source;
+}
+
 void UPCGExRadiusFittingRelax::Step2(const PCGExClusters::FNode& Node)
 {
 	const FVector& CurrentPos = (ReadBuffer->GetData() + Node.Index)->GetLocation();
 	const double& CurrentRadius = RadiusBuffer->Read(Node.PointIndex);
 
-	// Apply repulsion forces between all pairs of nodes
+	// Apply repulsion forces between all pairs of overlapping nodes
+	// Each pair is only processed once, from its lowest index
 
-	for (int32 OtherNodeIndex = Node.Index + 1; OtherNodeIndex < Cluster->Nodes->Num(); OtherNodeIndex++)
-	{
-		const PCGExClusters::FNode* OtherNode = Cluster->GetNode(OtherNodeIndex);
-		const FVector& OtherPos = (ReadBuffer->GetData() + OtherNodeIndex)->GetLocation();
+	if (!RepulsionGrid) { return; }
 
-		FVector Delta = OtherPos - CurrentPos;
-		const double Distance = Delta.Size();
-		const double Overlap = (CurrentRadius + RadiusBuffer->Read(OtherNode->PointIndex)) - Distance;
+	RepulsionGrid->ForEachInRadius(
+		CurrentPos, MaxRadius * 2, [&](const int32 OtherNodeIndex, const double)
+		{
+			if (OtherNodeIndex <= Node.Index) { return; }
 
-		if (Overlap <= 0 || Distance <= KINDA_SMALL_NUMBER) { continue; }
+			const PCGExClusters::FNode* OtherNode = Cluster->GetNode(OtherNodeIndex);
+			const FVector& OtherPos = (ReadBuffer->GetData() + OtherNodeIndex)->GetLocation();
 
-		AddDelta(OtherNode->Index, Node.Index, (RepulsionConstant * (Overlap / FMath::Square(Distance)) * (Delta / Distance)));
-	}
+			const FVector Delta = OtherPos - CurrentPos;
+			const double Distance = Delta.Size();
+			const double Overlap = (CurrentRadius + RadiusBuffer->Read(OtherNode->PointIndex)) - Distance;
+
+			if (Overlap <= 0 || Distance <= KINDA_SMALL_NUMBER) { return; }
+
+			AddDelta(OtherNode->Index, Node.Index, (RepulsionConstant * (Overlap / FMath::Square(Distance)) * (Delta / Distance)));
+		});
 }
 
 #pragma endregion
@@ -0,0 +1,88 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExRelax
+{
+	//
+	// FBarnesHutTree - Octree over node positions with per-cell aggregates (count & centroid)
+	//
+	// Distant cells are treated as a single aggregated source, bringing all-pairs
+	// repulsion down from O(N²) to O(N log N). Rebuilt from scratch each iteration,
+	// top-level octants are built in parallel.
+	//
+	class FBarnesHutTree
+	{
+	public:
+		FBarnesHutTree() = default;
+
+		void Build(const TArray<FTransform>& InTransforms);
+
+		/**
+		 * Calls Func(Position, Count) for every source contributing to the field at InPosition.
+		 * Cells whose size/distance ratio is below Theta are aggregated, others are opened.
+		 * Cells containing InPosition are always opened, so a node never aggregates itself whatever Theta is.
+		 * Theta = 0 degrades to the exact all-pairs evaluation.
+		 */
+		template <typename FSourceFunc>
+		void ForEachSource(const FVector& InPosition, const int32 ExcludeIndex, const double Theta, FSourceFunc&& Func) const
+		{
+			if (Cells.IsEmpty()) { return; }
+
+			const double ThetaSquared = Theta * Theta;
+
+			TArray<int32, TInlineAllocator<64>> Stack;
+			Stack.Add(0);
+
+			while (!Stack.IsEmpty())
+			{
+				const FCell& Cell = Cells[Stack.Pop(EAllowShrinking::No)];
+
+				if (Cell.FirstChild == -1)
+				{
+					for (int32 i = Cell.Start; i < Cell.Start + Cell.Count; i++)
+					{
+						const int32 Index = Indices[i];
+						if (Index != ExcludeIndex) { Func(Positions[Index], 1.0); }
+					}
+					continue;
+				}
+
+				const double DistSquared = FVector::DistSquared(InPosition, Cell.Centroid);
+				if (!Cell.Contains(InPosition) && FMath::Square(Cell.HalfSize * 2) < ThetaSquared * DistSquared)
+				{
+					Func(Cell.Centroid, static_cast<double>(Cell.Count));
+					continue;
+				}
+
+				for (int32 c = 0; c < 8; c++) { if (Cells[Cell.FirstChild + c].Count) { Stack.Add(Cell.FirstChild + c); } }
+			}
+		}
+
+	protected:
+		struct FCell
+		{
+			FVector Centroid = FVector::ZeroVector;
+			FVector Center = FVector::ZeroVector;
+			double HalfSize = 0;
+			int32 Start = 0;
+			int32 Count = 0;
+			int32 FirstChild = -1; // 8 contiguous children, -1 for leaves
+
+			FORCEINLINE bool Contains(const FVector& P) const
+			{
+				return FMath::Abs(P.X - Center.X) <= HalfSize && FMath::Abs(P.Y - Center.Y) <= HalfSize && FMath::Abs(P.Z - Center.Z) <= HalfSize;
+			}
+		};
+
+		TArray<FVector> Positions;
+		TArray<int32> Indices;
+		TArray<FCell> Cells;
+
+		// Only touches InCells and the cell's own Indices range, so disjoint subtrees can be built concurrently
+		void Subdivide(TArray<FCell>& InCells, const int32 CellIndex, const int32 Depth, const bool bRecursive = true);
+	};
+}
@@ -1,12 +1,20 @@
-// Copyright 2026 Timothé Lapetite and contributors
+﻿// Copyright 2026 Timothé Lapetite and contributors
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #pragma once
 
 #include "CoreMinimal.h"
 #include "Core/PCGExRelaxClusterOperation.h"
+#include "Core/PCGExRelaxRepulsion.h"
 #include "PCGExForceDirectedRelax.generated.h"
 
+UENUM()
+enum class EPCGExRelaxRepulsionMode : uint8
+{
+	Exact       = 0 UMETA(DisplayName = "Exact", ToolTip="Every node repulses every other node. Cost grows quadratically with the number of nodes."),
+	Approximate = 1 UMETA(DisplayName = "Approximate", ToolTip="Distant groups of nodes repulse as a single aggregate (Barnes-Hut). Scales to large clusters."),
+};
+
 /**
  *
  */
@@ -17,6 +25,7 @@ class UPCGExForceDirectedRelax : public UPCGExRelaxClusterOperation
 
 public:
 	virtual void CopySettingsFrom(const UPCGExInstancedFactory* Other) override;
+	virtual EPCGExClusterElement PrepareNextStep(const int32 InStep) override;
 	virtual void Step1(const PCGExClusters::FNode& Node) override;
 
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
@@ -25,7 +34,23 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
 	double ElectrostaticConstant = 1000;
 
+	/** How repulsion between nodes is evaluated. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
+	EPCGExRelaxRepulsionMode Repulsion = EPCGExRelaxRepulsionMode::Exact;
+
+	/** Approximation threshold (cell size / distance). Lower is more accurate & slower, 0 is exact. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="Repulsion == EPCGExRelaxRepulsionMode::Approximate", EditConditionHides, ClampMin=0, ClampMax=1))
+	double Theta = 0.5;
+
+	virtual void Cleanup() override
+	{
+		RepulsionTree.Reset();
+		Super::Cleanup();
+	}
+
 protected:
+	TSharedPtr<PCGExRelax::FBarnesHutTree> RepulsionTree;
+
 	void CalculateAttractiveForce(FVector& Force, const FVector& A, const FVector& B) const;
 	void CalculateRepulsiveForce(FVector& Force, const FVector& A, const FVector& B) const;
 };
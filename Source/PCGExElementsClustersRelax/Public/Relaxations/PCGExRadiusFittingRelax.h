@@ -1,4 +1,4 @@
-// Copyright 2026 Timothé Lapetite and contributors
+﻿// Copyright 2026 Timothé Lapetite and contributors
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #pragma once
@@ -9,6 +9,7 @@
 #include "Data/Utils/PCGExDataPreloader.h"
 #include "Details/PCGExSettingsDetails.h"
 #include "Details/PCGExSettingsMacros.h"
+#include "Math/PCGExHashGrid.h"
 
 #include "PCGExRadiusFittingRelax.generated.h"
 
@@ -44,8 +45,20 @@ public:
 	PCGEX_SETTING_VALUE_INLINE(Radius, double, RadiusInput, RadiusAttribute, Radius)
 
 	virtual bool PrepareForCluster(FPCGExContext* InContext, const TSharedPtr<PCGExClusters::FCluster>& InCluster) override;
+	virtual EPCGExClusterElement PrepareNextStep(const int32 InStep) override;
 	virtual void Step2(const PCGExClusters::FNode& Node) override;
 
+	virtual void Cleanup() override
+	{
+		RepulsionGrid.Reset();
+		RadiusBuffer.Reset();
+		Super::Cleanup();
+	}
+
 protected:
 	TSharedPtr<PCGExDetails::TSettingValue<double>> RadiusBuffer;
+
+	// Overlap can't happen past twice the largest radius, which bounds both the grid cell size & the query radius
+	double MaxRadius = 0;
+	TSharedPtr<PCGExSpatial::FHashGrid> RepulsionGrid;
 };
@@ -0,0 +1,89 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+
+#include "Elements/Sorting/PCGExSpatialSortPoints.h"
+
+
+#include "Data/PCGExData.h"
+#include "Data/PCGExPointIO.h"
+#include "Sorting/PCGExSpatialSort.h"
+
+
+#define LOCTEXT_NAMESPACE "PCGExSpatialSortPoints"
+#define PCGEX_NAMESPACE SpatialSortPoints
+
+FPCGElementPtr UPCGExSpatialSortPointsSettings::CreateElement() const { return MakeShared<FPCGExSpatialSortPointsElement>(); }
+
+PCGExData::EIOInit UPCGExSpatialSortPointsSettings::GetMainDataInitializationPolicy() const { return PCGExData::EIOInit::Duplicate; }
+
+PCGEX_ELEMENT_BATCH_POINT_IMPL(SpatialSortPoints)
+
+bool FPCGExSpatialSortPointsElement::Boot(FPCGExContext* InContext) const
+{
+	if (!FPCGExPointsProcessorElement::Boot(InContext)) { return false; }
+
+	PCGEX_CONTEXT_AND_SETTINGS(SpatialSortPoints)
+
+	PCGEX_VALIDATE_NAME_CONDITIONAL(Settings->bWriteOriginalIndex, Settings->OriginalIndexAttributeName)
+
+	return true;
+}
+
+bool FPCGExSpatialSortPointsElement::AdvanceWork(FPCGExContext* InContext, const UPCGExSettings* InSettings) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExSpatialSortPointsElement::Execute);
+
+	PCGEX_CONTEXT_AND_SETTINGS(SpatialSortPoints)
+	PCGEX_EXECUTION_CHECK
+	PCGEX_ON_INITIAL_EXECUTION
+	{
+		if (!Context->StartBatchProcessingPoints(
+			[&](const TSharedPtr<PCGExData::FPointIO>& Entry) { return true; },
+			[&](const TSharedPtr<PCGExPointsMT::IBatch>& NewBatch)
+			{
+				NewBatch->bSkipCompletion = true;
+			}))
+		{
+			return Context->CancelExecution(TEXT("Could not find any points to sort."));
+		}
+	}
+
+	PCGEX_POINTS_BATCH_PROCESSING(PCGExCommon::States::State_Done)
+
+	Context->MainPoints->StageOutputs();
+
+	return Context->TryComplete();
+}
+
+namespace PCGExSpatialSortPoints
+{
+	bool FProcessor::Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSpatialSortPoints::Process);
+
+		if (!TProcessor::Process(InTaskManager)) { return false; }
+
+		PCGEX_INIT_IO(PointDataFacade->Source, PCGExData::EIOInit::Duplicate)
+
+		const int32 NumPoints = PointDataFacade->GetNum();
+
+		TArray<int32> Order;
+		PCGExSorting::ComputeSpatialOrder(PointDataFacade->GetIn(), Order, Settings->Curve);
+
+		// Single pass over every native property & metadata entry
+		PointDataFacade->Source->InheritPoints(Order, 0);
+
+		if (Settings->bWriteOriginalIndex)
+		{
+			const TSharedPtr<PCGExData::TBuffer<int32>> OriginalIndexWriter = PointDataFacade->GetWritable<int32>(Settings->OriginalIndexAttributeName, -1, false, PCGExData::EBufferInit::New);
+			PCGEX_PARALLEL_FOR(NumPoints, OriginalIndexWriter->SetValue(i, Order[i]);)
+			PointDataFacade->WriteFastest(TaskManager);
+		}
+
+		return true;
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
+#undef PCGEX_NAMESPACE
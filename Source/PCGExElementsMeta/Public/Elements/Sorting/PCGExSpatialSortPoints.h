@@ -0,0 +1,82 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+#include "Core/PCGExPointsProcessor.h"
+#include "Sorting/PCGExSortingCommon.h"
+
+#include "PCGExSpatialSortPoints.generated.h"
+
+UCLASS(MinimalAPI, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Misc", meta=(PCGExNodeLibraryDoc="misc/sort-points-spatial"))
+class UPCGExSpatialSortPointsSettings : public UPCGExPointsProcessorSettings
+{
+	GENERATED_BODY()
+
+public:
+	//~Begin UPCGSettings
+#if WITH_EDITOR
+	PCGEX_NODE_INFOS(SpatialSortPoints, "Sort Points (Spatial)", "Reorder points along a space-filling curve, so points close in space are also close in memory.");
+	virtual EPCGSettingsType GetType() const override { return EPCGSettingsType::Generic; }
+	virtual FLinearColor GetNodeTitleColor() const override { return PCGEX_NODE_COLOR_OPTIN_NAME(MiscWrite); }
+#endif
+
+protected:
+	virtual FPCGElementPtr CreateElement() const override;
+	//~End UPCGSettings
+
+	virtual bool SupportsDataStealing() const override { return true; }
+
+public:
+	virtual PCGExData::EIOInit GetMainDataInitializationPolicy() const override;
+
+	/** Curve used to order points. Hilbert gives better locality, Morton is slightly cheaper to compute. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
+	EPCGExSpaceFillingCurve Curve = EPCGExSpaceFillingCurve::Hilbert;
+
+	/** Whether to write the index each point had before reordering. Sorting over it restores the original order. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, InlineEditConditionToggle))
+	bool bWriteOriginalIndex = false;
+
+	/** Name of the attribute to write the original index to. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="bWriteOriginalIndex"))
+	FName OriginalIndexAttributeName = "OriginalIndex";
+};
+
+struct FPCGExSpatialSortPointsContext final : FPCGExPointsProcessorContext
+{
+	friend class FPCGExSpatialSortPointsElement;
+
+protected:
+	PCGEX_ELEMENT_BATCH_POINT_DECL
+};
+
+class FPCGExSpatialSortPointsElement final : public FPCGExPointsProcessorElement
+{
+protected:
+	PCGEX_ELEMENT_CREATE_CONTEXT(SpatialSortPoints)
+
+	virtual bool Boot(FPCGExContext* InContext) const override;
+	virtual bool AdvanceWork(FPCGExContext* InContext, const UPCGExSettings* InSettings) const override;
+};
+
+namespace PCGExSpatialSortPoints
+{
+	class FProcessor final : public PCGExPointsMT::TProcessor<FPCGExSpatialSortPointsContext, UPCGExSpatialSortPointsSettings>
+	{
+	public:
+		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
+			: TProcessor(InPointDataFacade)
+		{
+		}
+
+		virtual ~FProcessor() override
+		{
+		}
+
+		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager) override;
+	};
+}
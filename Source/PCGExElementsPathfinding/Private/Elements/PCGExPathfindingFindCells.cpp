@@ -227,6 +227,17 @@ namespace PCGExFindContours
 		AllCellsIncludingFailed = AllCells;
 		AllCellsIncludingFailed.Append(FailedCells);
 
+		// Locate each seed once through the enumerator's face lookup instead of testing every seed against every cell
+		Enumerator->BucketPointsByFace(Seeds->GetProjectedPoints(), SeedFaceOffsets, SeedsByFace, WrapperCell ? WrapperCell->FaceIndex : -1);
+
+		// Seeds inside any internal cell polygon (valid or failed) are consumed and can't claim the wrapper
+		ConsumedSeedMask.Init(false, Seeds->Num());
+		for (const TSharedPtr<PCGExClusters::FCell>& Cell : AllCellsIncludingFailed)
+		{
+			if (!Cell || Cell->Polygon.IsEmpty()) { continue; }
+			for (const int32 SeedIdx : GetFaceSeeds(Cell->FaceIndex)) { ConsumedSeedMask[SeedIdx] = true; }
+		}
+
 		if (AllCells.IsEmpty() && WrapperCell)
 		{
 			// No valid internal cells - check if any seed can claim wrapper
@@ -250,7 +261,6 @@ namespace PCGExFindContours
 
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
-		const int32 NumSeeds = Seeds->Num();
 		const TSharedPtr<PCGExCells::FSeedOwnershipHandler>& SeedOwnership = Context->SeedOwnership;
 		const bool bNeedsAllCandidates = SeedOwnership->NeedsAllCandidates();
 
@@ -267,22 +277,13 @@ namespace PCGExFindContours
 
 			CandidateSeeds.Reset();
 
-			// Find all seeds inside this cell
-			for (int32 SeedIdx = 0; SeedIdx < NumSeeds; ++SeedIdx)
+			// Seeds inside this cell, in ascending order
+			for (const int32 SeedIdx : GetFaceSeeds(Cell->FaceIndex))
 			{
-				const FVector2D& SeedPoint = Seeds->GetProjected(SeedIdx);
-
-				// AABB early-out
-				if (!Cell->Bounds2D.IsInside(SeedPoint)) { continue; }
-
-				// Fine polygon check
-				if (PCGExMath::Geo::IsPointInPolygon(SeedPoint, Cell->Polygon))
-				{
-					CandidateSeeds.Add(SeedIdx);
+				CandidateSeeds.Add(SeedIdx);
 
-					// For SeedOrder mode, first match wins - break early
-					if (!bNeedsAllCandidates) { break; }
-				}
+				// For SeedOrder mode, first match wins - break early
+				if (!bNeedsAllCandidates) { break; }
 			}
 
 			// Only output cells that contain at least one seed
@@ -310,21 +311,7 @@ namespace PCGExFindContours
 		for (int32 SeedIdx = 0; SeedIdx < NumSeeds; ++SeedIdx)
 		{
 			// Check if seed is inside any internal cell (consumed)
-			bool bConsumed = false;
-			const FVector2D& SeedPoint = Seeds->GetProjected(SeedIdx);
-
-			for (const TSharedPtr<PCGExClusters::FCell>& Cell : AllCellsIncludingFailed)
-			{
-				if (Cell && !Cell->Polygon.IsEmpty() &&
-					Cell->Bounds2D.IsInside(SeedPoint) &&
-					PCGExMath::Geo::IsPointInPolygon(SeedPoint, Cell->Polygon))
-				{
-					bConsumed = true;
-					break;
-				}
-			}
-
-			if (bConsumed) { continue; }
+			if (ConsumedSeedMask[SeedIdx]) { continue; }
 
 			// Seed is exterior - find closest edge distance
 			const FVector& SeedPos = SeedTransforms[SeedIdx].GetLocation();
@@ -465,20 +452,7 @@ namespace PCGExFindContours
 			const int32 NumSeeds = Seeds->Num();
 			for (int32 SeedIdx = 0; SeedIdx < NumSeeds; ++SeedIdx)
 			{
-				if (ConsumedSeeds.Contains(SeedIdx)) { continue; }
-
-				const FVector2D& SeedPoint = Seeds->GetProjected(SeedIdx);
-
-				for (const TSharedPtr<PCGExClusters::FCell>& Cell : AllCellsIncludingFailed)
-				{
-					if (Cell && !Cell->Polygon.IsEmpty() &&
-						Cell->Bounds2D.IsInside(SeedPoint) &&
-						PCGExMath::Geo::IsPointInPolygon(SeedPoint, Cell->Polygon))
-					{
-						ConsumedSeeds.Add(SeedIdx);
-						break;
-					}
-				}
+				if (ConsumedSeedMask[SeedIdx]) { ConsumedSeeds.Add(SeedIdx); }
 			}
 
 			// Find best exterior seed within picking distance
@@ -328,6 +328,17 @@ namespace PCGExFindContoursBounded
 		AllCellsIncludingFailed = AllCells;
 		AllCellsIncludingFailed.Append(FailedCells);
 
+		// Locate each seed once through the enumerator's face lookup instead of testing every seed against every cell
+		Enumerator->BucketPointsByFace(Seeds->GetProjectedPoints(), SeedFaceOffsets, SeedsByFace, WrapperCell ? WrapperCell->FaceIndex : -1);
+
+		// Seeds inside any internal cell polygon (valid or failed) are consumed and can't claim the wrapper
+		ConsumedSeedMask.Init(false, Seeds->Num());
+		for (const TSharedPtr<PCGExClusters::FCell>& Cell : AllCellsIncludingFailed)
+		{
+			if (!Cell || Cell->Polygon.IsEmpty()) { continue; }
+			for (const int32 SeedIdx : GetFaceSeeds(Cell->FaceIndex)) { ConsumedSeedMask[SeedIdx] = true; }
+		}
+
 		// Build adjacency map if growth is enabled
 		if (Context->SeedGrowth.HasPotentialGrowth())
 		{
@@ -363,7 +374,6 @@ namespace PCGExFindContoursBounded
 
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
-		const int32 NumSeeds = Seeds->Num();
 		const TSharedPtr<PCGExCells::FSeedOwnershipHandler>& SeedOwnership = Context->SeedOwnership;
 		const bool bNeedsAllCandidates = SeedOwnership->NeedsAllCandidates();
 
@@ -380,20 +390,13 @@ namespace PCGExFindContoursBounded
 
 			CandidateSeeds.Reset();
 
-			// Find all seeds inside this cell
-			for (int32 SeedIdx = 0; SeedIdx < NumSeeds; ++SeedIdx)
+			// Seeds inside this cell, in ascending order
+			for (const int32 SeedIdx : GetFaceSeeds(Cell->FaceIndex))
 			{
-				const FVector2D& SeedPoint = Seeds->GetProjected(SeedIdx);
-
-				if (!Cell->Bounds2D.IsInside(SeedPoint)) { continue; }
-
-				if (PCGExMath::Geo::IsPointInPolygon(SeedPoint, Cell->Polygon))
-				{
-					CandidateSeeds.Add(SeedIdx);
+				CandidateSeeds.Add(SeedIdx);
 
-					// For SeedOrder mode, first match wins - break early
-					if (!bNeedsAllCandidates) { break; }
-				}
+				// For SeedOrder mode, first match wins - break early
+				if (!bNeedsAllCandidates) { break; }
 			}
 
 			// Only output cells that contain at least one seed
@@ -438,21 +441,8 @@ namespace PCGExFindContoursBounded
 
 		for (int32 SeedIdx = 0; SeedIdx < NumSeeds; ++SeedIdx)
 		{
-			bool bConsumed = false;
-			const FVector2D& SeedPoint = Seeds->GetProjected(SeedIdx);
-
-			for (const TSharedPtr<PCGExClusters::FCell>& Cell : AllCellsIncludingFailed)
-			{
-				if (Cell && !Cell->Polygon.IsEmpty() &&
-					Cell->Bounds2D.IsInside(SeedPoint) &&
-					PCGExMath::Geo::IsPointInPolygon(SeedPoint, Cell->Polygon))
-				{
-					bConsumed = true;
-					break;
-				}
-			}
-
-			if (bConsumed) { continue; }
+			// Seed is inside an internal cell (consumed)
+			if (ConsumedSeedMask[SeedIdx]) { continue; }
 
 			const FVector& SeedPos = SeedTransforms[SeedIdx].GetLocation();
 			double ClosestEdgeDistSq = MAX_dbl;
@@ -652,20 +642,7 @@ namespace PCGExFindContoursBounded
 			const int32 NumSeeds = Seeds->Num();
 			for (int32 SeedIdx = 0; SeedIdx < NumSeeds; ++SeedIdx)
 			{
-				if (ConsumedSeeds.Contains(SeedIdx)) { continue; }
-
-				const FVector2D& SeedPoint = Seeds->GetProjected(SeedIdx);
-
-				for (const TSharedPtr<PCGExClusters::FCell>& Cell : AllCellsIncludingFailed)
-				{
-					if (Cell && !Cell->Polygon.IsEmpty() &&
-						Cell->Bounds2D.IsInside(SeedPoint) &&
-						PCGExMath::Geo::IsPointInPolygon(SeedPoint, Cell->Polygon))
-					{
-						ConsumedSeeds.Add(SeedIdx);
-						break;
-					}
-				}
+				if (ConsumedSeedMask[SeedIdx]) { ConsumedSeeds.Add(SeedIdx); }
 			}
 
 			Cluster->RebuildOctree(EPCGExClusterClosestSearchMode::Edge);
@@ -178,6 +178,11 @@ namespace PCGExFindContours
 		TArray<TSharedPtr<PCGExClusters::FCell>> AllCellsIncludingFailed; // For checking seed consumption
 		TSharedPtr<PCGExClusters::FCell> WrapperCell;
 
+		// Seeds bucketed by face index (see FPlanarFaceEnumerator::BucketPointsByFace)
+		TArray<int32> SeedFaceOffsets;
+		TArray<int32> SeedsByFace;
+		TBitArray<> ConsumedSeedMask;
+
 		TSharedPtr<PCGExMT::TScopedArray<TSharedPtr<PCGExClusters::FCell>>> ScopedValidCells;
 		TArray<TSharedPtr<PCGExClusters::FCell>> ValidCells;
 		TArray<TSharedPtr<PCGExData::FPointIO>> CellsIOIndices;
@@ -203,6 +208,12 @@ namespace PCGExFindContours
 		virtual void ProcessRange(const PCGExMT::FScope& Scope) override;
 		virtual void OnRangeProcessingComplete() override;
 
+		FORCEINLINE TConstArrayView<int32> GetFaceSeeds(const int32 FaceIndex) const
+		{
+			if (FaceIndex < 0 || FaceIndex >= SeedFaceOffsets.Num() - 1) { return TConstArrayView<int32>(); }
+			return TConstArrayView<int32>(SeedsByFace.GetData() + SeedFaceOffsets[FaceIndex], SeedFaceOffsets[FaceIndex + 1] - SeedFaceOffsets[FaceIndex]);
+		}
+
 		void HandleWrapperOnlyCase(const int32 NumSeeds);
 
 		/** Expand from a seed's initial cell to adjacent cells up to growth depth */
@@ -11,6 +11,7 @@
 #include "Blenders/PCGExUnionBlender.h"
 #include "Data/PCGExData.h"
 #include "Math/PCGExMathDistances.h"
+#include "Paths/PCGExPathEdgeBVH.h"
 #include "Paths/PCGExPathsCommon.h"
 #include "Paths/PCGExPathsHelpers.h"
 
@@ -41,7 +42,7 @@ TArray<FPCGPinProperties> UPCGExPathCrossingsSettings::InputPinProperties() cons
 }
 
 PCGEX_INITIALIZE_ELEMENT(PathCrossings)
-PCGEX_ELEMENT_BATCH_POINT_IMPL(PathCrossings)
+PCGEX_ELEMENT_BATCH_POINT_IMPL_ADV(PathCrossings)
 
 bool FPCGExPathCrossingsElement::Boot(FPCGExContext* InContext) const
 {
@@ -186,9 +187,12 @@ namespace PCGExPathCrossings
 		CanCutFilterManager.Reset();
 		CanBeCutFilterManager.Reset();
 
-		if (bCanCut) { Path->BuildPartialEdgeOctree(CanCut); }
-
-		CanCut.Empty();
+		// Self-intersection only needs a per-path octree, otherwise cutter edges go into the batch-wide BVH
+		if (bSelfIntersectionOnly)
+		{
+			if (bCanCut) { Path->BuildPartialEdgeOctree(CanCut); }
+			CanCut.Empty();
+		}
 
 		return true;
 	}
@@ -206,32 +210,19 @@ namespace PCGExPathCrossings
 		const TSharedPtr<PCGExPointsMT::IBatch> Parent = ParentBatch.Pin();
 		if (!Parent) { return; }
 
-		const TSharedPtr<PCGExPointsMT::TBatch<FProcessor>> TypedParent = StaticCastSharedPtr<PCGExPointsMT::TBatch<FProcessor>>(Parent);
-
-		TArray<TSharedPtr<PCGExPaths::FPath>> Cutters;
+		const FBatch* Batch = static_cast<const FBatch*>(Parent.Get());
+		const PCGExPaths::FPathEdgeOctree* SelfOctree = nullptr;
 
 		if (bSelfIntersectionOnly)
 		{
-			if (bCanCut && Path->GetEdgeOctree()) { Cutters.Add(Path); }
+			SelfOctree = bCanCut ? Path->GetEdgeOctree() : nullptr;
+			if (!SelfOctree) { return; }
 		}
-		else
+		else if (!Batch->CutterBVH || !Batch->CutterBVH->IsValid())
 		{
-			Cutters.Reserve(Parent->ProcessorFacades.Num());
-
-
-			for (int Pi = 0; Pi < TypedParent->GetNumProcessors(); Pi++)
-			{
-				const TSharedPtr<FProcessor> P = TypedParent->GetProcessor<FProcessor>(Pi);
-
-				if (!Details.bEnableSelfIntersection && P.Get() == this) { continue; }
-				if (!P->bCanCut || !P->Path->GetEdgeOctree()) { continue; }
-
-				Cutters.Add(P->Path);
-			}
+			return;
 		}
 
-		if (Cutters.IsEmpty()) { return; }
-
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			EdgeCrossings[Index] = nullptr;
@@ -242,12 +233,23 @@ namespace PCGExPathCrossings
 			if (!Path->IsEdgeValid(Edge)) { continue; }
 
 			const TSharedPtr<PCGExPaths::FPathEdgeCrossings> NewCrossing = MakeShared<PCGExPaths::FPathEdgeCrossings>(Index);
+			const FBox EdgeBox = Edge.Bounds.GetBox();
 
-			for (const TSharedPtr<PCGExPaths::FPath>& OtherPath : Cutters)
+			if (SelfOctree)
 			{
-				OtherPath->GetEdgeOctree()->FindElementsWithBoundsTest(Edge.Bounds.GetBox(), [&](const PCGExPaths::FPathEdge* OtherEdge)
+				SelfOctree->FindElementsWithBoundsTest(EdgeBox, [&](const PCGExPaths::FPathEdge* OtherEdge)
 				{
-					NewCrossing->FindSplit(Path, Edge, PathLength, OtherPath, *OtherEdge, Details);
+					NewCrossing->FindSplit(Path, Edge, PathLength, Path, *OtherEdge, Details);
+				});
+			}
+			else
+			{
+				// Single query against every cutter edge at once
+				Batch->CutterBVH->FindOverlaps(EdgeBox, [&](const PCGExPaths::FPathEdgeBVH::FItem& Item)
+				{
+					const TSharedPtr<PCGExPaths::FPath>& OtherPath = Batch->Cutters[Item.PathIndex];
+					if (!Details.bEnableSelfIntersection && OtherPath == Path) { return; }
+					NewCrossing->FindSplit(Path, Edge, PathLength, OtherPath, OtherPath->Edges[Item.EdgeIndex], Details);
 				});
 			}
 
@@ -509,6 +511,37 @@ namespace PCGExPathCrossings
 
 		CrossBlendTask->StartSubLoops(Path->NumEdges, PCGEX_CORE_SETTINGS.GetPointsBatchChunkSize());
 	}
+
+	FBatch::FBatch(FPCGExContext* InContext, const TArray<TWeakPtr<PCGExData::FPointIO>>& InPointsCollection)
+		: TBatch(InContext, InPointsCollection)
+	{
+	}
+
+	void FBatch::OnInitialPostProcess()
+	{
+		const UPCGExPathCrossingsSettings* Settings = ExecutionContext->GetInputSettings<UPCGExPathCrossingsSettings>();
+		check(Settings);
+
+		if (Settings->bSelfIntersectionOnly) { return; }
+
+		TArray<const TBitArray<>*> Filters;
+		Cutters.Reserve(Processors.Num());
+		Filters.Reserve(Processors.Num());
+
+		for (const TSharedRef<PCGExPointsMT::IProcessor>& P : Processors)
+		{
+			const TSharedRef<FProcessor> Processor = StaticCastSharedRef<FProcessor>(P);
+			if (!Processor->bIsProcessorValid || !Processor->bCanCut || !Processor->Path) { continue; }
+
+			Cutters.Add(Processor->Path);
+			Filters.Add(&Processor->CanCut);
+		}
+
+		CutterBVH = MakeShared<PCGExPaths::FPathEdgeBVH>();
+		CutterBVH->Build(Cutters, Filters);
+
+		for (const TSharedRef<PCGExPointsMT::IProcessor>& P : Processors) { StaticCastSharedRef<FProcessor>(P)->CanCut.Empty(); }
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
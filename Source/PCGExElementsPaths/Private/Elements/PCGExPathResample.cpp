@@ -8,7 +8,6 @@
 #include "Data/PCGExPointIO.h"
 #include "PCGExVersion.h"
 #include "Data/PCGExData.h"
-#include "Paths/PCGExPath.h"
 
 #define LOCTEXT_NAMESPACE "PCGExResamplePathElement"
 #define PCGEX_NAMESPACE ResamplePath
@@ -101,9 +100,9 @@ namespace PCGExResamplePath
 
 		if (!Settings->SampleLength.TryReadDataValue(PointDataFacade->Source, SampleLength)) { return false; }
 
-		Path = MakeShared<PCGExPaths::FPath>(InPoints, 0);
-		Path->IOIndex = PointDataFacade->Source->IOIndex;
-		PathLength = Path->AddExtra<PCGExPaths::FPathEdgeLength>(true); // Force compute length
+		// Positions & arc lengths are loaded once as SoA, samples are then located & interpolated in bulk
+		PathSoA.Load(InPoints);
+		const double TotalLength = PathSoA.GetLength();
 
 		if (Settings->Mode == EPCGExResampleMode::Sweep)
 		{
@@ -114,7 +113,7 @@ namespace PCGExResamplePath
 			}
 			else
 			{
-				NumSamples = PCGExMath::TruncateDbl(PathLength->TotalLength / SampleLength, Settings->Truncate);
+				NumSamples = PCGExMath::TruncateDbl(TotalLength / SampleLength, Settings->Truncate);
 				bAutoSampleSize = Settings->bRedistributeEvenly;
 			}
 
@@ -131,86 +130,21 @@ namespace PCGExResamplePath
 			NumSamples = PointDataFacade->GetNum();
 		}
 
-		if (Path->IsClosedLoop()) { NumSamples++; }
+		if (PathSoA.bClosedLoop) { NumSamples++; }
 
 		if (bAutoSampleSize)
 		{
 			bPreserveLastPoint = false;
-			SampleLength = PathLength->TotalLength / static_cast<double>(NumSamples - 1);
+			SampleLength = TotalLength / static_cast<double>(NumSamples - 1);
 		}
 
-		Samples.SetNumUninitialized(NumSamples);
 		bForceSingleThreadedProcessPoints = true;
 
-		TConstPCGValueRange<FTransform> InTransforms = PointDataFacade->GetIn()->GetConstTransformValueRange();
+		Samples.SetNum(NumSamples);
+		for (int32 i = 0; i < NumSamples; i++) { Samples.Distances[i] = FMath::Min(i * SampleLength, TotalLength); }
+		if (bPreserveLastPoint && !PathSoA.bClosedLoop) { Samples.Distances.Last() = TotalLength; }
 
-		int32 StartIndex = 0;
-		int32 EndIndex = 1;
-		FVector PrevPosition = InTransforms[0].GetLocation();
-		double TraversedDistance = 0;
-
-		FPointSample& FirstSample = Samples[0];
-		FirstSample.Start = StartIndex;
-		FirstSample.End = EndIndex;
-		FirstSample.Location = PrevPosition;
-		FirstSample.Distance = TraversedDistance;
-
-		for (int i = 1; i < NumSamples; i++)
-		{
-			FPointSample& Sample = Samples[i];
-			Sample.Start = StartIndex;
-
-			FVector NextPosition = InTransforms[EndIndex].GetLocation();
-			double DistToNext = FVector::Dist(PrevPosition, NextPosition);
-			double Remainder = SampleLength - DistToNext;
-
-			if (Remainder <= 0)
-			{
-				// Overshooting
-				PrevPosition = PrevPosition + (Path->DirToNextPoint(StartIndex) * SampleLength);
-				TraversedDistance += SampleLength;
-			}
-			else
-			{
-				PrevPosition = NextPosition;
-
-				while (Remainder > 0)
-				{
-					StartIndex = EndIndex++;
-
-					if (EndIndex >= InTransforms.Num())
-					{
-						if (!Path->IsClosedLoop())
-						{
-							EndIndex = InTransforms.Num() - 1;
-							break;
-						}
-
-						EndIndex = 0;
-					}
-
-					NextPosition = InTransforms[EndIndex].GetLocation();
-					DistToNext = FVector::Dist(PrevPosition, NextPosition);
-
-					if (Remainder <= DistToNext) { PrevPosition = PrevPosition + (Path->DirToPrevPoint(EndIndex) * -Remainder); }
-					else { PrevPosition = NextPosition; }
-					Remainder -= DistToNext;
-				}
-			}
-
-			Sample.End = EndIndex;
-			Sample.Location = PrevPosition;
-			Sample.Distance = TraversedDistance;
-		}
-
-		if (bPreserveLastPoint && !Path->IsClosedLoop())
-		{
-			FPointSample& LastSample = Samples.Last();
-			LastSample.Start = InTransforms.Num() - 2;
-			LastSample.End = InTransforms.Num() - 1;
-			LastSample.Location = InTransforms[LastSample.End].GetLocation();
-			LastSample.Distance = TraversedDistance;
-		}
+		PCGExPaths::Kernels::Sample(PathSoA, Samples);
 
 		if (Settings->Mode == EPCGExResampleMode::Sweep)
 		{
@@ -242,9 +176,9 @@ namespace PCGExResamplePath
 		{
 			PCGEX_SCOPE_LOOP(Index)
 			{
-				const FPointSample& Sample = Samples[Index];
-				OutTransforms[Index].SetLocation(Sample.Location);
-				if (Settings->bEnsureUniqueSeeds) { OutSeed[Index] = PCGExRandomHelpers::ComputeSpatialSeed(Sample.Location); }
+				const FVector Location = Samples.GetPos(Index);
+				OutTransforms[Index].SetLocation(Location);
+				if (Settings->bEnsureUniqueSeeds) { OutSeed[Index] = PCGExRandomHelpers::ComputeSpatialSeed(Location); }
 			}
 		}
 		else
@@ -254,39 +188,15 @@ namespace PCGExResamplePath
 
 			PCGEX_SCOPE_LOOP(Index)
 			{
-				const FPointSample& Sample = Samples[Index];
-
-				OutTransforms[Index].SetLocation(Sample.Location);
+				const FVector Location = Samples.GetPos(Index);
 
-				if (Settings->bEnsureUniqueSeeds) { OutSeed[Index] = PCGExRandomHelpers::ComputeSpatialSeed(Sample.Location); }
+				OutTransforms[Index].SetLocation(Location);
 
-				const FVector Start = Path->GetPos(Sample.Start);
-				const double SampleBreadth = FVector::Dist(Start, Path->GetPos(Sample.End));
+				if (Settings->bEnsureUniqueSeeds) { OutSeed[Index] = PCGExRandomHelpers::ComputeSpatialSeed(Location); }
 
-				//if (SourcesRange == 1)
-				//{
-				const double Weight = SampleBreadth > 0 ? FVector::Dist(Start, Sample.Location) / SampleBreadth : 0.5;
-				MetadataBlender->Blend(Sample.Start, Sample.End, Index, Weight);
-				//}
-
-				/*
-				// TODO : Complex blending
-				const double MinLength = Sample.Start == 0 ? 0 : PathLength->CumulativeLength[Sample.Start - 1];
-				const double MaxLength = PathLength->CumulativeLength[Path->IsValidEdgeIndex(Sample.End) ? PathLength->TotalLength : Sample.End - 1];
-				const double Range = MaxLength - MinLength;
-				
-				for (int i = 0; i < SourcesRange; i++)
-				{
-					const int 
-					PCGExPaths::FPathEdge& Edge = Path->Edges[Sample.Start + i - 1];
-					const double Weight =  
-				}
-		
-				if (Path->IsValidEdgeIndex(Sample.End))
-				{
-					// Blend with end
-				}
-				*/
+				const int32 Edge = Samples.Edges[Index];
+				const double Weight = PathSoA.GetEdgeLength(Edge) > 0 ? Samples.Alphas[Index] : 0.5;
+				MetadataBlender->Blend(Edge, PathSoA.GetEdgeEnd(Edge), Index, Weight);
 			}
 		}
 	}
@@ -108,6 +108,9 @@ namespace PCGExSubdivide
 
 		bClosedLoop = PCGExPaths::Helpers::GetClosedLoop(PointDataFacade->GetOut());
 
+		// Segment lengths come out of the SoA load in a single pass, instead of per-point transform reads
+		PathSoA.Load(PointDataFacade->GetIn()->GetConstTransformValueRange(), bClosedLoop);
+
 		if (Settings->SubdivideMethod == EPCGExSubdivideMode::Manhattan)
 		{
 			ManhattanDetails = Settings->ManhattanDetails;
@@ -141,18 +144,16 @@ namespace PCGExSubdivide
 		PointDataFacade->Fetch(Scope);
 		FilterScope(Scope);
 
-		TConstPCGValueRange<FTransform> InTransforms = PointDataFacade->GetIn()->GetConstTransformValueRange();
+		const int32 NumEdges = PathSoA.NumEdges();
 
 		PCGEX_SCOPE_LOOP(Index)
 		{
-			const TSharedRef<PCGExData::FPointIO>& PointIO = PointDataFacade->Source;
-
 			FSubdivision& Sub = Subdivisions[Index];
 
 			Sub.NumSubdivisions = 0;
 			Sub.InStart = Index;
-			Sub.InEnd = Index + 1 == PointIO->GetNum() ? 0 : Index + 1;
-			Sub.Dist = FVector::Distance(InTransforms[Sub.InEnd].GetLocation(), InTransforms[Sub.InStart].GetLocation());
+			Sub.InEnd = PathSoA.GetEdgeEnd(Index);
+			Sub.Dist = Index < NumEdges ? PathSoA.GetEdgeLength(Index) : FVector::Distance(PathSoA.GetPos(Sub.InEnd), PathSoA.GetPos(Sub.InStart));
 
 			if (!PointFilterCache[Index]) { continue; }
 
@@ -160,7 +161,7 @@ namespace PCGExSubdivide
 			{
 				TSharedPtr<TArray<FVector>> Subs = MakeShared<TArray<FVector>>();
 				TArray<FVector>& SubPoints = *Subs.Get();
-				Sub.NumSubdivisions = ManhattanDetails.ComputeSubdivisions(InTransforms[Sub.InStart].GetLocation(), InTransforms[Sub.InEnd].GetLocation(), Index, SubPoints, Sub.Dist);
+				Sub.NumSubdivisions = ManhattanDetails.ComputeSubdivisions(PathSoA.GetPos(Sub.InStart), PathSoA.GetPos(Sub.InEnd), Index, SubPoints, Sub.Dist);
 
 				if (Sub.NumSubdivisions > 0) { ManhattanPoints[Index] = Subs; }
 
@@ -283,7 +284,6 @@ namespace PCGExSubdivide
 
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
-		TConstPCGValueRange<FTransform> InTransforms = PointDataFacade->GetIn()->GetConstTransformValueRange();
 		TPCGValueRange<FTransform> OutTransforms = PointDataFacade->GetOut()->GetTransformValueRange(false);
 		TPCGValueRange<int32> OutSeeds = PointDataFacade->GetOut()->GetSeedValueRange(false);
 
@@ -297,8 +297,8 @@ namespace PCGExSubdivide
 
 			if (Sub.NumSubdivisions == 0) { continue; }
 
-			const FVector Start = InTransforms[Sub.InStart].GetLocation();
-			const FVector End = InTransforms[Sub.InEnd].GetLocation();
+			const FVector Start = PathSoA.GetPos(Sub.InStart);
+			const FVector End = PathSoA.GetPos(Sub.InEnd);
 			const FVector Dir = (End - Start).GetSafeNormal();
 
 			PCGExPaths::FPathMetrics Metrics = PCGExPaths::FPathMetrics(Start);
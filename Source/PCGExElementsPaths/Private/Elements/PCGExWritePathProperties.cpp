@@ -226,10 +226,10 @@ namespace PCGExWritePathProperties
 		FVector PathDir = Details[0].ToNext;
 
 		// Compute path-wide data (DistanceToStart/DistanceToEnd/PointTime are now computed in parallel in ProcessPoints)
+		if (Settings->bTagConcave || Settings->bTagConvex) { Path->ComputeConvexity(); }
+
 		for (int i = 0; i < Path->NumPoints; i++)
 		{
-			if (Settings->bTagConcave || Settings->bTagConvex) { Path->UpdateConvexity(i); }
-
 			PathDir += Details[i].ToNext;
 			PathCentroid += Path->GetPos_Unsafe(i);
 		}
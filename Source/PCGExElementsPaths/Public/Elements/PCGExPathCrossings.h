@@ -25,6 +25,7 @@ namespace PCGExPaths
 	struct FPathEdgeCrossings;
 	class FPathEdgeLength;
 	class FPath;
+	class FPathEdgeBVH;
 }
 
 /**
@@ -177,8 +178,12 @@ protected:
 
 namespace PCGExPathCrossings
 {
+	class FBatch;
+
 	class FProcessor final : public PCGExPointsMT::TProcessor<FPCGExPathCrossingsContext, UPCGExPathCrossingsSettings>
 	{
+		friend class FBatch;
+
 		bool bClosedLoop = false;
 		bool bSelfIntersectionOnly = false;
 		bool bCanCut = true;
@@ -230,4 +235,19 @@ namespace PCGExPathCrossings
 
 		virtual void Write() override;
 	};
+
+	class FBatch final : public PCGExPointsMT::TBatch<FProcessor>
+	{
+	public:
+		/** Cutter paths, BVH items' PathIndex refers to this array */
+		TArray<TSharedPtr<PCGExPaths::FPath>> Cutters;
+
+		/** Edges of all cutters, shared by every processor */
+		TSharedPtr<PCGExPaths::FPathEdgeBVH> CutterBVH;
+
+		explicit FBatch(FPCGExContext* InContext, const TArray<TWeakPtr<PCGExData::FPointIO>>& InPointsCollection);
+
+	protected:
+		virtual void OnInitialPostProcess() override;
+	};
 }
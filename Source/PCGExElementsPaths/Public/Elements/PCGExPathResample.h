@@ -9,15 +9,10 @@
 #include "Blenders/PCGExMetadataBlender.h"
 #include "Details/PCGExInputShorthandsDetails.h"
 #include "Math/PCGExMath.h"
+#include "Paths/PCGExPathKernels.h"
 
 #include "PCGExPathResample.generated.h"
 
-namespace PCGExPaths
-{
-	class FPathEdgeLength;
-	class FPath;
-}
-
 UENUM()
 enum class EPCGExResampleMode : uint8
 {
@@ -103,26 +98,17 @@ protected:
 
 namespace PCGExResamplePath
 {
-	struct FPointSample
-	{
-		int32 Start = 0;
-		int32 End = 1;
-		FVector Location = FVector::ZeroVector;
-		double Distance = 0;
-	};
-
 	class FProcessor final : public PCGExPointsMT::TProcessor<FPCGExResamplePathContext, UPCGExResamplePathSettings>
 	{
 		bool bPreserveLastPoint = false;
 		bool bAutoSampleSize = false;
 		int32 NumSamples = 0;
 		double SampleLength = 0;
-		TArray<FPointSample> Samples;
 
-		TSharedPtr<PCGExBlending::FMetadataBlender> MetadataBlender;
+		PCGExPaths::FPathSoA PathSoA;
+		PCGExPaths::FPathSamples Samples;
 
-		TSharedPtr<PCGExPaths::FPath> Path;
-		TSharedPtr<PCGExPaths::FPathEdgeLength> PathLength;
+		TSharedPtr<PCGExBlending::FMetadataBlender> MetadataBlender;
 
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
@@ -10,6 +10,7 @@
 #include "Core/PCGExPathProcessor.h"
 #include "Details/PCGExSubdivisionDetails.h"
 #include "Details/PCGExSettingsMacros.h"
+#include "Paths/PCGExPathKernels.h"
 
 #include "PCGExSubdivide.generated.h"
 
@@ -142,6 +143,7 @@ namespace PCGExSubdivide
 		bool bIsManhattan = false;
 		FPCGExManhattanDetails ManhattanDetails;
 		TArray<TSharedPtr<TArray<FVector>>> ManhattanPoints;
+		PCGExPaths::FPathSoA PathSoA;
 
 		double ConstantAmount = 0;
 
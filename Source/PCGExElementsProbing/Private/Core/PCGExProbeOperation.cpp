@@ -60,6 +60,12 @@ void FPCGExProbeOperation::ProcessAll(TSet<uint64>& OutEdges) const
 {
 }
 
+bool FPCGExProbeOperation::ProcessAllSliced(TSet<uint64>& OutEdges, const PCGExMT::FResumableJob& Job)
+{
+	ProcessAll(OutEdges);
+	return true;
+}
+
 double FPCGExProbeOperation::GetSearchRadius(const int32 Index) const
 {
 	return FMath::Square(SearchRadius->Read(Index) + SearchRadiusOffset);
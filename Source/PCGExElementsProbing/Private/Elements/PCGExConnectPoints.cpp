@@ -4,6 +4,7 @@
 #include "Elements/PCGExConnectPoints.h"
 
 #include "Containers/PCGExScopedContainers.h"
+#include "Core/PCGExMT.h"
 #include "Core/PCGExPointFilter.h"
 #include "Data/PCGExClusterData.h"
 #include "Data/PCGExData.h"
@@ -297,18 +298,23 @@ namespace PCGExConnectPoints
 				This->AdvanceCompletion();
 			};
 
+			// Global probes are sequential and can run for a long time; time-slice them so they yield & cancel promptly
+			PCGExMT::IAsyncHandleGroup::FRegistrationGuard Guard(GlobalOpsTasks);
+
 			for (FPCGExProbeOperation* Operation : GlobalOperations)
 			{
-				GlobalOpsTasks->AddSimpleCallback([PCGEX_ASYNC_THIS_CAPTURE, Op = Operation]()
+				PCGEX_MAKE_SHARED(LocalEdges, TSet<uint64>)
+				PCGEX_MAKE_SHARED(Job, PCGExMT::FResumableJob)
+
+				Job->OnSliceCallback = [Op = Operation, LocalEdges](const PCGExMT::FResumableJob& InJob) { return Op->ProcessAllSliced(*LocalEdges, InJob); };
+				Job->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE, LocalEdges]()
 				{
 					PCGEX_ASYNC_THIS
-					TSet<uint64> LocalEdges;
-					Op->ProcessAll(LocalEdges);
-					if (!LocalEdges.IsEmpty()) { This->AppendEdges(LocalEdges); }
-				});
-			}
+					if (!LocalEdges->IsEmpty()) { This->AppendEdges(*LocalEdges); }
+				};
 
-			GlobalOpsTasks->StartSimpleCallbacks();
+				Job->Start(GlobalOpsTasks);
+			}
 		}
 	}
 
@@ -419,11 +425,8 @@ namespace PCGExConnectPoints
 
 	void FProcessor::OnPointsProcessingComplete()
 	{
-		{
-			FWriteScopeLock WriteScopeLock(UniqueEdgesLock);
-			ScopedEdges->Collapse(UniqueEdges);
-		}
-
+		// Flatten in parallel rather than merging scopes into a single set; the graph dedupes on insertion anyway
+		ScopedEdges->Flatten(ScopedUniqueEdges);
 		ScopedEdges.Reset();
 
 		AdvanceCompletion();
@@ -433,6 +436,12 @@ namespace PCGExConnectPoints
 	{
 		if (FPlatformAtomics::InterlockedDecrement(&NumCompletions)) { return; }
 
+		if (!ScopedUniqueEdges.IsEmpty())
+		{
+			GraphBuilder->Graph->InsertEdges(ScopedUniqueEdges, -1);
+			ScopedUniqueEdges.Empty();
+		}
+
 		GraphBuilder->Graph->InsertEdges_Unsafe(UniqueEdges, -1);
 		GraphBuilder->CompileAsync(TaskManager, true);
 	}
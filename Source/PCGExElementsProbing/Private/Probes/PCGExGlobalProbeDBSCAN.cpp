@@ -3,11 +3,13 @@
 
 #include "Probes/PCGExGlobalProbeDBSCAN.h"
 #include "Data/PCGExPointIO.h"
+#include "Async/ParallelFor.h"
+#include "Math/PCGExHashGrid.h"
 
 PCGEX_CREATE_PROBE_FACTORY(DBSCAN, {}, {})
 
 bool FPCGExProbeDBSCAN::IsGlobalProbe() const { return true; }
-bool FPCGExProbeDBSCAN::WantsOctree() const { return true; }
+bool FPCGExProbeDBSCAN::WantsOctree() const { return false; }
 
 bool FPCGExProbeDBSCAN::Prepare(FPCGExContext* InContext)
 {
@@ -23,36 +25,39 @@ void FPCGExProbeDBSCAN::ProcessAll(TSet<uint64>& OutEdges) const
 	const TArray<int8>& CanGenerateRef = *CanGenerate;
 	const TArray<int8>& AcceptConnectionsRef = *AcceptConnections;
 
+	// Fixed-radius queries over every point, a uniform grid sized after the largest radius beats the octree
+	double MaxDist = 0;
+	for (int32 i = 0; i < NumPoints; ++i)
+	{
+		if (!CanGenerateRef[i] && !AcceptConnectionsRef[i]) { continue; }
+		MaxDist = FMath::Max(MaxDist, FMath::Sqrt(GetSearchRadius(i)));
+	}
+
+	PCGExSpatial::FHashGrid Grid;
+	Grid.Build(Positions, MaxDist);
+
 	// First pass: identify core points and their neighbors
 	TArray<TArray<int32>> Neighborhoods;
 	TArray<bool> IsCore;
 	Neighborhoods.SetNum(NumPoints);
 	IsCore.Init(false, NumPoints);
 
-	for (int32 i = 0; i < NumPoints; ++i)
+	ParallelFor(NumPoints, [&](const int32 i)
 	{
-		if (!CanGenerateRef[i] && !AcceptConnectionsRef[i]) { continue; }
-
-		const FVector& Pos = Positions[i];
-		const double MaxDistSq = GetSearchRadius(i);
-		const double MaxDist = FMath::Sqrt(MaxDistSq);
+		if (!CanGenerateRef[i] && !AcceptConnectionsRef[i]) { return; }
 
-		Octree->FindElementsWithBoundsTest(
-			FBox(Pos - FVector(MaxDist), Pos + FVector(MaxDist)),
-			[&](const PCGExOctree::FItem& Other)
+		Grid.ForEachInRadius(
+			Positions[i], FMath::Sqrt(GetSearchRadius(i)),
+			[&](const int32 j, const double)
 			{
-				const int32 j = Other.Index;
 				if (i == j) { return; }
 				if (!CanGenerateRef[j] && !AcceptConnectionsRef[j]) { return; }
 
-				if (FVector::DistSquared(Pos, Positions[j]) <= MaxDistSq)
-				{
-					Neighborhoods[i].Add(j);
-				}
+				Neighborhoods[i].Add(j);
 			});
 
 		IsCore[i] = Neighborhoods[i].Num() >= Config.MinPoints;
-	}
+	});
 
 	// Second pass: create edges
 	for (int32 i = 0; i < NumPoints; ++i)
@@ -2,6 +2,7 @@
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #include "Probes/PCGExGlobalProbeSpanner.h"
+#include "Core/PCGExMT.h"
 #include "Data/PCGExPointIO.h"
 
 PCGEX_CREATE_PROBE_FACTORY(Spanner, {}, {})
@@ -51,57 +52,91 @@ double FPCGExProbeSpanner::GetGraphDistance(int32 From, int32 To,
 	return MAX_dbl; // Not reachable
 }
 
-void FPCGExProbeSpanner::ProcessAll(TSet<uint64>& OutEdges) const
+void FPCGExProbeSpanner::GatherCandidates(TArray<FEdgeCandidate>& OutCandidates) const
 {
 	const TArray<FVector>& Positions = *WorkingPositions;
 	const int32 NumPoints = Positions.Num();
-	if (NumPoints < 2) { return; }
 
 	const TArray<int8>& CanGenerateRef = *CanGenerate;
 	const TArray<int8>& AcceptConnectionsRef = *AcceptConnections;
 
-	// Build sorted list of all candidate edges
-	struct FEdgeCandidate
-	{
-		int32 A, B;
-		double Dist;
-	};
-
-	TArray<FEdgeCandidate> Candidates;
-	Candidates.Reserve(FMath::Min(Config.MaxEdgeCandidates, NumPoints * (NumPoints - 1) / 2));
+	OutCandidates.Reserve(FMath::Min(Config.MaxEdgeCandidates, NumPoints * (NumPoints - 1) / 2));
 
-	for (int32 i = 0; i < NumPoints && Candidates.Num() < Config.MaxEdgeCandidates; ++i)
+	for (int32 i = 0; i < NumPoints && OutCandidates.Num() < Config.MaxEdgeCandidates; ++i)
 	{
 		if (!CanGenerateRef[i] && !AcceptConnectionsRef[i]) { continue; }
 
-		for (int32 j = i + 1; j < NumPoints && Candidates.Num() < Config.MaxEdgeCandidates; ++j)
+		for (int32 j = i + 1; j < NumPoints && OutCandidates.Num() < Config.MaxEdgeCandidates; ++j)
 		{
 			if (!CanGenerateRef[j] && !AcceptConnectionsRef[j]) { continue; }
 			if (!CanGenerateRef[i] && !CanGenerateRef[j]) { continue; }
 
-			Candidates.Add({i, j, FVector::Dist(Positions[i], Positions[j])});
+			OutCandidates.Add({i, j, FVector::Dist(Positions[i], Positions[j])});
 		}
 	}
 
 	// Sort by distance (greedy processes shortest first)
-	Algo::Sort(Candidates, [](const FEdgeCandidate& A, const FEdgeCandidate& B) { return A.Dist < B.Dist; });
+	Algo::Sort(OutCandidates, [](const FEdgeCandidate& A, const FEdgeCandidate& B) { return A.Dist < B.Dist; });
+}
+
+void FPCGExProbeSpanner::TryAddEdge(const FEdgeCandidate& Edge, TArray<TSet<int32>>& Adjacency, TSet<uint64>& OutEdges) const
+{
+	// Check if current graph distance exceeds t * Euclidean distance
+	const double GraphDist = GetGraphDistance(Edge.A, Edge.B, Adjacency, *WorkingPositions);
+
+	if (GraphDist > Config.StretchFactor * Edge.Dist)
+	{
+		// Add edge
+		OutEdges.Add(PCGEx::H64U(Edge.A, Edge.B));
+		Adjacency[Edge.A].Add(Edge.B);
+		Adjacency[Edge.B].Add(Edge.A);
+	}
+}
+
+void FPCGExProbeSpanner::ProcessAll(TSet<uint64>& OutEdges) const
+{
+	const int32 NumPoints = WorkingPositions->Num();
+	if (NumPoints < 2) { return; }
+
+	// Build sorted list of all candidate edges
+	TArray<FEdgeCandidate> Candidates;
+	GatherCandidates(Candidates);
 
 	// Build adjacency list for path queries
 	TArray<TSet<int32>> Adjacency;
 	Adjacency.SetNum(NumPoints);
 
 	// Greedy spanner construction
-	for (const FEdgeCandidate& Edge : Candidates)
+	for (const FEdgeCandidate& Edge : Candidates) { TryAddEdge(Edge, Adjacency, OutEdges); }
+}
+
+bool FPCGExProbeSpanner::ProcessAllSliced(TSet<uint64>& OutEdges, const PCGExMT::FResumableJob& Job)
+{
+	const int32 NumPoints = WorkingPositions->Num();
+	if (NumPoints < 2) { return true; }
+
+	if (NextCandidate < 0)
 	{
-		// Check if current graph distance exceeds t * Euclidean distance
-		const double GraphDist = GetGraphDistance(Edge.A, Edge.B, Adjacency, Positions);
+		GatherCandidates(SlicedCandidates);
+		SlicedAdjacency.SetNum(NumPoints);
+		NextCandidate = 0;
+	}
 
-		if (GraphDist > Config.StretchFactor * Edge.Dist)
+	const int32 NumCandidates = SlicedCandidates.Num();
+	while (NextCandidate < NumCandidates)
+	{
+		TryAddEdge(SlicedCandidates[NextCandidate++], SlicedAdjacency, OutEdges);
+
+		if (NextCandidate < NumCandidates && Job.ShouldYield())
 		{
-			// Add edge
-			OutEdges.Add(PCGEx::H64U(Edge.A, Edge.B));
-			Adjacency[Edge.A].Add(Edge.B);
-			Adjacency[Edge.B].Add(Edge.A);
+			Job.SetProgress(static_cast<float>(NextCandidate) / static_cast<float>(NumCandidates));
+			return false;
 		}
 	}
+
+	SlicedCandidates.Empty();
+	SlicedAdjacency.Empty();
+	NextCandidate = -1;
+
+	return true;
 }
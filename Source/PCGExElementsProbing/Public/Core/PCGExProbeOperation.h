@@ -16,6 +16,7 @@
 namespace PCGExMT
 {
 	class FScopedContainer;
+	class FResumableJob;
 }
 
 namespace PCGExData
@@ -89,6 +90,9 @@ public:
 
 	virtual void ProcessAll(TSet<uint64>& OutEdges) const;
 
+	/** Time-sliced ProcessAll, returns true once done. Long-running global probes override this and keep their state between slices. */
+	virtual bool ProcessAllSliced(TSet<uint64>& OutEdges, const PCGExMT::FResumableJob& Job);
+
 	FPCGExProbeConfigBase* BaseConfig = nullptr;
 	const PCGExOctree::FItemOctree* Octree = nullptr;
 	const TArray<FTransform>* WorkingTransforms = nullptr;
@@ -134,6 +134,7 @@ namespace PCGExConnectPoints
 
 		mutable FRWLock UniqueEdgesLock;
 		TSharedPtr<PCGExMT::TScopedSet<uint64>> ScopedEdges;
+		TArray<uint64> ScopedUniqueEdges; // Unique per scope only
 		TSet<uint64> UniqueEdges;
 
 		FPCGExGeo2DProjectionDetails ProjectionDetails;
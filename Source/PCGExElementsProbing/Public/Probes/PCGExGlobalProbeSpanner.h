@@ -34,10 +34,26 @@ public:
 	virtual bool IsGlobalProbe() const override;
 	virtual bool Prepare(FPCGExContext* InContext) override;
 	virtual void ProcessAll(TSet<uint64>& OutEdges) const override;
+	virtual bool ProcessAllSliced(TSet<uint64>& OutEdges, const PCGExMT::FResumableJob& Job) override;
 
 	FPCGExProbeConfigSpanner Config;
 
 protected:
+	struct FEdgeCandidate
+	{
+		int32 A, B;
+		double Dist;
+	};
+
+	// Greedy construction state, kept across slices
+	TArray<FEdgeCandidate> SlicedCandidates;
+	TArray<TSet<int32>> SlicedAdjacency;
+	int32 NextCandidate = -1;
+
+	// Candidate edges, sorted shortest first
+	void GatherCandidates(TArray<FEdgeCandidate>& OutCandidates) const;
+	void TryAddEdge(const FEdgeCandidate& Edge, TArray<TSet<int32>>& Adjacency, TSet<uint64>& OutEdges) const;
+
 	// Dijkstra helper - returns shortest path distance between two nodes in current graph
 	double GetGraphDistance(int32 From, int32 To, const TArray<TSet<int32>>& Adjacency,
 	                        const TArray<FVector>& Positions) const;
@@ -9,6 +9,7 @@
 #include "Data/PCGExPointIO.h"
 #include "Helpers/PCGExArrayHelpers.h"
 #include "Math/PCGExMathBounds.h"
+#include "Math/PCGExSweepAndPrune.h"
 
 
 #define LOCTEXT_NAMESPACE "PCGExDiscardByOverlapElement"
@@ -336,6 +337,28 @@ namespace PCGExDiscardByOverlap
 	{
 		const TConstPCGValueRange<FTransform> InTransforms = InPoints->GetConstTransformValueRange();
 
+		// Points of a processor whose bounds touch the overlapping region
+		auto GatherPoints = [](const FProcessor& InProcessor, const FBox& InIntersection, TArray<const FPointBounds*>& OutPoints, TArray<FBox>& OutBoxes)
+		{
+			const FPointBoundsOctree* PointsOctree = InProcessor.GetOctree();
+			if (!PointsOctree) { return; }
+
+			PointsOctree->FindElementsWithBoundsTest(FBoxCenterAndExtent(InIntersection.GetCenter(), InIntersection.GetExtent()), [&](const FPointBounds* PtBounds)
+			{
+				const FBox Box = PtBounds->Bounds.GetBox();
+				if (!Box.Intersect(InIntersection)) { return; }
+
+				OutPoints.Add(PtBounds);
+				OutBoxes.Add(Box);
+			});
+		};
+
+		TArray<const FPointBounds*> LocalPoints;
+		TArray<FBox> LocalBoxes;
+		TArray<const FPointBounds*> OtherPoints;
+		TArray<FBox> OtherBoxes;
+		TArray<FInt32Point> Pairs;
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			// For each managed overlap, find per-point intersections
@@ -343,47 +366,54 @@ namespace PCGExDiscardByOverlap
 			const TSharedPtr<FOverlap> Overlap = ManagedOverlaps[Index];
 			const TSharedRef<FProcessor> OtherProcessor = StaticCastSharedRef<FProcessor>(*ParentBatch.Pin()->SubProcessorMap->Find(&Overlap->GetOther(this)->PointDataFacade->Source.Get()));
 
+			LocalPoints.Reset();
+			LocalBoxes.Reset();
+			OtherPoints.Reset();
+			OtherBoxes.Reset();
+
+			GatherPoints(*this, Overlap->Intersection, LocalPoints, LocalBoxes);
+			GatherPoints(*OtherProcessor, Overlap->Intersection, OtherPoints, OtherBoxes);
+
+			// Broad phase over both sides at once, rather than one octree query per local point
+			PCGExMath::SweepAndPrune::FindOverlaps(LocalBoxes, OtherBoxes, Pairs);
 
 			if (Settings->TestMode != EPCGExOverlapTestMode::Sphere)
 			{
-				Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Overlap->Intersection.GetCenter(), Overlap->Intersection.GetExtent()), [&](const FPointBounds* LocalPoint)
+				for (const FInt32Point& Pair : Pairs)
 				{
+					const FPointBounds* LocalPoint = LocalPoints[Pair.X];
+					const FPointBounds* OtherPoint = OtherPoints[Pair.Y];
+
 					const double Length = LocalPoint->LocalBounds.GetExtent().Length() * 2;
 					const FMatrix InvMatrix = InTransforms[LocalPoint->Index].ToMatrixNoScale().Inverse();
 
-					OtherProcessor->GetOctree()->FindElementsWithBoundsTest(FBoxCenterAndExtent(LocalPoint->Bounds.GetBox()), [&](const FPointBounds* OtherPoint)
-					{
-						const FBox Intersection = LocalPoint->LocalBounds.Overlap(OtherPoint->TransposedBounds(InvMatrix));
+					const FBox Intersection = LocalPoint->LocalBounds.Overlap(OtherPoint->TransposedBounds(InvMatrix));
 
-						if (!Intersection.IsValid) { return; }
+					if (!Intersection.IsValid) { continue; }
 
-						const double Amount = Intersection.GetExtent().Length() * 2;
-						if (Settings->ThresholdMeasure == EPCGExMeanMeasure::Relative) { if ((Amount / Length) < Settings->MinThreshold) { return; } }
-						else if (Amount < Settings->MinThreshold) { return; }
+					const double Amount = Intersection.GetExtent().Length() * 2;
+					if (Settings->ThresholdMeasure == EPCGExMeanMeasure::Relative) { if ((Amount / Length) < Settings->MinThreshold) { continue; } }
+					else if (Amount < Settings->MinThreshold) { continue; }
 
-						Overlap->Stats.OverlapCount++;
-						Overlap->Stats.OverlapVolume += Intersection.GetVolume();
-					});
-				});
+					Overlap->Stats.OverlapCount++;
+					Overlap->Stats.OverlapVolume += Intersection.GetVolume();
+				}
 			}
 			else
 			{
-				Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Overlap->Intersection.GetCenter(), Overlap->Intersection.GetExtent()), [&](const FPointBounds* OwnedPoint)
+				for (const FInt32Point& Pair : Pairs)
 				{
-					const FSphere S1 = OwnedPoint->Bounds.GetSphere();
+					const FSphere S1 = LocalPoints[Pair.X]->Bounds.GetSphere();
 
-					OtherProcessor->GetOctree()->FindElementsWithBoundsTest(FBoxCenterAndExtent(OwnedPoint->Bounds.GetBox()), [&](const FPointBounds* OtherPoint)
-					{
-						double Amount = 0;
-						if (!PCGExMath::SphereOverlap(S1, OtherPoint->Bounds.GetSphere(), Amount)) { return; }
+					double Amount = 0;
+					if (!PCGExMath::SphereOverlap(S1, OtherPoints[Pair.Y]->Bounds.GetSphere(), Amount)) { continue; }
 
-						if (Settings->ThresholdMeasure == EPCGExMeanMeasure::Relative) { if ((Amount / S1.W) < Settings->MinThreshold) { return; } }
-						else { if (Amount < Settings->MinThreshold) { return; } }
+					if (Settings->ThresholdMeasure == EPCGExMeanMeasure::Relative) { if ((Amount / S1.W) < Settings->MinThreshold) { continue; } }
+					else { if (Amount < Settings->MinThreshold) { continue; } }
 
-						Overlap->Stats.OverlapCount++;
-						Overlap->Stats.OverlapVolume += Amount;
-					});
-				});
+					Overlap->Stats.OverlapCount++;
+					Overlap->Stats.OverlapVolume += Amount;
+				}
 			}
 		}
 	}
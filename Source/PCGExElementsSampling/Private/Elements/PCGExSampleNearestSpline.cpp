@@ -9,6 +9,7 @@
 #include "Data/PCGExPointIO.h"
 #include "Details/PCGExSettingsDetails.h"
 #include "Math/PCGExMathDistances.h"
+#include "Paths/PCGExSplineBVH.h"
 #include "Sampling/PCGExSamplingHelpers.h"
 #include "Types/PCGExTypes.h"
 
@@ -130,6 +131,14 @@ bool FPCGExSampleNearestSplineElement::Boot(FPCGExContext* InContext) const
 	Context->SegmentCounts.SetNumUninitialized(Context->NumTargets);
 	Context->Lengths.SetNumUninitialized(Context->NumTargets);
 
+	if (Settings->bUseSegmentBVH)
+	{
+		TArray<const FPCGSplineStruct*> SplinePtrs;
+		SplinePtrs.Reserve(Context->NumTargets);
+		for (const FPCGSplineStruct& Spline : Context->Splines) { SplinePtrs.Add(&Spline); }
+		PCGExPaths::Helpers::BuildSplineBVHs(SplinePtrs, Context->SplineBVHs, Settings->SegmentBVHTolerance);
+	}
+
 	TArray<FVector> SplinePoints;
 	for (int i = 0; i < Context->NumTargets; i++)
 	{
@@ -137,7 +146,13 @@ bool FPCGExSampleNearestSplineElement::Boot(FPCGExContext* InContext) const
 		Context->SegmentCounts[i] = Spline.GetNumberOfSplineSegments();
 		Context->Lengths[i] = Spline.GetSplineLength();
 
-		if (Settings->bUseOctree)
+		if (Settings->bUseOctree && Settings->bUseSegmentBVH)
+		{
+			// BVH bounds are already tight, no need to convert the spline to a polyline
+			const FBox& Box = SplineBounds.Add_GetRef(Context->SplineBVHs[i]->GetWorldBounds());
+			Context->OctreeBounds += Box;
+		}
+		else if (Settings->bUseOctree)
 		{
 			Spline.ConvertSplineToPolyLine(ESplineCoordinateSpace::World, FMath::Square(50), SplinePoints);
 
@@ -434,10 +449,11 @@ namespace PCGExSampleNearestSpline
 			// First: Sample all valid targets
 			if (!Settings->bSampleSpecificAlpha)
 			{
+				const bool bUseBVH = !Context->SplineBVHs.IsEmpty();
 				auto ProcessClosestAlpha = [&](const int32 TargetIndex)
 				{
 					const FPCGSplineStruct& Line = Context->Splines[TargetIndex];
-					const double Time = Line.FindInputKeyClosestToWorldLocation(Origin);
+					const double Time = bUseBVH ? Context->SplineBVHs[TargetIndex]->FindInputKeyClosestToWorldLocation(Origin) : Line.FindInputKeyClosestToWorldLocation(Origin);
 					ProcessTarget(Line.GetTransformAtSplineInputKey
 					              (static_cast<float>(Time), ESplineCoordinateSpace::World, Settings->bSplineScalesRanges),
 					              Time, Context->SegmentCounts[TargetIndex], Line);
@@ -3,12 +3,14 @@
 
 #include "Elements/PCGExSelfPruning.h"
 
+#include "Async/ParallelFor.h"
 #include "Helpers/PCGExRandomHelpers.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointIO.h"
 #include "Data/PCGPointData.h"
 #include "Details/PCGExSettingsDetails.h"
 #include "Helpers/PCGExArrayHelpers.h"
+#include "Math/PCGExSweepAndPrune.h"
 #include "Math/OBB/PCGExOBBTests.h"
 #include "Sorting/PCGExPointSorter.h"
 #include "Sorting/PCGExSortingDetails.h"
@@ -107,12 +109,12 @@ namespace PCGExSelfPruning
 		if (Settings->Mode == EPCGExSelfPruningMode::WriteResult) { PCGEX_INIT_IO(PointDataFacade->Source, PCGExData::EIOInit::Duplicate) }
 		else { Mask.Init(true, NumPoints); }
 
-		TArray<int32> Order;
 		PCGExArrayHelpers::ArrayOfIndices(Order, NumPoints);
 
-		PCGExArrayHelpers::InitArray(Candidates, NumPoints);
 		Priority.SetNumUninitialized(NumPoints);
+		BoxPrimary.Init(FBox(NoInit), NumPoints);
 		BoxSecondary.Init(FBox(NoInit), NumPoints);
+		BoxDensity.Init(FBox(NoInit), NumPoints);
 
 		// Allocate OBB arrays only when precise testing is enabled
 		if (Settings->bPreciseTest)
@@ -131,7 +133,7 @@ namespace PCGExSelfPruning
 			{
 				if (TSharedPtr<PCGExSorting::FSortCache> Cache = Sorter->BuildCache(NumPoints))
 				{
-					Order.Sort([&](const int32 A, const int32 B) { return Cache->Compare(A, B); });
+					Cache->Sort(Order);
 				}
 				else
 				{
@@ -152,9 +154,6 @@ namespace PCGExSelfPruning
 
 		for (int32 i = 0; i < NumPoints; i++) { Priority[Order[i]] = i; }
 
-		// Only force single-threaded for Prune mode (Mask is shared state)
-		// WriteResult mode can run in parallel since each candidate's overlap count is independent
-		bForceSingleThreadedProcessRange = (Settings->Mode == EPCGExSelfPruningMode::Prune);
 		StartParallelLoopForPoints(PCGExData::EIOSide::In);
 
 		return true;
@@ -168,15 +167,22 @@ namespace PCGExSelfPruning
 		PointDataFacade->Fetch(Scope);
 		FilterScope(Scope);
 
-		PCGEX_SCOPE_LOOP(Index)
+		// Build BoxPrimary (world AABBs of the point being evaluated)
+		switch (Settings->PrimaryMode)
 		{
-			FCandidateInfos& Candidate = Candidates[Index];
-			Candidate.Index = Index;
-			Candidate.bSkip = false;
-			Candidate.Overlaps = 0;
+		case EPCGExSelfPruningExpandOrder::Before:
+			PCGEX_SCOPE_LOOP(Index) { BoxPrimary[Index] = InData->GetLocalBounds(Index).ExpandBy(PrimaryExpansion->Read(Index)).TransformBy(Transforms[Index]); }
+			break;
+		case EPCGExSelfPruningExpandOrder::After:
+			PCGEX_SCOPE_LOOP(Index) { BoxPrimary[Index] = InData->GetLocalBounds(Index).TransformBy(Transforms[Index]).ExpandBy(PrimaryExpansion->Read(Index)); }
+			break;
+		default:
+		case EPCGExSelfPruningExpandOrder::None:
+			PCGEX_SCOPE_LOOP(Index) { BoxPrimary[Index] = InData->GetLocalBounds(Index).TransformBy(Transforms[Index]); }
+			break;
 		}
 
-		// Build BoxSecondary (world AABBs for octree pre-filtering)
+		// Build BoxSecondary (world AABBs of neighbors)
 		switch (Settings->SecondaryMode)
 		{
 		case EPCGExSelfPruningExpandOrder::Before:
@@ -191,6 +197,18 @@ namespace PCGExSelfPruning
 			break;
 		}
 
+		// Bounds the point octree indexes points with; neighbors must overlap them as well
+		PCGEX_SCOPE_LOOP(Index) { BoxDensity[Index] = InData->GetDensityBounds(Index).GetBox(); }
+
+		// Filtered-out points are never neighbors, and are never pruned
+		const bool bPrune = Settings->Mode == EPCGExSelfPruningMode::Prune;
+		PCGEX_SCOPE_LOOP(Index)
+		{
+			if (PointFilterCache[Index]) { continue; }
+			BoxSecondary[Index] = FBox(ForceInit);
+			if (bPrune) { BoxPrimary[Index] = FBox(ForceInit); }
+		}
+
 		// Build pre-computed OBBs for precise testing
 		if (Settings->bPreciseTest)
 		{
@@ -256,123 +274,48 @@ namespace PCGExSelfPruning
 
 	void FProcessor::OnPointsProcessingComplete()
 	{
-		Candidates.Sort([&](const FCandidateInfos& A, const FCandidateInfos& B) { return Priority[A.Index] > Priority[B.Index]; });
-		LastCandidatesCount = Candidates.Num();
+		// Broad phase : sweep & prune over all primary/secondary bounds at once, instead of one octree query per point
+		{
+			TArray<FInt32Point> Pairs;
+			PCGExMath::SweepAndPrune::FindOverlaps(BoxPrimary, BoxSecondary, Pairs);
+			PCGExMath::SweepAndPrune::GroupPairs(Pairs, PointDataFacade->GetNum(), NeighborOffsets, Neighbors);
+		}
 
-		StartParallelLoopForRange(Candidates.Num());
+		NumNeighbors.Init(0, PointDataFacade->GetNum());
+		StartParallelLoopForRange(PointDataFacade->GetNum());
 	}
 
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::SelfPruning::ProcessRange);
 
-		const UPCGBasePointData* InData = PointDataFacade->GetIn();
-		const PCGPointOctree::FPointOctree& Octree = InData->GetPointOctree();
-		TConstPCGValueRange<FTransform> Transforms = InData->GetConstTransformValueRange();
-
-		if (Settings->Mode == EPCGExSelfPruningMode::WriteResult)
-		{
-			PCGEX_SCOPE_LOOP(i)
-			{
-				FCandidateInfos& Candidate = Candidates[i];
-				Candidate.bSkip = true;
-
-				const int32 Index = Candidate.Index;
-				const FTransform& Transform = Transforms[Index];
+		// Narrow phase. Each point only writes to its own neighbor range, so this runs in parallel in both modes
 
-				FBox BoxA = InData->GetLocalBounds(Index);
-				FBox Box = FBox(NoInit);
-				if (Settings->PrimaryMode == EPCGExSelfPruningExpandOrder::Before)
-				{
-					BoxA = BoxA.ExpandBy(PrimaryExpansion->Read(Index));
-					Box = BoxA.TransformBy(Transform);
-				}
-				else if (Settings->PrimaryMode == EPCGExSelfPruningExpandOrder::After)
-				{
-					Box = BoxA.TransformBy(Transform).ExpandBy(PrimaryExpansion->Read(Index));
-					BoxA = BoxA.ExpandBy(PrimaryExpansion->Read(Index));
-				}
-				else
-				{
-					Box = BoxA.TransformBy(Transform);
-				}
+		const bool bPrune = Settings->Mode == EPCGExSelfPruningMode::Prune;
 
-				Octree.FindElementsWithBoundsTest(Box, [&](const PCGPointOctree::FPointRef& Other)
-				{
-					const int32 OtherIndex = Other.Index;
-
-					// Ignore self
-					if (OtherIndex == Index || !PointFilterCache[OtherIndex]) { return; }
-					if (Box.Intersect(BoxSecondary[Other.Index]))
-					{
-						if (Settings->bPreciseTest)
-						{
-							// Use pre-built OBBs instead of constructing them each time
-							if (!PCGExMath::OBB::SATOverlap(PrimaryOBBs[Index], SecondaryOBBs[OtherIndex])) { return; }
-						}
-
-						Candidate.Overlaps++;
-					}
-				});
-			}
-		}
-		else
+		PCGEX_SCOPE_LOOP(Index)
 		{
-			PCGEX_SCOPE_LOOP(i)
-			{
-				FCandidateInfos& Candidate = Candidates[i];
-				Candidate.bSkip = true;
-
-				const int32 Index = Candidate.Index;
-
-				if (!PointFilterCache[Index]) { continue; }
+			const FBox& Box = BoxPrimary[Index];
+			const int32 CurrentPriority = Priority[Index];
 
-				const int32 CurrentPriority = Priority[Index];
-				const FTransform& Transform = Transforms[Index];
-
-
-				FBox BoxA = InData->GetLocalBounds(Index);
-				FBox Box = FBox(NoInit);
-				if (Settings->PrimaryMode == EPCGExSelfPruningExpandOrder::Before)
-				{
-					BoxA = BoxA.ExpandBy(PrimaryExpansion->Read(Index));
-					Box = BoxA.TransformBy(Transform);
-				}
-				else if (Settings->PrimaryMode == EPCGExSelfPruningExpandOrder::After)
-				{
-					Box = BoxA.TransformBy(Transform).ExpandBy(PrimaryExpansion->Read(Index));
-					BoxA = BoxA.ExpandBy(PrimaryExpansion->Read(Index));
-				}
-				else
-				{
-					Box = BoxA.TransformBy(Transform);
-				}
-
-				Octree.FindFirstElementWithBoundsTest(Box, [&](const PCGPointOctree::FPointRef& Other)
-				{
-					const int32 OtherIndex = Other.Index;
-
-					// Ignore self
-					if (OtherIndex == Index || !PointFilterCache[OtherIndex] || !Mask[OtherIndex]) { return true; }
+			int32 WriteIndex = NeighborOffsets[Index];
+			for (int32 i = NeighborOffsets[Index]; i < NeighborOffsets[Index + 1]; i++)
+			{
+				const int32 OtherIndex = Neighbors[i];
 
-					// Ignore lower priorities, those will be pruned by this candidate when their turn comes
-					if (Priority[OtherIndex] < CurrentPriority) { return true; }
+				// Ignore self
+				if (OtherIndex == Index || !Box.Intersect(BoxDensity[OtherIndex])) { continue; }
 
-					if (Box.Intersect(BoxSecondary[OtherIndex]))
-					{
-						if (Settings->bPreciseTest)
-						{
-							// Use pre-built OBBs instead of constructing them each time
-							if (!PCGExMath::OBB::SATOverlap(PrimaryOBBs[Index], SecondaryOBBs[OtherIndex])) { return true; }
-						}
+				// Ignore lower priorities, those will be pruned by this candidate when their turn comes
+				if (bPrune && Priority[OtherIndex] < CurrentPriority) { continue; }
 
-						Mask[Index] = false;
-						return false;
-					}
+				// Use pre-built OBBs instead of constructing them each time
+				if (Settings->bPreciseTest && !PCGExMath::OBB::SATOverlap(PrimaryOBBs[Index], SecondaryOBBs[OtherIndex])) { continue; }
 
-					return true;
-				});
+				Neighbors[WriteIndex++] = OtherIndex;
 			}
+
+			NumNeighbors[Index] = WriteIndex - NeighborOffsets[Index];
 		}
 	}
 
@@ -384,50 +327,93 @@ namespace PCGExSelfPruning
 			{
 				TSharedPtr<PCGExData::TBuffer<double>> Buffer = PointDataFacade->GetWritable<double>(Settings->NumOverlapAttributeName, 0, true, PCGExData::EBufferInit::New);
 				double Max = 0;
-				for (int i = 0; i < Candidates.Num(); i++) { Max = FMath::Max(Max, Candidates[i].Overlaps); }
+				for (int i = 0; i < NumNeighbors.Num(); i++) { Max = FMath::Max<double>(Max, NumNeighbors[i]); }
 
 				if (Max == 0) { return; } // Shoo shoo divide by zero
 
 				if (Settings->bOutputOneMinusOverlap)
 				{
-					for (const FCandidateInfos& Candidate : Candidates) { Buffer->SetValue(Candidate.Index, 1 - (static_cast<double>(Candidate.Overlaps) / Max)); }
+					for (int i = 0; i < NumNeighbors.Num(); i++) { Buffer->SetValue(i, 1 - (static_cast<double>(NumNeighbors[i]) / Max)); }
 				}
 				else
 				{
-					for (const FCandidateInfos& Candidate : Candidates) { Buffer->SetValue(Candidate.Index, (static_cast<double>(Candidate.Overlaps) / Max)); }
+					for (int i = 0; i < NumNeighbors.Num(); i++) { Buffer->SetValue(i, (static_cast<double>(NumNeighbors[i]) / Max)); }
 				}
 			}
 			else
 			{
 				TSharedPtr<PCGExData::TBuffer<int32>> Buffer = PointDataFacade->GetWritable<int32>(Settings->NumOverlapAttributeName, 0, true, PCGExData::EBufferInit::New);
-				for (const FCandidateInfos& Candidate : Candidates) { Buffer->SetValue(Candidate.Index, Candidate.Overlaps); }
+				for (int i = 0; i < NumNeighbors.Num(); i++) { Buffer->SetValue(i, NumNeighbors[i]); }
 			}
 
 			return;
 		}
 
-		int32 WriteIndex = 0;
-		for (int32 i = 0; i < Candidates.Num(); i++)
-		{
-			FCandidateInfos& Candidate = Candidates[i];
-			if (!Candidate.bSkip) { Candidates[WriteIndex++] = MoveTemp(Candidate); }
-		}
+		ResolvePruning();
+	}
 
-		Candidates.SetNum(WriteIndex);
+	void FProcessor::ResolvePruning()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::SelfPruning::ResolvePruning);
+
+		// A point is pruned if it overlaps a higher-priority point that was kept.
+		// Rather than walking points one by one in priority order, every point whose higher-priority neighbors are all decided
+		// can be decided independently. Chunks walk in priority order so chains resolve in a single pass when possible;
+		// a point's outcome never depends on timing, so the result is the same as the sequential walk.
+
+		enum EState : int8 { Pending = 0, Kept = 1, Pruned = 2 };
+
+		const int32 NumPoints = PointDataFacade->GetNum();
+
+		TArray<int8> States;
+		States.Init(Pending, NumPoints);
 
-		if (!Candidates.IsEmpty())
+		constexpr int32 ChunkSize = 1024;
+		const int32 NumChunks = FMath::DivideAndRoundUp(NumPoints, ChunkSize);
+
+		int32 NumPending = NumPoints;
+		while (NumPending > 0)
 		{
-			if (LastCandidatesCount == WriteIndex)
+			TArray<int32> ChunkPending;
+			ChunkPending.Init(0, NumChunks);
+
+			ParallelFor(NumChunks, [&](const int32 Chunk)
 			{
-				// Error
-				// Somehow the last run could not get rid of some overlap, number of candidates hasn't changed
-				// We have to stop iterating now or we'll iterate forever
-				return;
-			}
+				const int32 End = FMath::Min(NumPoints, (Chunk + 1) * ChunkSize);
+				for (int32 i = Chunk * ChunkSize; i < End; i++)
+				{
+					// Highest priority first
+					const int32 Index = Order[NumPoints - 1 - i];
+					if (FPlatformAtomics::AtomicRead(&States[Index]) != Pending) { continue; }
 
-			LastCandidatesCount = WriteIndex;
-			StartParallelLoopForRange(WriteIndex);
+					EState State = Kept;
+					for (int32 n = NeighborOffsets[Index]; n < NeighborOffsets[Index] + NumNeighbors[Index]; n++)
+					{
+						const int8 OtherState = FPlatformAtomics::AtomicRead(&States[Neighbors[n]]);
+						if (OtherState == Kept)
+						{
+							State = Pruned;
+							break;
+						}
+
+						if (OtherState == Pending) { State = Pending; }
+					}
+
+					if (State == Pending) { ChunkPending[Chunk]++; }
+					else { FPlatformAtomics::AtomicStore(&States[Index], static_cast<int8>(State)); }
+				}
+			});
+
+			const int32 LastPending = NumPending;
+
+			NumPending = 0;
+			for (const int32 Count : ChunkPending) { NumPending += Count; }
+
+			// Priorities are unique so there can't be cycles, but don't risk spinning forever
+			if (!ensure(NumPending < LastPending)) { break; }
 		}
+
+		for (int32 i = 0; i < NumPoints; i++) { Mask[i] = States[i] != Pruned; }
 	}
 
 	void FProcessor::CompleteWork()
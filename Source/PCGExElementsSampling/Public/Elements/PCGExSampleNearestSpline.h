@@ -40,6 +40,11 @@ MACRO(TotalWeight, double, 0)
 
 class UPCGExPointFilterFactoryData;
 
+namespace PCGExPaths
+{
+	class FSplineBVH;
+}
+
 namespace PCGExMT
 {
 	template <typename T>
@@ -457,6 +462,14 @@ public:
 	/** Optimize spatial partitioning, but limit the "reach" of splines to their bounding box. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable), AdvancedDisplay)
 	bool bUseOctree = true;
+
+	/** Precompute a BVH over tessellated spline segments to speed up closest-point queries. Highly recommended when sampling many points against many splines. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable), AdvancedDisplay)
+	bool bUseSegmentBVH = true;
+
+	/** Maximum deviation between the tessellated segments and the spline. Only affects query speed, not precision. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, DisplayName=" └─ Tolerance", EditCondition="bUseSegmentBVH", ClampMin=0.01), AdvancedDisplay)
+	double SegmentBVHTolerance = 5;
 };
 
 struct FPCGExSampleNearestSplineContext final : FPCGExPointsProcessorContext
@@ -470,6 +483,8 @@ struct FPCGExSampleNearestSplineContext final : FPCGExPointsProcessorContext
 	TArray<double> SegmentCounts;
 	TArray<double> Lengths;
 
+	TArray<TSharedPtr<PCGExPaths::FSplineBVH>> SplineBVHs;
+
 	FBox OctreeBounds = FBox(ForceInit);
 	TSharedPtr<PCGExOctree::FItemOctree> SplineOctree;
 
@@ -148,15 +148,6 @@ protected:
 
 namespace PCGExSelfPruning
 {
-	struct FCandidateInfos
-	{
-		FCandidateInfos() = default;
-
-		int32 Index = -1;
-		int32 Overlaps = 0;
-		int8 bSkip = 0;
-	};
-
 	class FProcessor final : public PCGExPointsMT::TProcessor<FPCGExSelfPruningContext, UPCGExSelfPruningSettings>
 	{
 	protected:
@@ -164,16 +155,21 @@ namespace PCGExSelfPruning
 		TSharedPtr<PCGExDetails::TSettingValue<double>> SecondaryExpansion;
 
 		TBitArray<> Mask;
+		TArray<int32> Order;
 		TArray<int32> Priority;
-		TArray<FCandidateInfos> Candidates;
+		TArray<FBox> BoxPrimary;
 		TArray<FBox> BoxSecondary;
+		TArray<FBox> BoxDensity;
+
+		// Candidate neighbors from the broad phase, narrowed in-place to actual overlaps (CSR layout)
+		TArray<int32> NeighborOffsets;
+		TArray<int32> Neighbors;
+		TArray<int32> NumNeighbors;
 
 		// Pre-built OBBs for precise testing (only allocated when bPreciseTest is true)
 		TArray<PCGExMath::OBB::FOBB> PrimaryOBBs;
 		TArray<PCGExMath::OBB::FOBB> SecondaryOBBs;
 
-		int32 LastCandidatesCount = 0;
-
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
 			: TProcessor(InPointDataFacade)
@@ -193,5 +189,8 @@ namespace PCGExSelfPruning
 		virtual void OnRangeProcessingComplete() override;
 
 		virtual void CompleteWork() override;
+
+	protected:
+		void ResolvePruning();
 	};
 }
@@ -0,0 +1,203 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExSampledRelax.h"
+
+#include "Async/ParallelFor.h"
+#include "Details/PCGExInfluenceDetails.h"
+#include "Sorting/PCGExSortingHelpers.h"
+
+namespace PCGExSampledRelax
+{
+	namespace Internal
+	{
+		constexpr int32 MaxGridSize = 1 << 20;
+		constexpr int32 MinParallelItems = 1024;
+	}
+
+	bool FSampledRelax::Init(TConstArrayView<FVector> InSites, const int32 InSamplesPerSite, const bool bIn2D)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSampledRelax::Init);
+
+		b2D = bIn2D;
+		Samples.Reset();
+
+		const int32 NumSites = InSites.Num();
+		if (!NumSites) { return false; }
+
+		Domain = FBox(ForceInit);
+		for (const FVector& Site : InSites) { Domain += Site; }
+
+		if (b2D)
+		{
+			Domain.Min.Z = 0;
+			Domain.Max.Z = 0;
+		}
+
+		// Only axes with an actual extent are sampled & searched; flat ones collapse to a single cell
+
+		const FVector Size = Domain.GetSize();
+
+		int32 NumDimensions = 0;
+		double Measure = 1;
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			if (Size[Axis] <= UE_KINDA_SMALL_NUMBER) { continue; }
+			NumDimensions++;
+			Measure *= Size[Axis];
+		}
+
+		if (!NumDimensions) { return false; }
+
+		const double TargetSamples = static_cast<double>(NumSites) * FMath::Max(1, InSamplesPerSite);
+		const double SampleSpacing = FMath::Pow(Measure / TargetSamples, 1.0 / NumDimensions);
+		const double SiteSpacing = FMath::Pow(Measure / NumSites, 1.0 / NumDimensions);
+
+		FIntVector SampleCounts(1);
+		GridSize = FIntVector(1);
+		CellSize = FVector::OneVector;
+		MinCellSize = MAX_dbl;
+
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			if (Size[Axis] <= UE_KINDA_SMALL_NUMBER) { continue; }
+
+			SampleCounts[Axis] = FMath::Clamp(FMath::RoundToInt32(Size[Axis] / SampleSpacing), 1, Internal::MaxGridSize);
+			GridSize[Axis] = FMath::Clamp(FMath::CeilToInt32(Size[Axis] / SiteSpacing), 1, Internal::MaxGridSize);
+			CellSize[Axis] = Size[Axis] / GridSize[Axis];
+			MinCellSize = FMath::Min(MinCellSize, CellSize[Axis]);
+		}
+
+		// Samples at the center of each cell of a regular grid
+
+		const int64 TotalSamples = static_cast<int64>(SampleCounts.X) * SampleCounts.Y * SampleCounts.Z;
+		if (TotalSamples <= 0 || TotalSamples > MAX_int32) { return false; }
+
+		const FVector SampleStep = Size / FVector(SampleCounts);
+
+		Samples.SetNumUninitialized(static_cast<int32>(TotalSamples));
+		ParallelFor(Samples.Num(), [&](const int32 i)
+		{
+			const int32 X = i % SampleCounts.X;
+			const int32 Y = (i / SampleCounts.X) % SampleCounts.Y;
+			const int32 Z = i / (SampleCounts.X * SampleCounts.Y);
+			Samples[i] = Domain.Min + SampleStep * FVector(X + 0.5, Y + 0.5, Z + 0.5);
+		}, Samples.Num() < Internal::MinParallelItems);
+
+		return true;
+	}
+
+	void FSampledRelax::Step(TArrayView<FVector> InOutSites, const FPCGExInfluenceDetails& InInfluence) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSampledRelax::Step);
+
+		const int32 NumSites = InOutSites.Num();
+		const int32 NumSamplePoints = Samples.Num();
+		if (!NumSites || !NumSamplePoints) { return; }
+
+		const bool bForceSingleThreadSites = NumSites < Internal::MinParallelItems;
+		const bool bForceSingleThreadSamples = NumSamplePoints < Internal::MinParallelItems;
+
+		auto Flatten = [&](const FVector& InPosition) { return b2D ? FVector(InPosition.X, InPosition.Y, 0) : InPosition; };
+
+		// Bucket sites into the lookup grid
+
+		const int32 NumCells = GridSize.X * GridSize.Y * GridSize.Z;
+
+		TArray<PCGEx::FIndexKey> SiteCells;
+		SiteCells.SetNumUninitialized(NumSites);
+		ParallelFor(NumSites, [&](const int32 i) { SiteCells[i] = PCGEx::FIndexKey(i, GetCellIndex(GetCell(Flatten(InOutSites[i])))); }, bForceSingleThreadSites);
+
+		PCGExSortingHelpers::ParallelRadixSort(SiteCells);
+
+		TArray<int32> CellStarts;
+		CellStarts.Init(0, NumCells + 1);
+		for (const PCGEx::FIndexKey& Entry : SiteCells) { CellStarts[Entry.Key + 1]++; }
+		for (int32 i = 0; i < NumCells; i++) { CellStarts[i + 1] += CellStarts[i]; }
+
+		// Nearest site of each sample, searching rings of cells outward until no closer site can exist.
+		// Ties go to the lowest site index so the result doesn't depend on bucket order.
+
+		const int32 MaxRing = FMath::Max3(GridSize.X, GridSize.Y, GridSize.Z);
+
+		TArray<PCGEx::FIndexKey> Assignments;
+		Assignments.SetNumUninitialized(NumSamplePoints);
+
+		ParallelFor(NumSamplePoints, [&](const int32 SampleIndex)
+		{
+			const FVector& Sample = Samples[SampleIndex];
+			const FIntVector Cell = GetCell(Sample);
+
+			int32 Best = -1;
+			double BestDist = MAX_dbl;
+
+			for (int32 Ring = 0; Ring <= MaxRing; Ring++)
+			{
+				const FIntVector Min(FMath::Max(0, Cell.X - Ring), FMath::Max(0, Cell.Y - Ring), FMath::Max(0, Cell.Z - Ring));
+				const FIntVector Max(FMath::Min(GridSize.X - 1, Cell.X + Ring), FMath::Min(GridSize.Y - 1, Cell.Y + Ring), FMath::Min(GridSize.Z - 1, Cell.Z + Ring));
+
+				for (int32 Z = Min.Z; Z <= Max.Z; Z++)
+				{
+					for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+					{
+						for (int32 X = Min.X; X <= Max.X; X++)
+						{
+							// Ring shell only, inner cells were visited already
+							if (FMath::Max3(FMath::Abs(X - Cell.X), FMath::Abs(Y - Cell.Y), FMath::Abs(Z - Cell.Z)) != Ring) { continue; }
+
+							const int32 CellIndex = GetCellIndex(FIntVector(X, Y, Z));
+							for (int32 s = CellStarts[CellIndex]; s < CellStarts[CellIndex + 1]; s++)
+							{
+								const int32 SiteIndex = SiteCells[s].Index;
+								const double Dist = FVector::DistSquared(Sample, Flatten(InOutSites[SiteIndex]));
+								if (Dist < BestDist || (Dist == BestDist && SiteIndex < Best))
+								{
+									Best = SiteIndex;
+									BestDist = Dist;
+								}
+							}
+						}
+					}
+				}
+
+				// Anything beyond this ring is at least Ring cells away
+				if (Best != -1 && BestDist < FMath::Square(Ring * MinCellSize)) { break; }
+			}
+
+			Assignments[SampleIndex] = PCGEx::FIndexKey(SampleIndex, Best);
+		}, bForceSingleThreadSamples);
+
+		// Group samples by site, keeping sample order so sums are deterministic
+
+		PCGExSortingHelpers::ParallelRadixSort(Assignments);
+
+		TArray<int32> Starts;
+		TArray<int32> Ends;
+		Starts.Init(0, NumSites);
+		Ends.Init(0, NumSites);
+
+		ParallelFor(NumSamplePoints, [&](const int32 i)
+		{
+			const int32 Site = static_cast<int32>(Assignments[i].Key);
+			if (i == 0 || Assignments[i - 1].Key != Assignments[i].Key) { Starts[Site] = i; }
+			if (i == NumSamplePoints - 1 || Assignments[i + 1].Key != Assignments[i].Key) { Ends[Site] = i + 1; }
+		}, bForceSingleThreadSamples);
+
+		// Move sites to their centroid. Sites that didn't get any sample stay put.
+
+		ParallelFor(NumSites, [&](const int32 i)
+		{
+			const int32 Count = Ends[i] - Starts[i];
+			if (Count <= 0) { return; }
+
+			FVector Sum = FVector::ZeroVector;
+			for (int32 s = Starts[i]; s < Ends[i]; s++) { Sum += Samples[Assignments[s].Index]; }
+
+			FVector& Site = InOutSites[i];
+			FVector Centroid = Sum / Count;
+			if (b2D) { Centroid.Z = Site.Z; }
+
+			Site = InInfluence.bProgressiveInfluence ? FMath::Lerp(Site, Centroid, InInfluence.GetInfluence(i)) : Centroid;
+		}, bForceSingleThreadSites);
+	}
+}
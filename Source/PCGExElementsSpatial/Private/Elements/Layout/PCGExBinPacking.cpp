@@ -3,6 +3,7 @@
 
 #include "Elements/Layout/PCGExBinPacking.h"
 
+#include "Core/PCGExMT.h"
 #include "Data/PCGExAttributeBroadcaster.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointIO.h"
@@ -333,7 +334,7 @@ namespace PCGExBinPacking
 		{
 			if (TSharedPtr<PCGExSorting::FSortCache> Cache = Sorter->BuildCache(NumPoints))
 			{
-				ProcessingOrder.Sort([&](const int32 A, const int32 B) { return Cache->Compare(A, B); });
+				Cache->Sort(ProcessingOrder);
 			}
 			else
 			{
@@ -377,46 +378,50 @@ namespace PCGExBinPacking
 
 		// OPTIM : Find the smallest bound dimension possible to use as min threshold for free spaces later on
 
-		StartParallelLoopForPoints();
+		// Items are processed in order, so unsorted inputs are fetched up-front
+		PointDataFacade->Fetch(PCGExMT::FScope(0, NumPoints, 0));
+
+		// Packing is inherently sequential, time-slice it instead so the worker yields & cancels promptly
+		PCGEX_ASYNC_GROUP_CHKD(TaskManager, PackingTask)
+		PCGExMT::IAsyncHandleGroup::FRegistrationGuard Guard(PackingTask);
+
+		PCGEX_MAKE_SHARED(PackingLoop, PCGExMT::FResumableLoop, NumPoints)
+		PackingLoop->OnIterationCallback = [PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
+		{
+			PCGEX_ASYNC_THIS
+			This->PackItem(This->ProcessingOrder[Index]);
+		};
+
+		PackingLoop->Start(PackingTask);
 
 		return true;
 	}
 
-	void FProcessor::ProcessPoints(const PCGExMT::FScope& Scope)
+	void FProcessor::PackItem(const int32 PointIndex)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::BinPacking::ProcessPoints);
+		PCGExData::FMutablePoint Point(PointDataFacade->GetOut(), PointIndex);
 
-		PointDataFacade->Fetch(Scope);
+		FItem Item = FItem();
 
-		UPCGBasePointData* OutPointData = PointDataFacade->GetOut();
+		Item.Index = PointIndex;
+		Item.Box = FBox(FVector::ZeroVector, PCGExMath::GetLocalBounds<EPCGExPointBoundsSource::ScaledBounds>(Point).GetSize());
+		Item.Padding = PaddingBuffer->Read(PointIndex);
 
-		PCGEX_SCOPE_LOOP(Index)
+		bool bPlaced = false;
+		for (const TSharedPtr<FBin>& Bin : Bins)
 		{
-			const int32 PointIndex = ProcessingOrder[Index];
-			PCGExData::FMutablePoint Point(OutPointData, PointIndex);
-
-			FItem Item = FItem();
-
-			Item.Index = PointIndex;
-			Item.Box = FBox(FVector::ZeroVector, PCGExMath::GetLocalBounds<EPCGExPointBoundsSource::ScaledBounds>(Point).GetSize());
-			Item.Padding = PaddingBuffer->Read(PointIndex);
-
-			bool bPlaced = false;
-			for (const TSharedPtr<FBin>& Bin : Bins)
+			if (Bin->Insert(Item))
 			{
-				if (Bin->Insert(Item))
-				{
-					bPlaced = true;
-					Bin->UpdatePoint(Point, Item);
-					break;
-				}
+				bPlaced = true;
+				Bin->UpdatePoint(Point, Item);
+				break;
 			}
+		}
 
-			Fitted[PointIndex] = bPlaced;
-			if (!bPlaced) { bHasUnfitted = true; }
+		Fitted[PointIndex] = bPlaced;
+		if (!bPlaced) { bHasUnfitted = true; }
 
-			// TODO : post process pass to move things around based on initial placement
-		}
+		// TODO : post process pass to move things around based on initial placement
 	}
 
 	void FProcessor::CompleteWork()
@@ -73,7 +73,17 @@ namespace PCGExCollocationCount
 			LinearOccurencesWriter = PointDataFacade->GetWritable(Settings->LinearOccurencesAttributeName, 0, true, PCGExData::EBufferInit::New);
 		}
 
-		Octree = &PointDataFacade->Source->GetIn()->GetPointOctree();
+		// Tolerance is tiny compared to typical point bounds, a grid of that size beats the shared octree
+		{
+			TConstPCGValueRange<FTransform> Transforms = PointDataFacade->GetIn()->GetConstTransformValueRange();
+
+			TArray<FVector> Positions;
+			Positions.SetNumUninitialized(PointDataFacade->GetNum());
+			PCGEX_PARALLEL_FOR(Positions.Num(), Positions[i] = Transforms[i].GetLocation();)
+
+			Grid = MakeShared<PCGExSpatial::FHashGrid>();
+			Grid->Build(Positions, ToleranceConstant);
+		}
 
 		StartParallelLoopForPoints();
 
@@ -85,6 +95,7 @@ namespace PCGExCollocationCount
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::CollocationCount::ProcessPoints);
 
 		TConstPCGValueRange<FTransform> Transforms = PointDataFacade->GetIn()->GetConstTransformValueRange();
+		const PCGExSpatial::FHashGrid* GridPtr = Grid.Get();
 
 		PCGEX_SCOPE_LOOP(Index)
 		{
@@ -96,22 +107,20 @@ namespace PCGExCollocationCount
 			if (LinearOccurencesWriter)
 			{
 				LinearOccurencesWriter->SetValue(Index, 0);
-				Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Center, FVector(Tolerance)), [&](const PCGPointOctree::FPointRef& PointRef)
+				GridPtr->ForEachInRadius(Center, Tolerance, [&](const int32 OtherIndex, const double)
 				{
-					if (PointRef.Index == Index) { return; }
-					if (FVector::Dist(Center, Transforms[PointRef.Index].GetLocation()) > Tolerance) { return; }
+					if (OtherIndex == Index) { return; }
 
 					CollocationWriter->SetValue(Index, 1);
 
-					if (PointRef.Index < Index) { LinearOccurencesWriter->SetValue(Index, 1); }
+					if (OtherIndex < Index) { LinearOccurencesWriter->SetValue(Index, 1); }
 				});
 			}
 			else
 			{
-				Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Center, FVector(Tolerance)), [&](const PCGPointOctree::FPointRef& PointRef)
+				GridPtr->ForEachInRadius(Center, Tolerance, [&](const int32 OtherIndex, const double)
 				{
-					if (PointRef.Index == Index) { return; }
-					if (FVector::Dist(Center, Transforms[PointRef.Index].GetLocation()) > Tolerance) { return; }
+					if (OtherIndex == Index) { return; }
 
 					CollocationWriter->SetValue(Index, 1);
 				});
@@ -8,6 +8,7 @@
 #include "Blenders/PCGExUnionBlender.h"
 #include "Async/ParallelFor.h"
 #include "Clusters/PCGExClusterCommon.h"
+#include "Core/PCGExBlendPlan.h"
 #include "Data/PCGExData.h"
 #include "PCGExGraphs/Public/Graphs/Union/PCGExIntersections.h"
 
@@ -138,6 +139,7 @@ namespace PCGExFusePoints
 		PointDataFacade->Source->InheritProperties(ReadIndices, WriteIndices, PointDataFacade->GetAllocations() & ~EPCGPointNativeProperties::MetadataEntry);
 
 		TArray<PCGExData::FWeightedPoint> WeightedPoints;
+		PCGExBlending::FBlendSources Sources;
 		TArray<PCGEx::FOpStats> Trackers;
 		UnionBlender->InitTrackers(Trackers);
 
@@ -145,15 +147,18 @@ namespace PCGExFusePoints
 
 		PCGEX_SHARED_CONTEXT_VOID(Context->GetOrCreateHandle())
 
-		PCGEX_SCOPE_LOOP(Index)
-		{
-			const FVector Center = UnionGraph->Nodes[Index]->GetCenter();
+		if (bUpdateCenter) { PCGEX_SCOPE_LOOP(Index) { Transforms[Index].SetLocation(UnionGraph->Nodes[Index]->GetCenter()); } }
 
-			if (bUpdateCenter) { Transforms[Index].SetLocation(Center); }
+		UnionBlender->MergeScope(Scope, Sources, WeightedPoints, Trackers);
 
-			UnionBlender->MergeSingle(Index, WeightedPoints, Trackers);
-			if (IsUnionWriter) { IsUnionWriter->SetValue(Index, WeightedPoints.Num() > 1); }
-			if (UnionSizeWriter) { UnionSizeWriter->SetValue(Index, WeightedPoints.Num()); }
+		if (IsUnionWriter || UnionSizeWriter)
+		{
+			PCGEX_SCOPE_LOOP(Index)
+			{
+				const int32 NumSources = Sources.GetRow(Index - Scope.Start).Num();
+				if (IsUnionWriter) { IsUnionWriter->SetValue(Index, NumSources > 1); }
+				if (UnionSizeWriter) { UnionSizeWriter->SetValue(Index, NumSources); }
+			}
 		}
 	}
 
@@ -81,11 +81,23 @@ namespace PCGExLloydRelax
 		{
 			NumIterations--;
 
+			if (Processor->SampledRelax) { Processor->SampledRelax->Step(Processor->ActivePositions, *InfluenceSettings); }
+			else if (!RelaxDelaunay()) { return; }
+
+			if (NumIterations > 0)
+			{
+				PCGEX_LAUNCH_INTERNAL(FLloydRelaxTask, TaskIndex + 1, Processor, InfluenceSettings, NumIterations)
+			}
+		}
+
+	protected:
+		bool RelaxDelaunay() const
+		{
 			TUniquePtr<PCGExMath::Geo::TDelaunay3> Delaunay = MakeUnique<PCGExMath::Geo::TDelaunay3>();
 			TArray<FVector>& Positions = Processor->ActivePositions;
 
 			const TArrayView<FVector> View = MakeArrayView(Positions);
-			if (!Delaunay->Process<false, false>(View)) { return; }
+			if (!Delaunay->Process<false, false>(View)) { return false; }
 
 			const int32 NumPoints = Positions.Num();
 
@@ -111,12 +123,7 @@ namespace PCGExLloydRelax
 				PCGEX_PARALLEL_FOR(NumPoints, Positions[i] = FMath::Lerp(Positions[i], Sum[i] / Counts[i], InfluenceSettings->GetInfluence(i));)
 			}
 
-			Delaunay.Reset();
-
-			if (NumIterations > 0)
-			{
-				PCGEX_LAUNCH_INTERNAL(FLloydRelaxTask, TaskIndex + 1, Processor, InfluenceSettings, NumIterations)
-			}
+			return true;
 		}
 	};
 
@@ -134,6 +141,12 @@ namespace PCGExLloydRelax
 
 		PCGExPointArrayDataHelpers::PointsToPositions(PointDataFacade->GetIn(), ActivePositions);
 
+		if (Settings->Method == EPCGExLloydRelaxMethod::Sampled)
+		{
+			SampledRelax = MakeShared<PCGExSampledRelax::FSampledRelax>();
+			if (!SampledRelax->Init(ActivePositions, Settings->SamplesPerPoint, false)) { SampledRelax.Reset(); }
+		}
+
 		PCGEX_SHARED_THIS_DECL
 		PCGEX_LAUNCH(FLloydRelaxTask, 0, ThisPtr, &InfluenceDetails, Settings->Iterations)
 
@@ -82,11 +82,23 @@ namespace PCGExLloydRelax2D
 		{
 			NumIterations--;
 
+			if (Processor->SampledRelax) { Processor->SampledRelax->Step(Processor->ActivePositions, *InfluenceSettings); }
+			else if (!RelaxDelaunay()) { return; }
+
+			if (NumIterations > 0)
+			{
+				PCGEX_LAUNCH_INTERNAL(FLloydRelaxTask, TaskIndex + 1, Processor, InfluenceSettings, NumIterations)
+			}
+		}
+
+	protected:
+		bool RelaxDelaunay() const
+		{
 			TUniquePtr<PCGExMath::Geo::TDelaunay2> Delaunay = MakeUnique<PCGExMath::Geo::TDelaunay2>();
 			TArray<FVector>& Positions = Processor->ActivePositions;
 
 			const TArrayView<FVector> View = MakeArrayView(Positions);
-			if (!Delaunay->Process(View, Processor->ProjectionDetails)) { return; }
+			if (!Delaunay->Process(View, Processor->ProjectionDetails)) { return false; }
 
 			const int32 NumPoints = Positions.Num();
 
@@ -115,12 +127,7 @@ namespace PCGExLloydRelax2D
 				)
 			}
 
-			Delaunay.Reset();
-
-			if (NumIterations > 0)
-			{
-				PCGEX_LAUNCH_INTERNAL(FLloydRelaxTask, TaskIndex + 1, Processor, InfluenceSettings, NumIterations)
-			}
+			return true;
 		}
 	};
 
@@ -141,6 +148,19 @@ namespace PCGExLloydRelax2D
 
 		PCGExPointArrayDataHelpers::PointsToPositions(PointDataFacade->GetIn(), ActivePositions);
 
+		if (Settings->Method == EPCGExLloydRelaxMethod::Sampled)
+		{
+			// Sampled relaxation runs in projected space, Z being the distance to the projection plane
+			for (FVector& Position : ActivePositions) { Position = ProjectionDetails.Project(Position); }
+
+			SampledRelax = MakeShared<PCGExSampledRelax::FSampledRelax>();
+			if (!SampledRelax->Init(ActivePositions, Settings->SamplesPerPoint, true))
+			{
+				SampledRelax.Reset();
+				PCGExPointArrayDataHelpers::PointsToPositions(PointDataFacade->GetIn(), ActivePositions);
+			}
+		}
+
 		PCGEX_SHARED_THIS_DECL
 		PCGEX_LAUNCH(FLloydRelaxTask, 0, ThisPtr, &InfluenceDetails, Settings->Iterations)
 
@@ -153,6 +173,21 @@ namespace PCGExLloydRelax2D
 
 		TPCGValueRange<FTransform> OutTransforms = PointDataFacade->GetOut()->GetTransformValueRange(false);
 
+		if (SampledRelax)
+		{
+			// Back from projected space; points only moved along the projection plane
+			PCGEX_PARALLEL_FOR(
+				OutTransforms.Num(),
+
+				FTransform& Transform = OutTransforms[i];
+				const FVector TargetPosition = ProjectionDetails.Unproject(ActivePositions[i]);
+
+				Transform.SetLocation(InfluenceDetails.bProgressiveInfluence ? TargetPosition : FMath::Lerp(Transform.GetLocation(), TargetPosition, InfluenceDetails.GetInfluence(i)));
+			)
+
+			return;
+		}
+
 		if (InfluenceDetails.bProgressiveInfluence)
 		{
 			PCGEX_PARALLEL_FOR(
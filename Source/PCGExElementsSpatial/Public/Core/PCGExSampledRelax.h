@@ -0,0 +1,67 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "PCGExSampledRelax.generated.h"
+
+struct FPCGExInfluenceDetails;
+
+UENUM()
+enum class EPCGExLloydRelaxMethod : uint8
+{
+	Delaunay = 0 UMETA(DisplayName = "Delaunay", ToolTip="Moves each point toward the centroid of its Delaunay neighborhood. Requires a full triangulation each iteration."),
+	Sampled  = 1 UMETA(DisplayName = "Sampled (CVT)", ToolTip="Moves each point to the centroid of the samples closest to it (centroidal Voronoi). No triangulation, scales to large point counts."),
+};
+
+namespace PCGExSampledRelax
+{
+	/**
+	 * Centroidal Voronoi relaxation over a fixed grid of samples covering the sites' initial bounds.
+	 * Each step assigns every sample to its nearest site through a uniform grid, then moves sites to the centroid of their samples.
+	 * All stages run in parallel, and results don't depend on scheduling.
+	 */
+	class PCGEXELEMENTSSPATIAL_API FSampledRelax : public TSharedFromThis<FSampledRelax>
+	{
+	protected:
+		bool b2D = false;
+		FBox Domain = FBox(ForceInit);
+
+		TArray<FVector> Samples;
+
+		// Site lookup grid
+		FIntVector GridSize = FIntVector(1);
+		FVector CellSize = FVector::OneVector;
+		double MinCellSize = 1;
+
+	public:
+		FSampledRelax() = default;
+
+		/**
+		 * @param InSites Initial site positions, defines the sampled domain
+		 * @param InSamplesPerSite Approximate number of samples per site; more samples = more accurate centroids
+		 * @param bIn2D Ignore Z, sites are relaxed on the XY plane
+		 * @return false if sites don't span any area/volume
+		 */
+		bool Init(TConstArrayView<FVector> InSites, const int32 InSamplesPerSite, const bool bIn2D);
+
+		int32 NumSamples() const { return Samples.Num(); }
+
+		/** One relaxation iteration. Sites are moved in-place; in 2D their Z is left untouched. */
+		void Step(TArrayView<FVector> InOutSites, const FPCGExInfluenceDetails& InInfluence) const;
+
+	protected:
+		FORCEINLINE FIntVector GetCell(const FVector& InPosition) const
+		{
+			const FVector Local = (InPosition - Domain.Min) / CellSize;
+			return FIntVector(
+				FMath::Clamp(FMath::FloorToInt32(Local.X), 0, GridSize.X - 1),
+				FMath::Clamp(FMath::FloorToInt32(Local.Y), 0, GridSize.Y - 1),
+				FMath::Clamp(FMath::FloorToInt32(Local.Z), 0, GridSize.Z - 1));
+		}
+
+		FORCEINLINE int32 GetCellIndex(const FIntVector& InCell) const { return (InCell.Z * GridSize.Y + InCell.Y) * GridSize.X + InCell.X; }
+	};
+}
@@ -220,7 +220,6 @@ namespace PCGExBinPacking
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
 			: TProcessor(InPointDataFacade)
 		{
-			bForceSingleThreadedProcessPoints = true;
 		}
 
 		virtual ~FProcessor() override
@@ -230,7 +229,7 @@ namespace PCGExBinPacking
 		virtual void RegisterBuffersDependencies(PCGExData::FFacadePreloader& FacadePreloader) override;
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager) override;
-		virtual void ProcessPoints(const PCGExMT::FScope& Scope) override;
+		void PackItem(const int32 PointIndex);
 		virtual void CompleteWork() override;
 	};
 }
@@ -5,7 +5,7 @@
 
 #include "CoreMinimal.h"
 #include "Core/PCGExPointsProcessor.h"
-#include "Utils/PCGPointOctree.h"
+#include "Math/PCGExHashGrid.h"
 
 
 #include "PCGExCollocationCount.generated.h"
@@ -79,7 +79,7 @@ namespace PCGExCollocationCount
 		TSharedPtr<PCGExData::TBuffer<int32>> CollocationWriter;
 		TSharedPtr<PCGExData::TBuffer<int32>> LinearOccurencesWriter;
 
-		const PCGPointOctree::FPointOctree* Octree = nullptr;
+		TSharedPtr<PCGExSpatial::FHashGrid> Grid;
 
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
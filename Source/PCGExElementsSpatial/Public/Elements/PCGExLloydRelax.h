@@ -8,6 +8,7 @@
 
 #include "Core/PCGExPointsProcessor.h"
 #include "Details/PCGExInfluenceDetails.h"
+#include "Core/PCGExSampledRelax.h"
 
 
 #include "PCGExLloydRelax.generated.h"
@@ -38,6 +39,14 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, ClampMin=1))
 	int32 Iterations = 5;
 
+	/** How centroids are computed each iteration. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
+	EPCGExLloydRelaxMethod Method = EPCGExLloydRelaxMethod::Delaunay;
+
+	/** Approximate number of samples per point covering the input bounds. Higher values give more accurate centroids at a higher cost. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="Method == EPCGExLloydRelaxMethod::Sampled", EditConditionHides, ClampMin=1))
+	int32 SamplesPerPoint = 16;
+
 	/** Influence Settings*/
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExInfluenceDetails InfluenceDetails;
@@ -69,6 +78,8 @@ namespace PCGExLloydRelax
 		FPCGExInfluenceDetails InfluenceDetails;
 		TArray<FVector> ActivePositions;
 
+		TSharedPtr<PCGExSampledRelax::FSampledRelax> SampledRelax;
+
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
 			: TProcessor(InPointDataFacade)
@@ -7,6 +7,7 @@
 
 #include "Core/PCGExPointsProcessor.h"
 #include "Details/PCGExInfluenceDetails.h"
+#include "Core/PCGExSampledRelax.h"
 #include "Math/PCGExProjectionDetails.h"
 #include "PCGExLloydRelax2D.generated.h"
 
@@ -36,6 +37,14 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, ClampMin=1))
 	int32 Iterations = 5;
 
+	/** How centroids are computed each iteration. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
+	EPCGExLloydRelaxMethod Method = EPCGExLloydRelaxMethod::Delaunay;
+
+	/** Approximate number of samples per point covering the input bounds. Higher values give more accurate centroids at a higher cost. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="Method == EPCGExLloydRelaxMethod::Sampled", EditConditionHides, ClampMin=1))
+	int32 SamplesPerPoint = 16;
+
 	/** Influence Settings*/
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExInfluenceDetails InfluenceDetails;
@@ -71,6 +80,8 @@ namespace PCGExLloydRelax2D
 		FPCGExInfluenceDetails InfluenceDetails;
 		TArray<FVector> ActivePositions;
 
+		TSharedPtr<PCGExSampledRelax::FSampledRelax> SampledRelax;
+
 		FPCGExGeo2DProjectionDetails ProjectionDetails;
 
 	public:
@@ -5,6 +5,7 @@
 
 #include "Data/PCGSplineData.h"
 #include "Paths/PCGExPathsHelpers.h"
+#include "Paths/PCGExSplineBVH.h"
 
 #define LOCTEXT_NAMESPACE "PCGExCreateTensor"
 #define PCGEX_NAMESPACE CreateTensor
@@ -77,12 +78,28 @@ PCGExFactories::EPreparationResult UPCGExTensorSplineFactoryData::InitInternalDa
 		}
 	}
 
+	// Tensors sample every spline for every probe, so we want closest-point queries to be as cheap as possible
+	TArray<const FPCGSplineStruct*> SplinePtrs;
+	if (bBuildFromPaths)
+	{
+		SplinePtrs.Reserve(ManagedSplines.Num());
+		for (const TSharedPtr<const FPCGSplineStruct>& Spline : ManagedSplines) { SplinePtrs.Add(Spline.Get()); }
+	}
+	else
+	{
+		SplinePtrs.Reserve(Splines.Num());
+		for (const FPCGSplineStruct& Spline : Splines) { SplinePtrs.Add(&Spline); }
+	}
+
+	PCGExPaths::Helpers::BuildSplineBVHs(SplinePtrs, SplineBVHs);
+
 	return Result;
 }
 
 void UPCGExTensorSplineFactoryData::BeginDestroy()
 {
 	Super::BeginDestroy();
+	SplineBVHs.Empty();
 	ManagedSplines.Empty();
 	Splines.Empty();
 }
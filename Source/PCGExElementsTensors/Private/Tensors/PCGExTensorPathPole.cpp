@@ -14,7 +14,7 @@ PCGExTensor::FTensorSample FPCGExTensorPathPole::Sample(const int32 InSeedIndex,
 	const FVector& InPosition = InProbe.GetLocation();
 	PCGExTensor::FEffectorSamples Samples = PCGExTensor::FEffectorSamples();
 
-	for (const TSharedPtr<const FPCGSplineStruct>& Spline : *Splines)
+	for (const TSharedPtr<PCGExPaths::FSplineBVH>& Spline : *Splines)
 	{
 		FTransform T = FTransform::Identity;
 		PCGExTensor::FEffectorMetrics Metrics;
@@ -36,7 +36,7 @@ PCGEX_TENSOR_BOILERPLATE(
 	NewFactory->bSmoothLinear = NewFactory->Config.bSmoothLinear;
 	},
 	{
-	NewOperation->Splines = &ManagedSplines;
+	NewOperation->Splines = &SplineBVHs;
 	})
 
 #undef LOCTEXT_NAMESPACE
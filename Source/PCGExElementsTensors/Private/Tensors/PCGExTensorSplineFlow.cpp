@@ -21,12 +21,12 @@ PCGExTensor::FTensorSample FPCGExTensorSplineFlow::Sample(const int32 InSeedInde
 	const FVector& InPosition = InProbe.GetLocation();
 	PCGExTensor::FEffectorSamples Samples = PCGExTensor::FEffectorSamples();
 
-	for (const FPCGSplineStruct& Spline : *Splines)
+	for (const TSharedPtr<PCGExPaths::FSplineBVH>& Spline : *Splines)
 	{
 		FTransform T = FTransform::Identity;
 		PCGExTensor::FEffectorMetrics Metrics;
 
-		if (!ComputeFactor(InPosition, Spline, Config.Radius, T, Metrics)) { continue; }
+		if (!ComputeFactor(InPosition, *Spline.Get(), Config.Radius, T, Metrics)) { continue; }
 
 		Samples.Emplace_GetRef(FRotationMatrix::MakeFromX(PCGExMath::GetDirection(T.GetRotation(), Config.SplineDirection)).ToQuat().RotateVector(Metrics.Guide), Metrics.Potency, Metrics.Weight);
 	}
@@ -46,7 +46,7 @@ PCGEX_TENSOR_BOILERPLATE(
 	NewFactory->Config.Potency *=NewFactory->Config.PotencyScale;
 	},
 	{
-	NewOperation->Splines = &Splines;
+	NewOperation->Splines = &SplineBVHs;
 	})
 
 #undef LOCTEXT_NAMESPACE
@@ -8,6 +8,7 @@
 #include "Factories/PCGExOperation.h"
 #include "PCGExTensor.h"
 #include "Elements/PCGExExtrudeTensors.h"
+#include "Paths/PCGExSplineBVH.h"
 
 namespace PCGExMath
 {
@@ -73,11 +74,31 @@ public:
 		PCGExTensor::FEffectorMetrics& OutMetrics) const
 	{
 		OutTransform = PCGExPaths::Helpers::GetClosestTransform(InEffector, InPosition, true);
+		return ComputeFactorFromClosest<bFast>(InPosition, Radius, OutTransform, OutMetrics);
+	}
+
+	template <bool bFast = false>
+	bool ComputeFactor(
+		const FVector& InPosition,
+		const PCGExPaths::FSplineBVH& InEffector,
+		const double Radius, FTransform& OutTransform,
+		PCGExTensor::FEffectorMetrics& OutMetrics) const
+	{
+		OutTransform = InEffector.GetClosestTransform(InPosition, true);
+		return ComputeFactorFromClosest<bFast>(InPosition, Radius, OutTransform, OutMetrics);
+	}
 
-		const FVector Scale = OutTransform.GetScale3D();
+protected:
+	template <bool bFast = false>
+	bool ComputeFactorFromClosest(
+		const FVector& InPosition,
+		const double Radius, const FTransform& InClosest,
+		PCGExTensor::FEffectorMetrics& OutMetrics) const
+	{
+		const FVector Scale = InClosest.GetScale3D();
 
 		const double RadiusSquared = FMath::Square(FVector2D(Scale.Y, Scale.Z).Length() * Radius);
-		const double DistSquared = FVector::DistSquared(InPosition, OutTransform.GetLocation());
+		const double DistSquared = FVector::DistSquared(InPosition, InClosest.GetLocation());
 
 		if (DistSquared > RadiusSquared) { return false; }
 
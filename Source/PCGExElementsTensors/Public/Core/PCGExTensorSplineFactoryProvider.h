@@ -12,6 +12,11 @@
 
 class PCGExTensorOperation;
 
+namespace PCGExPaths
+{
+	class FSplineBVH;
+}
+
 UCLASS(Abstract, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Data")
 class PCGEXELEMENTSTENSORS_API UPCGExTensorSplineFactoryData : public UPCGExTensorFactoryData
 {
@@ -25,6 +30,7 @@ public:
 protected:
 	TArray<TSharedPtr<const FPCGSplineStruct>> ManagedSplines;
 	TArray<FPCGSplineStruct> Splines;
+	TArray<TSharedPtr<PCGExPaths::FSplineBVH>> SplineBVHs;
 
 	EPCGExSplineSamplingIncludeMode SampleInputs = EPCGExSplineSamplingIncludeMode::All;
 
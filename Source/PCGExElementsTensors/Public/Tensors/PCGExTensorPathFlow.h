@@ -51,7 +51,7 @@ class FPCGExTensorPathFlow : public PCGExTensorOperation
 {
 public:
 	FPCGExTensorPathFlowConfig Config;
-	const TArray<TSharedPtr<const FPCGSplineStruct>>* Splines = nullptr;
+	const TArray<TSharedPtr<PCGExPaths::FSplineBVH>>* Splines = nullptr;
 
 	virtual bool Init(FPCGExContext* InContext, const UPCGExTensorFactoryData* InFactory) override;
 
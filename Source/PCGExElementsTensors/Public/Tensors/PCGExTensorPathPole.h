@@ -43,7 +43,7 @@ class FPCGExTensorPathPole : public PCGExTensorOperation
 {
 public:
 	FPCGExTensorPathPoleConfig Config;
-	const TArray<TSharedPtr<const FPCGSplineStruct>>* Splines = nullptr;
+	const TArray<TSharedPtr<PCGExPaths::FSplineBVH>>* Splines = nullptr;
 
 	virtual PCGExTensor::FTensorSample Sample(int32 InSeedIndex, const FTransform& InProbe) const override;
 };
@@ -42,7 +42,7 @@ class FPCGExTensorSplineFlow : public PCGExTensorOperation
 {
 public:
 	FPCGExTensorSplineFlowConfig Config;
-	const TArray<FPCGSplineStruct>* Splines = nullptr;
+	const TArray<TSharedPtr<PCGExPaths::FSplineBVH>>* Splines = nullptr;
 
 	virtual bool Init(FPCGExContext* InContext, const UPCGExTensorFactoryData* InFactory) override;
 
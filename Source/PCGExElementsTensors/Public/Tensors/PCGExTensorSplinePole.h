@@ -36,7 +36,7 @@ class FPCGExTensorSplinePole : public PCGExTensorOperation
 {
 public:
 	FPCGExTensorSplinePoleConfig Config;
-	const TArray<FPCGSplineStruct>* Splines = nullptr;
+	const TArray<TSharedPtr<PCGExPaths::FSplineBVH>>* Splines = nullptr;
 
 	virtual bool Init(FPCGExContext* InContext, const UPCGExTensorFactoryData* InFactory) override;
 
@@ -166,6 +166,7 @@ PCGExFactories::EPreparationResult UPCGExPolyPathFilterFactory::Prepare(FPCGExCo
 		if (Path)
 		{
 			if (bBuildEdgeOctree) { Path->BuildEdgeOctree(); }
+			Path->BuildSplineBVH();
 			TempPolyPaths[Index] = Path;
 			TSharedPtr<PCGExData::FTags> Tags = MakeShared<PCGExData::FTags>(TempTargets[Index].Tags);
 			TempTaggedData[Index] = FPCGExTaggedData(Data, Index, Tags, nullptr);
@@ -4,6 +4,7 @@
 #include "Core/PCGExPointsMT.h"
 
 
+#include "Async/TaskGraphInterfaces.h"
 #include "Factories/PCGExInstancedFactory.h"
 #include "Data/PCGExData.h"
 #include "Data/Utils/PCGExDataPreloader.h"
@@ -103,8 +104,10 @@ namespace PCGExPointsMT
 		return true;
 	}
 
-	void IProcessor::StartParallelLoopForPoints(const PCGExData::EIOSide Side, const int32 PerLoopIterations)
+	void IProcessor::StartParallelLoopForPoints(const PCGExData::EIOSide Side, const int32 InPerLoopIterations)
 	{
+		const int32 PerLoopIterations = InPerLoopIterations <= -1 ? LocalPointProcessingChunkSize : InPerLoopIterations;
+
 		const UPCGBasePointData* CurrentProcessingSource = const_cast<UPCGBasePointData*>(PointDataFacade->GetData(Side));
 		if (!CurrentProcessingSource) { return; }
 
@@ -125,8 +128,10 @@ namespace PCGExPointsMT
 	{
 	}
 
-	void IProcessor::StartParallelLoopForRange(const int32 NumIterations, const int32 PerLoopIterations)
+	void IProcessor::StartParallelLoopForRange(const int32 NumIterations, const int32 InPerLoopIterations)
 	{
+		const int32 PerLoopIterations = InPerLoopIterations <= -1 ? LocalPointProcessingChunkSize : InPerLoopIterations;
+
 		PCGEX_ASYNC_POINT_PROCESSOR_LOOP(Ranges, NumIterations, PrepareLoopScopesForRanges, ProcessRange, OnRangeProcessingComplete, bForceSingleThreadedProcessRange)
 	}
 
@@ -247,6 +252,8 @@ namespace PCGExPointsMT
 			return;
 		}
 
+		BuildProcessingGroups();
+
 		if (bPrefetchData)
 		{
 			PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, ParallelAttributeRead)
@@ -260,10 +267,10 @@ namespace PCGExPointsMT
 			ParallelAttributeRead->OnIterationCallback = [PCGEX_ASYNC_THIS_CAPTURE, ParallelAttributeRead](const int32 Index, const PCGExMT::FScope& Scope)
 			{
 				PCGEX_ASYNC_THIS
-				This->Processors[Index]->PrefetchData(This->TaskManager, ParallelAttributeRead);
+				for (const int32 ProcessorIndex : This->GetProcessingGroup(Index)) { This->Processors[ProcessorIndex]->PrefetchData(This->TaskManager, ParallelAttributeRead); }
 			};
 
-			ParallelAttributeRead->StartIterations(Processors.Num(), 1);
+			ParallelAttributeRead->StartIterations(GetNumProcessingGroups(), 1);
 		}
 		else
 		{
@@ -283,12 +290,12 @@ namespace PCGExPointsMT
 	void IBatch::CompleteWork()
 	{
 		if (bSkipCompletion) { return; }
-		PCGEX_ASYNC_MT_LOOP_VALID_PROCESSORS(CompleteWork, bForceSingleThreadedCompletion, { Processor->CompleteWork(); }, {})
+		PCGEX_ASYNC_MT_LOOP_VALID_GROUPS(CompleteWork, bForceSingleThreadedCompletion, { Processor->CompleteWork(); }, {})
 	}
 
 	void IBatch::Write()
 	{
-		PCGEX_ASYNC_MT_LOOP_VALID_PROCESSORS(Write, bForceSingleThreadedWrite, { Processor->Write(); }, {})
+		PCGEX_ASYNC_MT_LOOP_VALID_GROUPS(Write, bForceSingleThreadedWrite, { Processor->Write(); }, {})
 	}
 
 	void IBatch::Output()
@@ -308,9 +315,71 @@ namespace PCGExPointsMT
 		Processors.Empty();
 	}
 
+	void IBatch::BuildProcessingGroups()
+	{
+		const int32 NumProcessors = Processors.Num();
+
+		ProcessingOrder.Reset(NumProcessors);
+		ProcessingGroupOffsets.Reset(NumProcessors + 1);
+		ProcessingGroupOffsets.Add(0);
+
+		for (int32 i = 0; i < NumProcessors; i++) { ProcessingOrder.Add(i); }
+
+		if (!PCGEX_CORE_SETTINGS.bSizeAwareBatching || NumProcessors <= 1)
+		{
+			for (int32 i = 1; i <= NumProcessors; i++) { ProcessingGroupOffsets.Add(i); }
+			return;
+		}
+
+		TArray<int32> Sizes;
+		Sizes.SetNumUninitialized(NumProcessors);
+
+		int64 TotalSize = 0;
+		for (int32 i = 0; i < NumProcessors; i++)
+		{
+			Sizes[i] = Processors[i]->PointDataFacade->GetNum();
+			TotalSize += Sizes[i];
+		}
+
+		// Largest first, so the long tail starts as early as possible instead of dictating wall time
+		ProcessingOrder.Sort([&](const int32 A, const int32 B) { return Sizes[A] > Sizes[B]; });
+
+		// Trivial processors are packed together until they amount to a single non-trivial one
+		const int32 PackSize = PCGEX_CORE_SETTINGS.SmallPointsSize;
+		int32 PackedSize = 0;
+
+		for (int32 i = 0; i < NumProcessors; i++)
+		{
+			const int32 Size = Sizes[ProcessingOrder[i]];
+			if (Processors[ProcessingOrder[i]]->bIsTrivial)
+			{
+				PackedSize += Size;
+				if (PackedSize < PackSize && i < NumProcessors - 1) { continue; }
+			}
+
+			ProcessingGroupOffsets.Add(i + 1);
+			PackedSize = 0;
+		}
+
+		// Inputs larger than their fair share of the batch get finer chunks, so their scopes can spread across idle workers
+		const int32 NumWorkers = FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads());
+		const int32 DefaultChunkSize = PCGEX_CORE_SETTINGS.GetPointsBatchChunkSize();
+		const int32 MinChunkSize = FMath::Min(DefaultChunkSize, 128);
+
+		for (int32 i = 0; i < NumProcessors; i++)
+		{
+			const TSharedRef<IProcessor>& Processor = Processors[i];
+			if (Processor->bIsTrivial || Processor->LocalPointProcessingChunkSize > 0) { continue; }
+			if (static_cast<int64>(Sizes[i]) * NumWorkers <= TotalSize) { continue; }
+
+			const int32 ChunkSize = FMath::Clamp(Sizes[i] / (NumWorkers * 4), MinChunkSize, DefaultChunkSize);
+			if (ChunkSize < DefaultChunkSize) { Processor->LocalPointProcessingChunkSize = ChunkSize; }
+		}
+	}
+
 	void IBatch::OnProcessingPreparationComplete()
 	{
-		PCGEX_ASYNC_MT_LOOP_TPL(Process, bForceSingleThreadedProcessing, { Processor->bIsProcessorValid = Processor->Process(This->TaskManager); }, { Process->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE](){ PCGEX_ASYNC_THIS This->OnInitialPostProcess(); };})
+		PCGEX_ASYNC_MT_LOOP_GROUPS_TPL(Process, bForceSingleThreadedProcessing, { Processor->bIsProcessorValid = Processor->Process(This->TaskManager); }, { Process->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE](){ PCGEX_ASYNC_THIS This->OnInitialPostProcess(); };})
 	}
 
 	void ScheduleBatch(const TSharedPtr<PCGExMT::FTaskManager>& TaskManager, const TSharedPtr<IBatch>& Batch)
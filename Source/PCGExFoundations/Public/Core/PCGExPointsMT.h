@@ -61,6 +61,17 @@ namespace PCGExPointsMT
 		_ID->StartIterations(Processors.Num(), 1, false);\
 	}
 
+// Same as PCGEX_ASYNC_MT_LOOP_TPL, but iterates over processing groups instead of individual processors
+#define PCGEX_ASYNC_MT_LOOP_GROUPS_TPL(_ID, _INLINE_CONDITION, _BODY, _JIT)\
+	PCGEX_CHECK_WORK_HANDLE_VOID\
+	PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, _ID)\
+	_ID->OnIterationCallback = [PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope) { PCGEX_ASYNC_THIS \
+		for (const int32 ProcessorIndex : This->GetProcessingGroup(Index)) { const TSharedRef<IProcessor>& Processor = This->Processors[ProcessorIndex]; _BODY } }; \
+	_JIT\
+	_ID->StartIterations(GetNumProcessingGroups(), 1, _INLINE_CONDITION);
+
+#define PCGEX_ASYNC_MT_LOOP_VALID_GROUPS(_ID, _INLINE_CONDITION, _BODY, _JIT) PCGEX_ASYNC_MT_LOOP_GROUPS_TPL(_ID, _INLINE_CONDITION, if(Processor->bIsProcessorValid){ _BODY }, _JIT)
+
 #define PCGEX_ASYNC_PROCESSOR_LOOP(_NAME, _NUM, _PREPARE, _PROCESS, _COMPLETE, _INLINE, _PLI) \
 	PCGEX_CHECK_WORK_HANDLE_VOID\
 	if (IsTrivial()){ TRACE_CPUPROFILER_EVENT_SCOPE(StartParallelLoopFor##_NAME##_Trivial) PCGExMT::FScope TrivialScope = PCGExMT::FScope(0, _NUM, 0); _PREPARE({TrivialScope}); _PROCESS(TrivialScope); _COMPLETE(); }else{\
@@ -222,6 +233,14 @@ namespace PCGExPointsMT
 		TArray<TSharedRef<IProcessor>> Processors;
 		int32 GetNumProcessors() const { return Processors.Num(); }
 
+		/** Number of tasks batch-wide phases are dispatched as. One per processor unless size-aware batching packed some together. */
+		int32 GetNumProcessingGroups() const { return FMath::Max(0, ProcessingGroupOffsets.Num() - 1); }
+		TConstArrayView<int32> GetProcessingGroup(const int32 GroupIndex) const
+		{
+			const int32 Start = ProcessingGroupOffsets[GroupIndex];
+			return MakeArrayView(ProcessingOrder.GetData() + Start, ProcessingGroupOffsets[GroupIndex + 1] - Start);
+		}
+
 		IBatch(FPCGExContext* InContext, const TArray<TWeakPtr<PCGExData::FPointIO>>& InPointsCollection);
 		virtual ~IBatch() = default;
 
@@ -252,6 +271,11 @@ namespace PCGExPointsMT
 		virtual void Cleanup();
 
 	protected:
+		// Processor indices, grouped & ordered by decreasing cost
+		TArray<int32> ProcessingOrder;
+		TArray<int32> ProcessingGroupOffsets;
+
+		virtual void BuildProcessingGroups();
 		virtual void OnProcessingPreparationComplete();
 	};
 
@@ -30,6 +30,74 @@ namespace PCGExClusters
 		return ChainHelpers::BuildAndCacheChains(Context.Cluster);
 	}
 
+	TSharedPtr<ICachedClusterData> FChainCacheFactory::LoadSnapshot(const TSharedRef<FCluster>& InCluster, FArchive& Ar) const
+	{
+		const int32 NumNodes = InCluster->Nodes->Num();
+		const int32 NumEdges = InCluster->Edges->Num();
+
+		auto IsValidLink = [&](const FLink& Lk) { return FMath::IsWithin(Lk.Node, 0, NumNodes) && FMath::IsWithin(Lk.Edge, 0, NumEdges); };
+
+		int32 NumChains = 0;
+		Ar << NumChains;
+		if (Ar.IsError() || NumChains < 0 || NumChains > NumEdges) { return nullptr; }
+
+		TSharedPtr<FCachedChainData> Cached = MakeShared<FCachedChainData>();
+		Cached->Chains.Reserve(NumChains);
+
+		for (int32 i = 0; i < NumChains; i++)
+		{
+			FLink Seed;
+			int32 NumLinks = 0;
+			Ar << Seed.Node << Seed.Edge << NumLinks;
+			if (Ar.IsError() || !IsValidLink(Seed) || NumLinks < 0 || NumLinks > NumEdges) { return nullptr; }
+
+			TSharedPtr<FNodeChain> Chain = MakeShared<FNodeChain>(Seed);
+			Ar << Chain->SingleEdge << Chain->bIsClosedLoop << Chain->bIsLeaf << Chain->UniqueHash;
+
+			Chain->Links.SetNumUninitialized(NumLinks);
+			for (FLink& Lk : Chain->Links)
+			{
+				Ar << Lk.Node << Lk.Edge;
+				if (Ar.IsError() || !IsValidLink(Lk)) { return nullptr; }
+			}
+
+			if (Chain->SingleEdge < -1 || Chain->SingleEdge >= NumEdges) { return nullptr; }
+
+			Cached->Chains.Add(Chain);
+		}
+
+		return Ar.IsError() ? nullptr : Cached;
+	}
+
+#pragma endregion
+
+#pragma region FCachedChainData
+
+	bool FCachedChainData::SaveSnapshot(FArchive& Ar) const
+	{
+		int32 NumChains = Chains.Num();
+		Ar << NumChains;
+
+		for (const TSharedPtr<FNodeChain>& Chain : Chains)
+		{
+			if (!Chain) { return false; }
+
+			FLink Seed = Chain->Seed;
+			int32 SingleEdge = Chain->SingleEdge;
+			bool bIsClosedLoop = Chain->bIsClosedLoop;
+			bool bIsLeaf = Chain->bIsLeaf;
+			uint64 UniqueHash = Chain->UniqueHash;
+			int32 NumLinks = Chain->Links.Num();
+
+			Ar << Seed.Node << Seed.Edge << NumLinks;
+			Ar << SingleEdge << bIsClosedLoop << bIsLeaf << UniqueHash;
+
+			for (FLink Lk : Chain->Links) { Ar << Lk.Node << Lk.Edge; }
+		}
+
+		return !Ar.IsError();
+	}
+
 #pragma endregion
 
 #pragma region ChainHelpers
@@ -142,6 +142,12 @@ namespace PCGExClusters
 		NumFaces = 0;
 		bRawFacesEnumerated = false;
 		CachedRawFaces.Reset();
+
+		{
+			FWriteScopeLock WriteLock(FaceLookupLock);
+			FaceLookup.Reset();
+			bFaceLookupBuilt = false;
+		}
 	}
 
 	const TArray<FRawFace>& FPlanarFaceEnumerator::EnumerateRawFaces()
@@ -642,51 +648,265 @@ namespace PCGExClusters
 		return ECellResult::Success;
 	}
 
-	int32 FPlanarFaceEnumerator::FindFaceContaining(const FVector2D& Point) const
+	TConstArrayView<int32> FFaceLookup::GetCandidates(const FVector2D& Point) const
 	{
-		// Simple point-in-polygon test for each face
-		// This could be optimized with spatial indexing
-		TArray<FVector2D> FacePolygon;
+		if (CellOffsets.IsEmpty() || !GridBounds.IsInside(Point)) { return TConstArrayView<int32>(); }
 
-		for (int32 StartHE = 0; StartHE < HalfEdges.Num(); ++StartHE)
+		const int32 X = FMath::Clamp(FMath::FloorToInt32((Point.X - GridBounds.Min.X) * InvCellSize.X), 0, GridSize.X - 1);
+		const int32 Y = FMath::Clamp(FMath::FloorToInt32((Point.Y - GridBounds.Min.Y) * InvCellSize.Y), 0, GridSize.Y - 1);
+		const int32 Cell = Y * GridSize.X + X;
+
+		return TConstArrayView<int32>(CellFaces.GetData() + CellOffsets[Cell], CellOffsets[Cell + 1] - CellOffsets[Cell]);
+	}
+
+	void FFaceLookup::Reset()
+	{
+		HalfEdgeOffsets.Reset();
+		HalfEdgeIndices.Reset();
+		Polygons.Reset();
+		Bounds.Reset();
+		WrapperFaceIndex = -1;
+
+		GridBounds = FBox2D(ForceInit);
+		InvCellSize = FVector2D::ZeroVector;
+		GridSize = FIntPoint::ZeroValue;
+		CellOffsets.Reset();
+		CellFaces.Reset();
+	}
+
+	const FFaceLookup& FPlanarFaceEnumerator::GetOrBuildFaceLookup() const
+	{
 		{
-			const int32 FaceIdx = HalfEdges[StartHE].FaceIndex;
-			if (FaceIdx < 0) { continue; }
+			FReadScopeLock ReadLock(FaceLookupLock);
+			if (bFaceLookupBuilt) { return FaceLookup; }
+		}
 
-			// Check if we've already tested this face
-			bool bAlreadyTested = false;
-			for (int32 PrevHE = 0; PrevHE < StartHE; ++PrevHE)
+		{
+			FWriteScopeLock WriteLock(FaceLookupLock);
+			if (!bFaceLookupBuilt && bRawFacesEnumerated)
 			{
-				if (HalfEdges[PrevHE].FaceIndex == FaceIdx)
-				{
-					bAlreadyTested = true;
-					break;
-				}
+				BuildFaceLookup();
+				bFaceLookupBuilt = true;
 			}
-			if (bAlreadyTested) { continue; }
+		}
+
+		return FaceLookup;
+	}
+
+	void FPlanarFaceEnumerator::BuildFaceLookup() const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPlanarFaceEnumerator::BuildFaceLookup);
+
+		FaceLookup.Reset();
+
+		const int32 NumHalfEdges = HalfEdges.Num();
+		if (!NumFaces || !NumHalfEdges) { return; }
+
+		const TArray<FVector2D>& Positions = *ProjectedPositions;
+
+		// Group half-edges by face, keeping traversal order so each run doubles as the face polygon
+
+		TArray<int32>& Offsets = FaceLookup.HalfEdgeOffsets;
+		TArray<int32>& Grouped = FaceLookup.HalfEdgeIndices;
+
+		Offsets.SetNumZeroed(NumFaces + 1);
+		for (const FHalfEdge& HE : HalfEdges) { if (HE.FaceIndex >= 0) { Offsets[HE.FaceIndex + 1]++; } }
+		for (int32 i = 0; i < NumFaces; i++) { Offsets[i + 1] += Offsets[i]; }
+
+		Grouped.SetNumUninitialized(Offsets[NumFaces]);
+
+		TBitArray<> Written(false, NumFaces);
+		for (int32 StartHE = 0; StartHE < NumHalfEdges; ++StartHE)
+		{
+			const int32 FaceIdx = HalfEdges[StartHE].FaceIndex;
+			if (FaceIdx < 0 || Written[FaceIdx]) { continue; }
+			Written[FaceIdx] = true;
+
+			const int32 FaceStart = Offsets[FaceIdx];
+			const int32 FaceCount = Offsets[FaceIdx + 1] - FaceStart;
 
-			// Build face polygon (ProjectedPositions is node-indexed)
-			FacePolygon.Reset();
 			int32 CurrentHE = StartHE;
-			const int32 MaxSteps = HalfEdges.Num();
+			for (int32 Step = 0; Step < FaceCount; ++Step)
+			{
+				Grouped[FaceStart + Step] = CurrentHE;
+				CurrentHE = HalfEdges[CurrentHE].NextIndex;
+			}
+		}
 
-			for (int32 Step = 0; Step < MaxSteps; ++Step)
+		// Polygons, bounds & wrapper (largest absolute area, see GetWrapperFaceIndex)
+
+		FaceLookup.Polygons.SetNum(NumFaces);
+		FaceLookup.Bounds.Init(FBox2D(ForceInit), NumFaces);
+
+		double LargestArea = -MAX_dbl;
+
+		for (int32 FaceIdx = 0; FaceIdx < NumFaces; ++FaceIdx)
+		{
+			TArray<FVector2D>& Polygon = FaceLookup.Polygons[FaceIdx];
+			FBox2D& FaceBounds = FaceLookup.Bounds[FaceIdx];
+
+			const TConstArrayView<int32> FaceHalfEdges = FaceLookup.GetHalfEdges(FaceIdx);
+			Polygon.SetNumUninitialized(FaceHalfEdges.Num());
+
+			for (int32 i = 0; i < FaceHalfEdges.Num(); ++i)
 			{
-				const FHalfEdge& HE = HalfEdges[CurrentHE];
-				FacePolygon.Add((*ProjectedPositions)[HE.OriginNode]);
-				CurrentHE = HE.NextIndex;
-				if (CurrentHE == StartHE) { break; }
+				Polygon[i] = Positions[HalfEdges[FaceHalfEdges[i]].OriginNode];
+				FaceBounds += Polygon[i];
 			}
 
-			if (FacePolygon.Num() >= 3 && PCGExMath::Geo::IsPointInPolygon(Point, FacePolygon))
+			if (Polygon.Num() < 3) { continue; }
+
+			double SignedArea = 0;
+			for (int32 i = 0; i < Polygon.Num(); ++i)
 			{
-				return FaceIdx;
+				const FVector2D& P1 = Polygon[i];
+				const FVector2D& P2 = Polygon[(i + 1) % Polygon.Num()];
+				SignedArea += (P1.X * P2.Y - P2.X * P1.Y);
+			}
+
+			const double AbsArea = FMath::Abs(SignedArea * 0.5);
+			if (AbsArea > LargestArea)
+			{
+				LargestArea = AbsArea;
+				FaceLookup.WrapperFaceIndex = FaceIdx;
 			}
 		}
 
+		// Uniform grid over bounded faces, sized for roughly one face per cell
+
+		FBox2D& GridBounds = FaceLookup.GridBounds;
+		for (int32 FaceIdx = 0; FaceIdx < NumFaces; ++FaceIdx)
+		{
+			if (FaceIdx != FaceLookup.WrapperFaceIndex && FaceLookup.Bounds[FaceIdx].bIsValid) { GridBounds += FaceLookup.Bounds[FaceIdx]; }
+		}
+
+		if (!GridBounds.bIsValid) { return; }
+
+		constexpr int32 MaxGridResolution = 1024;
+
+		const FVector2D GridExtent = GridBounds.GetSize().ComponentMax(FVector2D(UE_KINDA_SMALL_NUMBER));
+		const double CellSize = FMath::Sqrt(GridExtent.X * GridExtent.Y / NumFaces);
+
+		FIntPoint& GridSize = FaceLookup.GridSize;
+		GridSize.X = FMath::Clamp(FMath::CeilToInt32(GridExtent.X / FMath::Max(CellSize, UE_KINDA_SMALL_NUMBER)), 1, MaxGridResolution);
+		GridSize.Y = FMath::Clamp(FMath::CeilToInt32(GridExtent.Y / FMath::Max(CellSize, UE_KINDA_SMALL_NUMBER)), 1, MaxGridResolution);
+
+		FaceLookup.InvCellSize = FVector2D(GridSize.X / GridExtent.X, GridSize.Y / GridExtent.Y);
+
+		auto GetCellRect = [&](const FBox2D& InBounds, FIntPoint& OutMin, FIntPoint& OutMax)
+		{
+			OutMin.X = FMath::Clamp(FMath::FloorToInt32((InBounds.Min.X - GridBounds.Min.X) * FaceLookup.InvCellSize.X), 0, GridSize.X - 1);
+			OutMin.Y = FMath::Clamp(FMath::FloorToInt32((InBounds.Min.Y - GridBounds.Min.Y) * FaceLookup.InvCellSize.Y), 0, GridSize.Y - 1);
+			OutMax.X = FMath::Clamp(FMath::FloorToInt32((InBounds.Max.X - GridBounds.Min.X) * FaceLookup.InvCellSize.X), 0, GridSize.X - 1);
+			OutMax.Y = FMath::Clamp(FMath::FloorToInt32((InBounds.Max.Y - GridBounds.Min.Y) * FaceLookup.InvCellSize.Y), 0, GridSize.Y - 1);
+		};
+
+		// Count then scatter
+
+		TArray<int32>& CellOffsets = FaceLookup.CellOffsets;
+		CellOffsets.SetNumZeroed(GridSize.X * GridSize.Y + 1);
+
+		FIntPoint RectMin;
+		FIntPoint RectMax;
+
+		for (int32 FaceIdx = 0; FaceIdx < NumFaces; ++FaceIdx)
+		{
+			if (FaceIdx == FaceLookup.WrapperFaceIndex || FaceLookup.Polygons[FaceIdx].Num() < 3) { continue; }
+			GetCellRect(FaceLookup.Bounds[FaceIdx], RectMin, RectMax);
+			for (int32 Y = RectMin.Y; Y <= RectMax.Y; ++Y) { for (int32 X = RectMin.X; X <= RectMax.X; ++X) { CellOffsets[Y * GridSize.X + X + 1]++; } }
+		}
+
+		for (int32 i = 1; i < CellOffsets.Num(); ++i) { CellOffsets[i] += CellOffsets[i - 1]; }
+
+		FaceLookup.CellFaces.SetNumUninitialized(CellOffsets.Last());
+
+		TArray<int32> Cursors(CellOffsets.GetData(), CellOffsets.Num() - 1);
+		for (int32 FaceIdx = 0; FaceIdx < NumFaces; ++FaceIdx)
+		{
+			if (FaceIdx == FaceLookup.WrapperFaceIndex || FaceLookup.Polygons[FaceIdx].Num() < 3) { continue; }
+			GetCellRect(FaceLookup.Bounds[FaceIdx], RectMin, RectMax);
+			for (int32 Y = RectMin.Y; Y <= RectMax.Y; ++Y) { for (int32 X = RectMin.X; X <= RectMax.X; ++X) { FaceLookup.CellFaces[Cursors[Y * GridSize.X + X]++] = FaceIdx; } }
+		}
+	}
+
+	bool FPlanarFaceEnumerator::IsInFace(const FVector2D& Point, const int32 FaceIndex) const
+	{
+		const TArray<FVector2D>& Polygon = FaceLookup.Polygons[FaceIndex];
+		return Polygon.Num() >= 3 && FaceLookup.Bounds[FaceIndex].IsInside(Point) && PCGExMath::Geo::IsPointInPolygon(Point, Polygon);
+	}
+
+	int32 FPlanarFaceEnumerator::FindFaceContaining(const FVector2D& Point) const
+	{
+		const FFaceLookup& Lookup = GetOrBuildFaceLookup();
+		if (!Lookup.Num()) { return -1; }
+
+		for (const int32 FaceIdx : Lookup.GetCandidates(Point))
+		{
+			if (IsInFace(Point, FaceIdx)) { return FaceIdx; }
+		}
+
+		if (Lookup.WrapperFaceIndex != -1 && IsInFace(Point, Lookup.WrapperFaceIndex)) { return Lookup.WrapperFaceIndex; }
+
 		return -1;
 	}
 
+	void FPlanarFaceEnumerator::FindFacesContaining(const FVector2D& Point, TArray<int32>& OutFaces, const int32 ExcludedFaceIndex) const
+	{
+		OutFaces.Reset();
+
+		const FFaceLookup& Lookup = GetOrBuildFaceLookup();
+		if (!Lookup.Num()) { return; }
+
+		for (const int32 FaceIdx : Lookup.GetCandidates(Point))
+		{
+			if (FaceIdx != ExcludedFaceIndex && IsInFace(Point, FaceIdx)) { OutFaces.Add(FaceIdx); }
+		}
+
+		// The wrapper is kept out of the grid, only test it if the caller didn't exclude it
+		if (Lookup.WrapperFaceIndex != -1 && Lookup.WrapperFaceIndex != ExcludedFaceIndex && IsInFace(Point, Lookup.WrapperFaceIndex))
+		{
+			OutFaces.Add(Lookup.WrapperFaceIndex);
+		}
+	}
+
+	void FPlanarFaceEnumerator::BucketPointsByFace(TConstArrayView<FVector2D> Points, TArray<int32>& OutOffsets, TArray<int32>& OutPointIndices, const int32 ExcludedFaceIndex) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPlanarFaceEnumerator::BucketPointsByFace);
+
+		const FFaceLookup& Lookup = GetOrBuildFaceLookup();
+		const int32 NumLookupFaces = Lookup.Num();
+
+		OutOffsets.SetNumZeroed(NumLookupFaces + 1);
+		OutPointIndices.Reset();
+
+		if (!NumLookupFaces) { return; }
+
+		// Locate every point once, then counting-sort the (face, point) pairs so each face lists its points in ascending order
+		TArray<int32> PointFaces;
+		TArray<int32> PointFaceOffsets;
+		PointFaceOffsets.SetNumUninitialized(Points.Num() + 1);
+		PointFaceOffsets[0] = 0;
+
+		TArray<int32> Found;
+		for (int32 i = 0; i < Points.Num(); ++i)
+		{
+			FindFacesContaining(Points[i], Found, ExcludedFaceIndex);
+			for (const int32 FaceIdx : Found) { OutOffsets[FaceIdx + 1]++; }
+			PointFaces.Append(Found);
+			PointFaceOffsets[i + 1] = PointFaces.Num();
+		}
+
+		for (int32 i = 0; i < NumLookupFaces; ++i) { OutOffsets[i + 1] += OutOffsets[i]; }
+
+		OutPointIndices.SetNumUninitialized(OutOffsets.Last());
+
+		TArray<int32> Cursors(OutOffsets.GetData(), NumLookupFaces);
+		for (int32 i = 0; i < Points.Num(); ++i)
+		{
+			for (int32 j = PointFaceOffsets[i]; j < PointFaceOffsets[i + 1]; ++j) { OutPointIndices[Cursors[PointFaces[j]]++] = i; }
+		}
+	}
+
 	TMap<int32, TSet<int32>> FPlanarFaceEnumerator::BuildCellAdjacencyMap(int32 WrapperFaceIndex) const
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FPlanarFaceEnumerator::BuildCellAdjacencyMap);
@@ -754,12 +974,13 @@ namespace PCGExClusters
 
 		if (!bRawFacesEnumerated || FaceIndex < 0 || HalfEdges.IsEmpty()) { return; }
 
-		TSet<int32> UniqueAdjacent;
+		const FFaceLookup& Lookup = GetOrBuildFaceLookup();
+		if (FaceIndex >= Lookup.Num()) { return; }
 
-		// Find all half-edges belonging to this face and check their twins
-		for (const FHalfEdge& HE : HalfEdges)
+		// Walk this face's half-edges and check their twins
+		for (const int32 HEIdx : Lookup.GetHalfEdges(FaceIndex))
 		{
-			if (HE.FaceIndex != FaceIndex) { continue; }
+			const FHalfEdge& HE = HalfEdges[HEIdx];
 
 			// Get the twin's face
 			if (HE.TwinIndex < 0 || HE.TwinIndex >= HalfEdges.Num()) { continue; }
@@ -768,10 +989,8 @@ namespace PCGExClusters
 			// Skip if invalid or wrapper
 			if (AdjacentFace < 0 || AdjacentFace == WrapperFaceIndex) { continue; }
 
-			UniqueAdjacent.Add(AdjacentFace);
+			OutAdjacentFaces.AddUnique(AdjacentFace);
 		}
-
-		OutAdjacentFaces = UniqueAdjacent.Array();
 	}
 
 	void FPlanarFaceEnumerator::GetFaceHalfEdges(int32 FaceIndex, TArray<int32>& OutHalfEdgeIndices) const
@@ -780,66 +999,15 @@ namespace PCGExClusters
 
 		if (!bRawFacesEnumerated || FaceIndex < 0 || HalfEdges.IsEmpty()) { return; }
 
-		for (int32 HEIdx = 0; HEIdx < HalfEdges.Num(); ++HEIdx)
-		{
-			if (HalfEdges[HEIdx].FaceIndex == FaceIndex)
-			{
-				OutHalfEdgeIndices.Add(HEIdx);
-			}
-		}
+		const FFaceLookup& Lookup = GetOrBuildFaceLookup();
+		if (FaceIndex >= Lookup.Num()) { return; }
+
+		OutHalfEdgeIndices.Append(Lookup.GetHalfEdges(FaceIndex));
 	}
 
 	int32 FPlanarFaceEnumerator::GetWrapperFaceIndex() const
 	{
-		// The wrapper face is the one with the largest (most negative for CCW) signed area
-		// or equivalently the face that would have CW winding when all others have CCW
-		double LargestArea = -MAX_dbl;
-		int32 WrapperIdx = -1;
-
-		TArray<FVector2D> FacePolygon;
-		TSet<int32> ProcessedFaces;
-
-		for (int32 StartHE = 0; StartHE < HalfEdges.Num(); ++StartHE)
-		{
-			const int32 FaceIdx = HalfEdges[StartHE].FaceIndex;
-			if (FaceIdx < 0 || ProcessedFaces.Contains(FaceIdx)) { continue; }
-			ProcessedFaces.Add(FaceIdx);
-
-			// Build face polygon (ProjectedPositions is node-indexed)
-			FacePolygon.Reset();
-			int32 CurrentHE = StartHE;
-			const int32 MaxSteps = HalfEdges.Num();
-
-			for (int32 Step = 0; Step < MaxSteps; ++Step)
-			{
-				const FHalfEdge& HE = HalfEdges[CurrentHE];
-				FacePolygon.Add((*ProjectedPositions)[HE.OriginNode]);
-				CurrentHE = HE.NextIndex;
-				if (CurrentHE == StartHE) { break; }
-			}
-
-			if (FacePolygon.Num() >= 3)
-			{
-				// Compute signed area - wrapper will have opposite sign
-				double SignedArea = 0;
-				for (int32 i = 0; i < FacePolygon.Num(); ++i)
-				{
-					const FVector2D& P1 = FacePolygon[i];
-					const FVector2D& P2 = FacePolygon[(i + 1) % FacePolygon.Num()];
-					SignedArea += (P1.X * P2.Y - P2.X * P1.Y);
-				}
-				SignedArea *= 0.5;
-
-				// The wrapper face will have the largest absolute area
-				const double AbsArea = FMath::Abs(SignedArea);
-				if (AbsArea > LargestArea)
-				{
-					LargestArea = AbsArea;
-					WrapperIdx = FaceIdx;
-				}
-			}
-		}
-
-		return WrapperIdx;
+		// The wrapper face is the one with the largest absolute signed area, resolved once when building the lookup
+		return GetOrBuildFaceLookup().WrapperFaceIndex;
 	}
 }
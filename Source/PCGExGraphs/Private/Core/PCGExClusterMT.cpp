@@ -115,6 +115,24 @@ namespace PCGExClusterMT
 			Cluster = HandleCachedCluster(CachedCluster.ToSharedRef());
 		}
 
+		PCGExClusters::Helpers::FPersistentClusterKey PersistentKey;
+		// Edges store their IO index, so it's part of what makes a cached cluster reusable as-is
+		const uint32 BuildOptions = HashCombineFast(bIsOneToOne ? 1 : 0, static_cast<uint32>(EdgeDataFacade->Source->IOIndex));
+
+		if (!Cluster)
+		{
+			if (const TSharedPtr<PCGExClusters::FCluster> CachedCluster = PCGExClusters::Helpers::TryGetPersistentCluster(VtxDataFacade->Source, EdgeDataFacade->Source, BuildOptions, PersistentKey))
+			{
+				PersistentCluster = CachedCluster;
+				PersistentContentKey = PersistentKey.ContentKey;
+				Cluster = HandleCachedCluster(CachedCluster.ToSharedRef());
+				// Processors are free to edit their cluster in place; the subsystem's copy must outlive this execution untouched
+				Cluster->DetachStructure();
+				Cluster->InheritCachedData(*CachedCluster);
+				Cluster->bIsOneToOne = bIsOneToOne;
+			}
+		}
+
 		if (!Cluster)
 		{
 			Cluster = MakeShared<PCGExClusters::FCluster>(VtxDataFacade->Source, EdgeDataFacade->Source, NodeIndexLookup);
@@ -126,6 +144,17 @@ namespace PCGExClusterMT
 				Cluster.Reset();
 				return false;
 			}
+
+			if (PersistentKey.IsValid())
+			{
+				// Keep the pristine build in the subsystem and work on a mirror, same as with bound clusters
+				PersistentCluster = Cluster;
+				PCGExClusters::Helpers::CachePersistentCluster(VtxDataFacade->Source, EdgeDataFacade->Source, BuildOptions, PersistentKey, PersistentCluster);
+				PersistentContentKey = PersistentKey.ContentKey;
+				Cluster = HandleCachedCluster(PersistentCluster.ToSharedRef());
+				Cluster->DetachStructure();
+				Cluster->bIsOneToOne = bIsOneToOne;
+			}
 		}
 
 		if (ProjectedVtxPositions)
@@ -247,6 +276,18 @@ namespace PCGExClusterMT
 
 	void IProcessor::Cleanup()
 	{
+		if (PersistentCluster && Cluster && Cluster->HasSameStructure(*PersistentCluster))
+		{
+			// Structure wasn't modified, portable data cached along the way is still valid for the next execution.
+			// Octrees aren't handed over; node bounds aren't part of the content key.
+			if (PersistentCluster->InheritCachedData(*Cluster))
+			{
+				PCGExClusters::Helpers::UpdatePersistentClusterSnapshot(PersistentContentKey, PersistentCluster);
+			}
+		}
+
+		PersistentCluster.Reset();
+		PersistentContentKey = PCGExClusters::FClusterContentKey();
 		HeuristicsHandler.Reset();
 		VtxFiltersManager.Reset();
 		EdgesFiltersManager.Reset();
@@ -598,6 +639,21 @@ namespace PCGExClusterMT
 			};
 		}
 
+		if (bCompileFromClusters)
+		{
+			TArray<TSharedPtr<PCGExClusters::FCluster>> Clusters;
+			Clusters.Reserve(Processors.Num());
+
+			for (const TSharedRef<IProcessor>& P : Processors)
+			{
+				if (!P->bIsProcessorValid || !P->Cluster) { continue; }
+				Clusters.Add(P->Cluster);
+			}
+
+			GraphBuilder->CompileClustersAsync(TaskManager, Clusters, true, GetGraphMetadataDetails());
+			return;
+		}
+
 		GraphBuilder->CompileAsync(TaskManager, true, GetGraphMetadataDetails());
 	}
 
@@ -7,6 +7,7 @@
 #include "Clusters/PCGExEdge.h"
 #include "Core/PCGExMTCommon.h"
 #include "Graphs/PCGExSubGraph.h"
+#include "Sorting/PCGExSortingHelpers.h"
 
 namespace PCGExGraphs
 {
@@ -97,7 +98,7 @@ namespace PCGExGraphs
 		uint32 A;
 		uint32 B;
 
-		UniqueEdges.Reserve(UniqueEdges.Num() + UniqueEdges.Num());
+		UniqueEdges.Reserve(UniqueEdges.Num() + InEdges.Num());
 		Edges.Reserve(Edges.Num() + InEdges.Num());
 
 		for (const uint64 E : InEdges)
@@ -257,91 +258,135 @@ namespace PCGExGraphs
 		const int32 NumNodes = Nodes.Num();
 		const int32 NumEdges = Edges.Num();
 
-		TArray<bool> VisitedNodes;
-		VisitedNodes.Init(false, NumNodes);
-		TArray<bool> VisitedEdges;
-		VisitedEdges.Init(false, NumEdges);
+		// Roaming nodes can't be part of any subgraph
+		PCGEX_PARALLEL_FOR(
+			NumNodes,
+			FNode& Node = Nodes[i];
+			Node.NumExportedEdges = 0;
+			if (Node.IsEmpty()) { Node.bValid = false; }
+		)
+
+		auto IsUsable = [&](const FEdge& Edge) { return Edge.bValid && Nodes[Edge.Start].bValid && Nodes[Edge.End].bValid; };
 
-		int32 VisitedNodesNum = 0;
-		int32 VisitedEdgesNum = 0;
+		// Lock-free union-find over usable edges.
+		// Roots are always hooked under a smaller index, so each component ends up rooted at its smallest node index.
 
-		TArray<int32> Stack;
-		Stack.Reserve(NumNodes);
-		OutValidNodes.Reserve(NumNodes);
+		TArray<int32> Parents;
+		Parents.SetNumUninitialized(NumNodes);
+		PCGEX_PARALLEL_FOR(NumNodes, Parents[i] = i;)
 
-		for (int32 i = 0; i < NumNodes; i++)
+		auto FindRoot = [&](int32 Index)
 		{
-			FNode& CurrentNode = Nodes[i];
-			if (VisitedNodes[i])
+			while (true)
 			{
-				continue;
-			}
+				const int32 Parent = FPlatformAtomics::AtomicRead(&Parents[Index]);
+				if (Parent == Index) { return Index; }
 
-			if (!CurrentNode.bValid || CurrentNode.IsEmpty())
-			{
-				CurrentNode.bValid = false;
-				continue;
+				// Path halving; losing the race to another writer is harmless
+				const int32 GrandParent = FPlatformAtomics::AtomicRead(&Parents[Parent]);
+				if (Parent != GrandParent) { FPlatformAtomics::InterlockedCompareExchange(&Parents[Index], GrandParent, Parent); }
+				Index = GrandParent;
 			}
+		};
 
-			Stack.Reset();
-			Stack.Add(i);
-			VisitedNodes[i] = true;
-			VisitedNodesNum++;
+		PCGEX_PARALLEL_FOR(
+			NumEdges,
+			const FEdge& Edge = Edges[i];
+			if (!IsUsable(Edge)) { return; }
 
-			TSharedPtr<FSubGraph> SubGraph = MakeShared<FSubGraph>();
-			SubGraph->WeakParentGraph = SharedThis(this);
-			SubGraph->Nodes.Reserve(NumNodes - VisitedNodesNum);
-			SubGraph->Edges.Reserve(NumEdges - VisitedEdgesNum);
+			int32 A = Edge.Start;
+			int32 B = Edge.End;
 
-			while (!Stack.IsEmpty())
+			while (true)
 			{
-				const int32 NodeIndex = Stack.Pop(EAllowShrinking::No);
-				SubGraph->Nodes.Add(NodeIndex);
-				FNode& Node = Nodes[NodeIndex];
-				Node.NumExportedEdges = 0;
-
-				for (const FLink& Lk : Node.Links)
-				{
-					const int32 E = Lk.Edge;
-					if (VisitedEdges[E]) { continue; }
-
-					VisitedEdges[E] = true;
-					VisitedEdgesNum++;
-
-					FEdge& Edge = Edges[E];
-					if (!Edge.bValid) { continue; }
-
-					const int32 OtherIndex = Edge.Other(NodeIndex);
-					if (!Nodes[OtherIndex].bValid) { continue; }
-
-					SubGraph->Add(Edge);
-
-					if (!VisitedNodes[OtherIndex])
-					{
-						VisitedNodes[OtherIndex] = true;
-						VisitedNodesNum++;
-						Stack.Add(OtherIndex);
-					}
-				}
-			}
+				A = FindRoot(A);
+				B = FindRoot(B);
+				if (A == B) { break; }
+				if (A > B) { Swap(A, B); }
 
-			if (!Limits.IsValid(SubGraph->Nodes.Num(), SubGraph->Edges.Num()))
-			{
-				for (const int32 j : SubGraph->Nodes) { Nodes[j].bValid = false; }
-				for (const PCGEx::FIndexKey j : SubGraph->Edges) { Edges[j.Index].bValid = false; }
+				// Retry if B got hooked elsewhere in the meantime
+				if (FPlatformAtomics::InterlockedCompareExchange(&Parents[B], A, B) == B) { break; }
 			}
-			else if (!SubGraph->Edges.IsEmpty())
+		)
+
+		// Group nodes & edges by component root. Sorts are stable, so both keep their original order within a component.
+
+		TArray<PCGEx::FIndexKey> NodeKeys;
+		TArray<PCGEx::FIndexKey> EdgeKeys;
+		NodeKeys.SetNumUninitialized(NumNodes);
+		EdgeKeys.SetNumUninitialized(NumEdges);
+
+		PCGEX_PARALLEL_FOR(NumNodes, NodeKeys[i] = PCGEx::FIndexKey(i, Nodes[i].bValid ? FindRoot(i) : MAX_uint64);)
+		PCGEX_PARALLEL_FOR(NumEdges, EdgeKeys[i] = PCGEx::FIndexKey(i, IsUsable(Edges[i]) ? FindRoot(Edges[i].Start) : MAX_uint64);)
+
+		PCGExSortingHelpers::ParallelRadixSort(NodeKeys);
+		PCGExSortingHelpers::ParallelRadixSort(EdgeKeys);
+
+		struct FComponent
+		{
+			int32 NodeStart = 0;
+			int32 NumNodes = 0;
+			int32 EdgeStart = 0;
+			int32 NumEdges = 0;
+		};
+
+		// Components are ordered by smallest node index, same as a traversal in index order would discover them
+		TArray<FComponent> Components;
+
+		for (int32 n = 0, e = 0; n < NumNodes && NodeKeys[n].Key != MAX_uint64;)
+		{
+			const uint64 Root = NodeKeys[n].Key;
+
+			FComponent& Component = Components.Emplace_GetRef();
+			Component.NodeStart = n;
+			Component.EdgeStart = e;
+
+			while (n < NumNodes && NodeKeys[n].Key == Root) { n++; }
+			while (e < NumEdges && EdgeKeys[e].Key == Root) { e++; }
+
+			Component.NumNodes = n - Component.NodeStart;
+			Component.NumEdges = e - Component.EdgeStart;
+		}
+
+		TArray<TSharedPtr<FSubGraph>> ComponentSubGraphs;
+		ComponentSubGraphs.SetNum(Components.Num());
+
+		const TWeakPtr<FGraph> WeakThis = SharedThis(this);
+
+		PCGEX_PARALLEL_FOR(
+			Components.Num(),
+			const FComponent& Component = Components[i];
+
+			if (!Limits.IsValid(Component.NumNodes, Component.NumEdges))
 			{
-				OutValidNodes.Append(SubGraph->Nodes);
-				SubGraph->Shrink();
-				SubGraphs.Add(SubGraph.ToSharedRef());
+				for (int32 n = 0; n < Component.NumNodes; n++) { Nodes[NodeKeys[Component.NodeStart + n].Index].bValid = false; }
+				for (int32 e = 0; e < Component.NumEdges; e++) { Edges[EdgeKeys[Component.EdgeStart + e].Index].bValid = false; }
+				return;
 			}
+
+			if (!Component.NumEdges) { return; }
+
+			PCGEX_MAKE_SHARED(SubGraph, FSubGraph)
+			SubGraph->WeakParentGraph = WeakThis;
+
+			SubGraph->Nodes.SetNumUninitialized(Component.NumNodes);
+			for (int32 n = 0; n < Component.NumNodes; n++) { SubGraph->Nodes[n] = NodeKeys[Component.NodeStart + n].Index; }
+
+			SubGraph->Edges.Reserve(Component.NumEdges);
+			for (int32 e = 0; e < Component.NumEdges; e++) { SubGraph->Add(Edges[EdgeKeys[Component.EdgeStart + e].Index]); }
+
+			ComponentSubGraphs[i] = SubGraph;
+		)
+
+		OutValidNodes.Reserve(OutValidNodes.Num() + NumNodes);
+		for (const TSharedPtr<FSubGraph>& SubGraph : ComponentSubGraphs)
+		{
+			if (!SubGraph) { continue; }
+			OutValidNodes.Append(SubGraph->Nodes);
+			SubGraphs.Add(SubGraph.ToSharedRef());
 		}
 
-		// Recompute NumExportedEdges deterministically based on actual edge connections.
-		// The BFS traversal order affects which node "claims" each shared edge, making
-		// NumExportedEdges non-deterministic when Node.Links order varies (parallel insertion).
-		// Count valid edges per node directly from Links - parallelizable and cache-friendly.
+		// Count valid edges per node directly from Links, so NumExportedEdges doesn't depend on Links order (parallel insertion).
 		PCGEX_PARALLEL_FOR(
 			OutValidNodes.Num(), 
 			
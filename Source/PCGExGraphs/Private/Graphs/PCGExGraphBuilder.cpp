@@ -3,16 +3,22 @@
 
 #include "Graphs/PCGExGraphBuilder.h"
 
+#include "PCGExCoreSettingsCache.h"
 #include "Core/PCGExContext.h"
 #include "Data/PCGExClusterData.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExDataTags.h"
 #include "Data/PCGExPointIO.h"
 #include "Clusters/PCGExCluster.h"
+#include "Clusters/PCGExClusterCache.h"
 #include "Clusters/PCGExClustersHelpers.h"
+#include "Clusters/Artifacts/PCGExCachedFaceEnumerator.h"
+#include "Clusters/Artifacts/PCGExCachedChain.h"
 #include "Graphs/PCGExGraph.h"
 #include "Clusters/PCGExClusterCommon.h"
 #include "Graphs/PCGExSubGraph.h"
+#include "Helpers/PCGExPointArrayDataHelpers.h"
+#include "Helpers/PCGExRandomHelpers.h"
 #include "Sorting/PCGExSortingHelpers.h"
 
 namespace PCGExGraphTask
@@ -37,6 +43,28 @@ namespace PCGExGraphTask
 			Builder->Compile(TaskManager, bWriteNodeFacade, MetadataDetails);
 		}
 	};
+
+	class FCompileGraphFromClusters final : public PCGExMT::FTask
+	{
+	public:
+		PCGEX_ASYNC_TASK_NAME(FCompileGraphFromClusters)
+
+		FCompileGraphFromClusters(const TSharedPtr<PCGExGraphs::FGraphBuilder>& InGraphBuilder, const TArray<TSharedPtr<PCGExClusters::FCluster>>& InClusters, const bool bInWriteNodeFacade, const PCGExGraphs::FGraphMetadataDetails* InMetadataDetails = nullptr)
+			: FTask(), Builder(InGraphBuilder), Clusters(InClusters), bWriteNodeFacade(bInWriteNodeFacade), MetadataDetails(InMetadataDetails)
+		{
+		}
+
+		TSharedPtr<PCGExGraphs::FGraphBuilder> Builder;
+		TArray<TSharedPtr<PCGExClusters::FCluster>> Clusters;
+		const bool bWriteNodeFacade = false;
+		const PCGExGraphs::FGraphMetadataDetails* MetadataDetails = nullptr;
+
+		virtual void ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& TaskManager) override
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(FCompileGraphFromClusters::ExecuteTask);
+			Builder->CompileClusters(TaskManager, Clusters, bWriteNodeFacade, MetadataDetails);
+		}
+	};
 }
 
 namespace PCGExGraphs
@@ -211,7 +239,7 @@ namespace PCGExGraphs
 						MortonHash[i] = PCGEx::FIndexKey(Idx, PCGEx::MH64(NodePointsTransforms[Idx].GetLocation()));
 					)
 
-					PCGExSortingHelpers::RadixSort(MortonHash);
+					PCGExSortingHelpers::ParallelRadixSort(MortonHash);
 
 					PCGEX_PARALLEL_FOR(
 						NumValidNodes,
@@ -243,7 +271,7 @@ namespace PCGExGraphs
 			// Reorder output indices if provided
 			// Needed for delaunay etc that rely on original indices to identify sites etc
 			TArray<int32>& OutputPointIndicesRef = *OutputPointIndices.Get();
-			for (int32 i = 0; i < NumValidNodes; i++) { OutputPointIndicesRef[i] = ReadIndices[i]; }
+			PCGEX_PARALLEL_FOR(NumValidNodes, OutputPointIndicesRef[i] = ReadIndices[i];)
 		}
 
 		{
@@ -297,10 +325,7 @@ namespace PCGExGraphs
 			{
 				TRACE_CPUPROFILER_EVENT_SCOPE(SortSubGraphs);
 
-				for (const TSharedRef<FSubGraph>& SubGraph : Graph->SubGraphs)
-				{
-					SubGraph->ComputeMinPointIndex(Nodes);
-				}
+				PCGEX_PARALLEL_FOR(Graph->SubGraphs.Num(), Graph->SubGraphs[i]->ComputeMinPointIndex(Nodes);)
 
 				Graph->SubGraphs.Sort([](const TSharedRef<FSubGraph>& A, const TSharedRef<FSubGraph>& B)
 				{
@@ -370,6 +395,323 @@ namespace PCGExGraphs
 		BatchCompileSubGraphs->StartIterations(Graph->SubGraphs.Num(), 1, false);
 	}
 
+	void FGraphBuilder::CompileClustersAsync(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager, const TArray<TSharedPtr<PCGExClusters::FCluster>>& InClusters, const bool bWriteNodeFacade, const FGraphMetadataDetails* MetadataDetails)
+	{
+		TaskManager = InTaskManager;
+		PCGEX_SHARED_THIS_DECL
+		PCGEX_LAUNCH(PCGExGraphTask::FCompileGraphFromClusters, ThisPtr, InClusters, bWriteNodeFacade, MetadataDetails)
+	}
+
+	void FGraphBuilder::CompileClusters(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager, const TArray<TSharedPtr<PCGExClusters::FCluster>>& InClusters, const bool bWriteNodeFacade, const FGraphMetadataDetails* MetadataDetails)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FGraphBuilder::CompileClusters);
+
+		if (TArray<TSharedPtr<PCGExClusters::FCluster>> OrderedClusters; CanCompileDelta(InClusters, OrderedClusters))
+		{
+			check(!bCompiling)
+
+			bCompiling = true;
+			TaskManager = InTaskManager;
+			MetadataDetailsPtr = MetadataDetails;
+			bWriteVtxDataFacadeWithCompile = bWriteNodeFacade;
+
+			CompileDelta(OrderedClusters);
+			return;
+		}
+
+		// Regular compilation from the clusters' valid edges
+		TArray<FEdge> ValidEdges;
+		for (const TSharedPtr<PCGExClusters::FCluster>& Cluster : InClusters)
+		{
+			ValidEdges.Reset();
+			Cluster->GetValidEdges(ValidEdges);
+			if (!ValidEdges.IsEmpty()) { Graph->InsertEdges(ValidEdges); }
+		}
+
+		Compile(InTaskManager, bWriteNodeFacade, MetadataDetails);
+	}
+
+	void FGraphBuilder::PrebuildCachedData(const TSharedRef<PCGExClusters::FCluster>& InCluster) const
+	{
+		if (!OutputDetails) { return; }
+
+		// Native: FaceEnumerator
+		if (OutputDetails->bPreBuildFaceEnumerator)
+		{
+			PCGExClusters::FClusterCacheBuildContext Context(InCluster);
+			Context.Projection = &OutputDetails->FaceEnumeratorProjection;
+
+			if (PCGExClusters::IClusterCacheFactory* Factory = PCGExClusters::FClusterCacheRegistry::Get().GetFactory(
+				PCGExClusters::FFaceEnumeratorCacheFactory::CacheKey))
+			{
+				if (TSharedPtr<PCGExClusters::ICachedClusterData> CachedData = Factory->Build(Context))
+				{
+					InCluster->SetCachedData(Factory->GetCacheKey(), CachedData);
+				}
+			}
+		}
+
+		// Native: Node Chains
+		if (OutputDetails->bPreBuildChains)
+		{
+			PCGExClusters::FClusterCacheBuildContext Context(InCluster);
+
+			if (PCGExClusters::IClusterCacheFactory* Factory = PCGExClusters::FClusterCacheRegistry::Get().GetFactory(
+				PCGExClusters::FChainCacheFactory::CacheKey))
+			{
+				if (TSharedPtr<PCGExClusters::ICachedClusterData> CachedData = Factory->Build(Context))
+				{
+					InCluster->SetCachedData(Factory->GetCacheKey(), CachedData);
+				}
+			}
+		}
+	}
+
+	bool FGraphBuilder::CanCompileDelta(const TArray<TSharedPtr<PCGExClusters::FCluster>>& InClusters, TArray<TSharedPtr<PCGExClusters::FCluster>>& OutClusters) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FGraphBuilder::CanCompileDelta);
+
+		// Anything already inserted in the graph would be lost
+		if (InClusters.IsEmpty() || !Graph->Edges.IsEmpty()) { return false; }
+
+		// Vtx must be inherited for them to be output as-is
+		const UPCGBasePointData* InNodeData = NodeDataFacade->GetIn();
+		if (!bInheritNodeData || !InNodeData) { return false; }
+
+		const int32 NumClusters = InClusters.Num();
+
+		// Smallest vtx index of each cluster, -1 if the cluster doesn't qualify
+		TArray<int32> MinPointIndices;
+		MinPointIndices.Init(-1, NumClusters);
+
+		PCGEX_PARALLEL_FOR(
+			NumClusters,
+
+			const PCGExClusters::FCluster& Cluster = *InClusters[i].Get();
+			if (!Cluster.EdgesIO.IsValid()) { return; }
+
+			const TArray<PCGExClusters::FNode>& ClusterNodes = *Cluster.Nodes;
+			const TArray<FEdge>& ClusterEdges = *Cluster.Edges;
+			const int32 NumClusterNodes = ClusterNodes.Num();
+			if (!NumClusterNodes) { return; }
+
+			// Nodes must cover a contiguous vtx range, otherwise compilation would reorder them
+			int32 MinPointIndex = MAX_int32;
+			int32 MaxPointIndex = -1;
+			for (const PCGExClusters::FNode& Node : ClusterNodes)
+			{
+				MinPointIndex = FMath::Min(MinPointIndex, Node.PointIndex);
+				MaxPointIndex = FMath::Max(MaxPointIndex, Node.PointIndex);
+			}
+
+			if (MaxPointIndex - MinPointIndex + 1 != NumClusterNodes) { return; }
+
+			// Kept edges must already be in the order compilation would sort them in
+			int32 NumValidEdges = 0;
+			uint64 LastKey = 0;
+			for (const FEdge& Edge : ClusterEdges)
+			{
+				if (!Cluster.IsEdgeFullyValid(Edge)) { continue; }
+				const uint64 Key = Edge.H64U();
+				if (NumValidEdges && Key <= LastKey) { return; }
+				LastKey = Key;
+				NumValidEdges++;
+			}
+
+			if (!NumValidEdges || !OutputDetails->IsValid(NumClusterNodes, NumValidEdges)) { return; }
+
+			// Every node must remain reachable through valid edges, otherwise the cluster either loses vtx or splits
+			TBitArray<> Visited;
+			Visited.Init(false, NumClusterNodes);
+			Visited[0] = true;
+
+			TArray<int32> Stack;
+			Stack.Reserve(NumClusterNodes);
+			Stack.Add(0);
+
+			int32 NumVisited = 1;
+			while (!Stack.IsEmpty())
+			{
+				const PCGExClusters::FNode& Node = ClusterNodes[Stack.Pop(EAllowShrinking::No)];
+				for (const FLink Lk : Node.Links)
+				{
+					if (Visited[Lk.Node] || !Cluster.IsEdgeFullyValid(ClusterEdges[Lk.Edge])) { continue; }
+					Visited[Lk.Node] = true;
+					Stack.Add(Lk.Node);
+					NumVisited++;
+				}
+			}
+
+			if (NumVisited == NumClusterNodes) { MinPointIndices[i] = MinPointIndex; }
+		)
+
+		// Clusters must tile the vtx in order, which is how compilation lays them out
+		TArray<int32> Order;
+		PCGExArrayHelpers::ArrayOfIndices(Order, NumClusters);
+		Order.Sort([&](const int32 A, const int32 B) { return MinPointIndices[A] < MinPointIndices[B]; });
+
+		int32 NextPointIndex = 0;
+		for (const int32 i : Order)
+		{
+			if (MinPointIndices[i] != NextPointIndex) { return false; }
+			NextPointIndex += InClusters[i]->Nodes->Num();
+		}
+
+		if (NextPointIndex != InNodeData->GetNumPoints()) { return false; }
+
+		OutClusters.Reset(NumClusters);
+		for (const int32 i : Order) { OutClusters.Add(InClusters[i]); }
+
+		return true;
+	}
+
+	void FGraphBuilder::CompileDelta(const TArray<TSharedPtr<PCGExClusters::FCluster>>& InClusters)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FGraphBuilder::CompileDelta);
+
+		NodeIndexLookup = InClusters[0]->NodeIndexLookup;
+		NodeDataFacade->Source->ClearCachedKeys(); //Ensure fresh keys later on
+
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(FGraphBuilder::CompileDelta::InheritVtx);
+
+			// Vtx are output as-is
+			const int32 NumVtx = NodeDataFacade->GetIn()->GetNumPoints();
+			if (UPCGBasePointData* OutNodeData = NodeDataFacade->GetOut(); OutNodeData->GetNumPoints() != NumVtx)
+			{
+				OutNodeData->SetNumPoints(NumVtx);
+				NodeDataFacade->Source->InheritProperties(0, 0, NumVtx);
+			}
+		}
+
+		const TSharedPtr<PCGExData::TBuffer<int64>> VtxEndpointWriter = NodeDataFacade->GetWritable<int64>(PCGExClusters::Labels::Attr_PCGExVtxIdx, 0, false, PCGExData::EBufferInit::New);
+		const TSharedPtr<TArray<int64>> VtxEndpoints = StaticCastSharedPtr<PCGExData::TArrayBuffer<int64>>(VtxEndpointWriter)->GetOutValues();
+
+		bCompiledSuccessfully = true;
+
+		TArray<TSharedPtr<PCGExData::FPointIO>> OutEdgeIOs;
+		OutEdgeIOs.Reserve(InClusters.Num());
+
+		for (int i = 0; i < InClusters.Num(); i++)
+		{
+			const TSharedPtr<PCGExData::FPointIO> EdgeIO = EdgesIO->Emplace_GetRef<UPCGExClusterEdgesData>(InClusters[i]->EdgesIO.Pin(), PCGExData::EIOInit::New);
+			if (!EdgeIO) { return; }
+
+			EdgeIO->IOIndex = i;
+			OutEdgeIOs.Add(EdgeIO);
+
+			PCGExClusters::Helpers::MarkClusterEdges(EdgeIO, PairId);
+		}
+
+		PCGExClusters::Helpers::MarkClusterVtx(NodeDataFacade->Source, PairId);
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, BatchCompileDeltas)
+
+		BatchCompileDeltas->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE]()
+		{
+			PCGEX_ASYNC_THIS
+			This->OnCompilationEnd();
+		};
+
+		BatchCompileDeltas->OnIterationCallback = [PCGEX_ASYNC_THIS_CAPTURE, InClusters, OutEdgeIOs, VtxEndpoints](const int32 Index, const PCGExMT::FScope& Scope)
+		{
+			PCGEX_ASYNC_THIS
+			This->CompileClusterDelta(InClusters[Index], OutEdgeIOs[Index], *VtxEndpoints);
+		};
+
+		BatchCompileDeltas->StartIterations(InClusters.Num(), 1, false);
+	}
+
+	void FGraphBuilder::CompileClusterDelta(const TSharedPtr<PCGExClusters::FCluster>& InCluster, const TSharedPtr<PCGExData::FPointIO>& InEdgeIO, TArray<int64>& OutVtxEndpoints) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FGraphBuilder::CompileClusterDelta);
+
+		TArray<int32> KeptEdges;
+		InCluster->CompactEdges(KeptEdges);
+
+		// Clusters don't share vtx, writes don't overlap
+		for (const PCGExClusters::FNode& Node : *InCluster->Nodes) { OutVtxEndpoints[Node.PointIndex] = PCGEx::H64(Node.PointIndex, Node.Num()); }
+
+		const int32 NumEdges = KeptEdges.Num();
+
+		EPCGPointNativeProperties AllocateProperties = InEdgeIO->GetIn()->GetAllocatedProperties();
+
+		if (OutputDetails->bWriteEdgePosition)
+		{
+			AllocateProperties |= EPCGPointNativeProperties::Transform;
+		}
+
+		if (OutputDetails->BasicEdgeSolidification.SolidificationAxis != EPCGExMinimalAxis::None)
+		{
+			AllocateProperties |= EPCGPointNativeProperties::Transform;
+			AllocateProperties |= EPCGPointNativeProperties::BoundsMin;
+			AllocateProperties |= EPCGPointNativeProperties::BoundsMax;
+		}
+
+		if (Graph->bRefreshEdgeSeed || OutputDetails->bRefreshEdgeSeed)
+		{
+			AllocateProperties |= EPCGPointNativeProperties::Seed;
+		}
+
+		// Compact kept edge points in a single pass; metadata entries are inherited as-is
+		UPCGBasePointData* OutEdgeData = InEdgeIO->GetOut();
+		(void)PCGExPointArrayDataHelpers::SetNumPointsAllocated(OutEdgeData, NumEdges, AllocateProperties);
+		InEdgeIO->InheritPoints(KeptEdges, 0);
+
+		const TSharedPtr<PCGExData::FFacade> EdgesDataFacade = MakeShared<PCGExData::FFacade>(InEdgeIO.ToSharedRef());
+		const TSharedPtr<PCGExData::TBuffer<int64>> EdgeEndpointsWriter = EdgesDataFacade->GetWritable<int64>(PCGExClusters::Labels::Attr_PCGExEdgeIdx, -1, false, PCGExData::EBufferInit::New);
+
+		TSharedPtr<PCGExData::TBuffer<double>> EdgeLength;
+		if (OutputDetails->bOutputEdgeLength)
+		{
+			if (!PCGExMetaHelpers::IsWritableAttributeName(OutputDetails->EdgeLengthName))
+			{
+				PCGE_LOG_C(Error, GraphAndLog, TaskManager->GetContext(), FTEXT("Invalid user-defined attribute name for Edge Length."));
+			}
+			else
+			{
+				EdgeLength = EdgesDataFacade->GetWritable<double>(OutputDetails->EdgeLengthName, 0, true, PCGExData::EBufferInit::New);
+			}
+		}
+
+		const TConstPCGValueRange<FTransform> VtxTransforms = NodeDataFacade->GetOut()->GetConstTransformValueRange();
+		TPCGValueRange<int32> EdgeSeeds = OutEdgeData->GetSeedValueRange(false);
+		const FVector SeedOffset = FVector(InEdgeIO->IOIndex);
+
+		const TArray<FEdge>& Edges = *InCluster->Edges;
+		for (int i = 0; i < NumEdges; i++)
+		{
+			const FEdge& E = Edges[i];
+
+			PCGExData::FMutablePoint EdgePt = EdgesDataFacade->GetOutPoint(i);
+
+			EdgeEndpointsWriter->SetValue(i, PCGEx::H64(E.Start, E.End));
+
+			if (OutputDetails->bWriteEdgePosition)
+			{
+				OutputDetails->BasicEdgeSolidification.Mutate(EdgePt, NodeDataFacade->GetOutPoint(E.Start), NodeDataFacade->GetOutPoint(E.End), OutputDetails->EdgePosition);
+			}
+
+			if (EdgeLength) { EdgeLength->SetValue(i, FVector::Dist(VtxTransforms[E.Start].GetLocation(), VtxTransforms[E.End].GetLocation())); }
+
+			if (EdgeSeeds[i] == 0 || Graph->bRefreshEdgeSeed) { EdgeSeeds[i] = PCGExRandomHelpers::ComputeSpatialSeed(EdgePt.GetLocation(), SeedOffset); }
+		}
+
+		// The patched cluster now describes the output
+		InCluster->BindTo(NodeDataFacade->Source, InEdgeIO);
+
+		if (PCGEX_CORE_SETTINGS.bCacheClusters && Graph->bBuildClusters)
+		{
+			if (UPCGExClusterEdgesData* ClusterEdgesData = Cast<UPCGExClusterEdgesData>(OutEdgeData))
+			{
+				ClusterEdgesData->SetBoundCluster(InCluster);
+				PrebuildCachedData(InCluster.ToSharedRef());
+			}
+		}
+
+		EdgesDataFacade->WriteFastest(TaskManager);
+	}
+
 	void FGraphBuilder::OnCompilationEnd()
 	{
 		TSharedRef<FGraphBuilder> Self = SharedThis(this);
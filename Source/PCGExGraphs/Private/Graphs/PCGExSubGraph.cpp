@@ -12,9 +12,6 @@
 #include "Metadata/PCGMetadata.h"
 
 #include "Clusters/PCGExCluster.h"
-#include "Clusters/PCGExClusterCache.h"
-#include "Clusters/Artifacts/PCGExCachedFaceEnumerator.h"
-#include "Clusters/Artifacts/PCGExCachedChain.h"
 #include "Details/PCGExBlendingDetails.h"
 #include "Core/PCGExOpStats.h"
 #include "Data/PCGExClusterData.h"
@@ -53,42 +50,7 @@ namespace PCGExGraphTask
 			SubGraph->BuildCluster(NewCluster.ToSharedRef());
 
 			// Build pre-configured caches
-			if (const TSharedPtr<PCGExGraphs::FGraphBuilder> Builder = SubGraph->GetBuilder())
-			{
-				if (Builder->OutputDetails)
-				{
-					// Native: FaceEnumerator
-					if (Builder->OutputDetails->bPreBuildFaceEnumerator)
-					{
-						PCGExClusters::FClusterCacheBuildContext Context(NewCluster.ToSharedRef());
-						Context.Projection = &Builder->OutputDetails->FaceEnumeratorProjection;
-
-						if (PCGExClusters::IClusterCacheFactory* Factory = PCGExClusters::FClusterCacheRegistry::Get().GetFactory(
-							PCGExClusters::FFaceEnumeratorCacheFactory::CacheKey))
-						{
-							if (TSharedPtr<PCGExClusters::ICachedClusterData> CachedData = Factory->Build(Context))
-							{
-								NewCluster->SetCachedData(Factory->GetCacheKey(), CachedData);
-							}
-						}
-					}
-
-					// Native: Node Chains
-					if (Builder->OutputDetails->bPreBuildChains)
-					{
-						PCGExClusters::FClusterCacheBuildContext Context(NewCluster.ToSharedRef());
-
-						if (PCGExClusters::IClusterCacheFactory* Factory = PCGExClusters::FClusterCacheRegistry::Get().GetFactory(
-							PCGExClusters::FChainCacheFactory::CacheKey))
-						{
-							if (TSharedPtr<PCGExClusters::ICachedClusterData> CachedData = Factory->Build(Context))
-							{
-								NewCluster->SetCachedData(Factory->GetCacheKey(), CachedData);
-							}
-						}
-					}
-				}
-			}
+			if (const TSharedPtr<PCGExGraphs::FGraphBuilder> Builder = SubGraph->GetBuilder()) { Builder->PrebuildCachedData(NewCluster.ToSharedRef()); }
 		}
 	};
 }
@@ -164,7 +126,7 @@ namespace PCGExGraphs
 			)
 		}
 
-		PCGExSortingHelpers::RadixSort(Edges);
+		PCGExSortingHelpers::ParallelRadixSort(Edges);
 
 		FlattenedEdges.SetNumUninitialized(NumEdges);
 
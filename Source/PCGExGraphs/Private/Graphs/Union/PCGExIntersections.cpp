@@ -7,6 +7,8 @@
 #include "PCGExH.h"
 
 #include "Async/ParallelFor.h"
+#include "Containers/PCGExArena.h"
+#include "Core/PCGExContext.h"
 #include "Details/PCGExIntersectionDetails.h"
 #include "Data/PCGExPointIO.h"
 #include "Blenders/PCGExMetadataBlender.h"
@@ -36,6 +38,8 @@ namespace PCGExGraphs
 		NodesUnion = MakeShared<PCGExData::FUnionMetadata>();
 		EdgesUnion = MakeShared<PCGExData::FUnionMetadata>();
 
+		Arena = MakeShared<PCGExMT::FArena>();
+
 		if (FuseDetails.FuseMethod == EPCGExFuseMethod::Octree)
 		{
 			Octree = MakeUnique<FUnionNodeOctree>(Bounds.GetCenter(), Bounds.GetExtent().Length() + 10);
@@ -44,11 +48,14 @@ namespace PCGExGraphs
 
 	bool FUnionGraph::Init(FPCGExContext* InContext)
 	{
+		// Share the execution arena so nodes are released in bulk along with everything else
+		if (InContext && InContext->Arena && Nodes.IsEmpty()) { Arena = InContext->Arena; }
 		return FuseDetails.Init(InContext, nullptr);
 	}
 
 	bool FUnionGraph::Init(FPCGExContext* InContext, const TSharedPtr<PCGExData::FFacade>& InUniqueSourceFacade, const bool SupportScopedGet)
 	{
+		if (InContext && InContext->Arena && Nodes.IsEmpty()) { Arena = InContext->Arena; }
 		return FuseDetails.Init(InContext, InUniqueSourceFacade);
 	}
 
@@ -97,7 +104,7 @@ namespace PCGExGraphs
 				}
 
 				NodesUnion->NewEntry_Unsafe(Point);
-				return NodeBinsShards.Add(GridKey, Nodes.Add(MakeShared<FUnionNode>(Point, Origin, Nodes.Num())));
+				return NodeBinsShards.Add(GridKey, Nodes.Add(Arena->New<FUnionNode>(Point, Origin, Nodes.Num())));
 			}
 		}
 
@@ -125,8 +132,8 @@ namespace PCGExGraphs
 			}
 
 			// Still holding the lock — safe to insert
-			const TSharedPtr<FUnionNode> Node = MakeShared<FUnionNode>(Point, Origin, Nodes.Num());
-			Octree->AddElement(Node.Get());
+			FUnionNode* Node = Arena->New<FUnionNode>(Point, Origin, Nodes.Num());
+			Octree->AddElement(Node);
 			NodesUnion->NewEntry_Unsafe(Point);
 			return Nodes.Add(Node);
 		}
@@ -176,7 +183,7 @@ namespace PCGExGraphs
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FUnionGraph::WriteNodeMetadata)
 
-		for (const TSharedPtr<FUnionNode>& Node : Nodes)
+		for (const FUnionNode* Node : Nodes)
 		{
 			const TSharedPtr<PCGExData::IUnionData>& UnionData = NodesUnion->Entries[Node->Index];
 			FGraphNodeMetadata& NodeMeta = InGraph->GetOrCreateNodeMetadata_Unsafe(Node->Index);
@@ -228,7 +235,7 @@ namespace PCGExGraphs
 		}
 
 		// 4. Reorder Nodes
-		TArray<TSharedPtr<FUnionNode>> SortedNodes;
+		TArray<FUnionNode*> SortedNodes;
 		SortedNodes.SetNum(N);
 		for (int32 i = 0; i < N; i++)
 		{
@@ -275,7 +282,7 @@ namespace PCGExGraphs
 			}
 
 			Graph.NodesUnion->NewEntry_Unsafe(Point);
-			return Graph.NodeBinsShards.Add(GridKey, Graph.Nodes.Add(MakeShared<FUnionNode>(Point, Origin, Graph.Nodes.Num())));
+			return Graph.NodeBinsShards.Add(GridKey, Graph.Nodes.Add(Graph.Arena->New<FUnionNode>(Point, Origin, Graph.Nodes.Num())));
 		}
 
 		PCGExMath::FClosestPosition ClosestNode(Origin);
@@ -299,8 +306,8 @@ namespace PCGExGraphs
 			return ClosestNode.Index;
 		}
 
-		const TSharedPtr<FUnionNode> Node = MakeShared<FUnionNode>(Point, Origin, Graph.Nodes.Num());
-		Graph.Octree->AddElement(Node.Get());
+		FUnionNode* Node = Graph.Arena->New<FUnionNode>(Point, Origin, Graph.Nodes.Num());
+		Graph.Octree->AddElement(Node);
 		Graph.NodesUnion->NewEntry_Unsafe(Point);
 		return Graph.Nodes.Add(Node);
 	}
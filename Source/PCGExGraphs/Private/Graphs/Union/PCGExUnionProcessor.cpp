@@ -9,6 +9,7 @@
 #include "Data/PCGExPointIO.h"
 #include "Blenders/PCGExUnionBlender.h"
 #include "Clusters/PCGExClusterCommon.h"
+#include "Core/PCGExBlendPlan.h"
 #include "Core/PCGExElement.h"
 #include "Core/PCGExProxyDataBlending.h"
 #include "Data/PCGExData.h"
@@ -86,6 +87,7 @@ namespace PCGExGraphs
 			const TSharedPtr<PCGExBlending::IUnionBlender> Blender = This->UnionBlender;
 
 			TArray<PCGExData::FWeightedPoint> WeightedPoints;
+			PCGExBlending::FBlendSources Sources;
 			TArray<PCGEx::FOpStats> Trackers;
 			Blender->InitTrackers(Trackers);
 
@@ -94,7 +96,7 @@ namespace PCGExGraphs
 
 			PCGEX_SCOPE_LOOP(Index)
 			{
-				TSharedPtr<FUnionNode> UnionNode = This->UnionGraph->Nodes[Index];
+				const FUnionNode* UnionNode = This->UnionGraph->Nodes[Index];
 
 				//const PCGMetadataEntryKey Key = OutPoints[i].MetadataEntry;
 				//OutPoints[Index] = UnionNode->Point; // Copy "original" point properties, in case  there's only one
@@ -103,8 +105,9 @@ namespace PCGExGraphs
 				//Point.MetadataEntry = Key; // Restore key
 
 				OutTransforms[Index].SetLocation(UnionNode->GetCenter());
-				Blender->MergeSingle(Index, WeightedPoints, Trackers);
 			}
+
+			Blender->MergeScope(Scope, Sources, WeightedPoints, Trackers);
 		};
 
 		ProcessNodesGroup->StartSubLoops(NumUnionNodes, PCGEX_CORE_SETTINGS.ClusterDefaultBatchChunkSize * 2, false);
@@ -19,6 +19,9 @@ namespace PCGExClusters
 	{
 	public:
 		TArray<TSharedPtr<FNodeChain>> Chains;
+
+		virtual bool SaveSnapshot(FArchive& Ar) const override;
+		virtual bool IsPortable() const override { return true; }
 	};
 
 	/**
@@ -35,6 +38,7 @@ namespace PCGExClusters
 		virtual EClusterCacheType GetCacheType() const override { return EClusterCacheType::PreBuild; }
 
 		virtual TSharedPtr<ICachedClusterData> Build(const FClusterCacheBuildContext& Context) const override;
+		virtual TSharedPtr<ICachedClusterData> LoadSnapshot(const TSharedRef<FCluster>& InCluster, FArchive& Ar) const override;
 	};
 
 	/**
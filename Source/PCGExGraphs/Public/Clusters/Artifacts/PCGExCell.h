@@ -101,6 +101,9 @@ namespace PCGExClusters
 			return ProjectedPoints[Index];
 		}
 
+		/** Get all projected points. Caller must call EnsureProjected() first. */
+		FORCEINLINE const TArray<FVector2D>& GetProjectedPoints() const { return ProjectedPoints; }
+
 		int32 Num() const;
 		FORCEINLINE const FBox2D& GetBounds() const { return TightBounds; }
 	};
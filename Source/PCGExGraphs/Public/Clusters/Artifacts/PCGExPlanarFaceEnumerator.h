@@ -54,6 +54,38 @@ namespace PCGExClusters
 		explicit FRawFace(int32 InFaceIndex) : FaceIndex(InFaceIndex) {}
 	};
 
+	/**
+	 * Per-face lookup, built once after enumeration.
+	 * Half-edges grouped by face, per-face 2D polygon & bounds, and a uniform grid over face bounds for point location.
+	 * The wrapper face is kept out of the grid since its bounds cover everything.
+	 */
+	struct PCGEXGRAPHS_API FFaceLookup
+	{
+		TArray<int32> HalfEdgeOffsets; // NumFaces + 1
+		TArray<int32> HalfEdgeIndices; // Half-edges in traversal order, grouped by face
+		TArray<TArray<FVector2D>> Polygons;
+		TArray<FBox2D> Bounds;
+		int32 WrapperFaceIndex = -1;
+
+		FBox2D GridBounds = FBox2D(ForceInit);
+		FVector2D InvCellSize = FVector2D::ZeroVector;
+		FIntPoint GridSize = FIntPoint::ZeroValue;
+		TArray<int32> CellOffsets; // NumCells + 1
+		TArray<int32> CellFaces;
+
+		FORCEINLINE int32 Num() const { return Bounds.Num(); }
+
+		FORCEINLINE TConstArrayView<int32> GetHalfEdges(const int32 FaceIndex) const
+		{
+			return TConstArrayView<int32>(HalfEdgeIndices.GetData() + HalfEdgeOffsets[FaceIndex], HalfEdgeOffsets[FaceIndex + 1] - HalfEdgeOffsets[FaceIndex]);
+		}
+
+		/** Faces whose bounds overlap the grid cell containing Point */
+		TConstArrayView<int32> GetCandidates(const FVector2D& Point) const;
+
+		void Reset();
+	};
+
 	/**
 	 * DCEL-based planar face enumerator.
 	 * Builds a proper half-edge structure and enumerates all faces by following next pointers.
@@ -81,6 +113,11 @@ namespace PCGExClusters
 		mutable int32 CachedAdjacencyWrapperIndex = INDEX_NONE;
 		mutable bool bAdjacencyMapCached = false;
 
+		// Cached face lookup (lazy-computed, thread-safe)
+		mutable FRWLock FaceLookupLock;
+		mutable FFaceLookup FaceLookup;
+		mutable bool bFaceLookupBuilt = false;
+
 	public:
 		FPlanarFaceEnumerator() = default;
 
@@ -145,13 +182,38 @@ namespace PCGExClusters
 			TArray<TSharedPtr<FCell>>* OutFailedCells = nullptr,
 			bool bDetectWrapper = false);
 		
+		/**
+		 * Get or build the cached face lookup.
+		 * Requires EnumerateRawFaces() to have been called first, returns an empty lookup otherwise.
+		 */
+		const FFaceLookup& GetOrBuildFaceLookup() const;
+
 		/**
 		 * Find the face containing a given 2D point.
+		 * Bounded faces are tested first; the wrapper face is only returned if no other face contains the point.
 		 * @param Point The 2D point to test
 		 * @return Face index, or -1 if not found
 		 */
 		int32 FindFaceContaining(const FVector2D& Point) const;
 
+		/**
+		 * Find all faces containing a given 2D point (more than one only if the projection isn't planar).
+		 * @param Point The 2D point to test
+		 * @param OutFaces Output face indices
+		 * @param ExcludedFaceIndex Face to skip, typically the wrapper
+		 */
+		void FindFacesContaining(const FVector2D& Point, TArray<int32>& OutFaces, int32 ExcludedFaceIndex = -1) const;
+
+		/**
+		 * Bucket points by the faces containing them.
+		 * Points belonging to face F are OutPointIndices[OutOffsets[F]..OutOffsets[F+1]), in ascending order.
+		 * @param Points 2D points to locate
+		 * @param OutOffsets Output per-face offsets (NumFaces + 1)
+		 * @param OutPointIndices Output point indices, grouped by face
+		 * @param ExcludedFaceIndex Face to skip, typically the wrapper
+		 */
+		void BucketPointsByFace(TConstArrayView<FVector2D> Points, TArray<int32>& OutOffsets, TArray<int32>& OutPointIndices, int32 ExcludedFaceIndex = -1) const;
+
 		/**
 		 * Get the outer (wrapper) face index.
 		 * This is the unbounded face surrounding the entire graph.
@@ -210,7 +272,7 @@ namespace PCGExClusters
 		void GetAdjacentFaces(int32 FaceIndex, TArray<int32>& OutAdjacentFaces, int32 WrapperFaceIndex = -1) const;
 
 		/**
-		 * Get the half-edges that belong to a specific face.
+		 * Get the half-edges that belong to a specific face, in traversal order.
 		 * @param FaceIndex The face to query
 		 * @param OutHalfEdgeIndices Output array of half-edge indices belonging to this face
 		 */
@@ -222,5 +284,8 @@ namespace PCGExClusters
 			const TArray<int32>& FaceNodes,
 			TSharedPtr<FCell>& OutCell,
 			const TSharedRef<FCellConstraints>& Constraints) const;
+
+		void BuildFaceLookup() const;
+		bool IsInFace(const FVector2D& Point, const int32 FaceIndex) const;
 	};
 }
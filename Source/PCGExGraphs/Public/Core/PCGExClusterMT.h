@@ -1,9 +1,10 @@
-// Copyright 2026 Timothé Lapetite and contributors
+﻿// Copyright 2026 Timothé Lapetite and contributors
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #pragma once
 #include "PCGExVersion.h"
 #include "PCGExCommon.h"
+#include "Clusters/PCGExClusterCacheKey.h"
 #include "Clusters/PCGExEdgeDirectionDetails.h"
 #include "Core/PCGExContext.h"
 #include "Graphs/PCGExGraphDetails.h"
@@ -131,6 +132,8 @@ namespace PCGExClusterMT
 		TArray<int32>* ExpectedAdjacency = nullptr;
 
 		TSharedPtr<PCGExClusters::FCluster> Cluster;
+		TSharedPtr<PCGExClusters::FCluster> PersistentCluster; // Subsystem-cached cluster this processor's cluster mirrors, if any
+		PCGExClusters::FClusterContentKey PersistentContentKey;
 
 		TSharedPtr<PCGExGraphs::FGraphBuilder> GraphBuilder;
 
@@ -237,6 +240,10 @@ namespace PCGExClusterMT
 		EPCGExHeuristicScoreMode HeuristicsScoreMode = EPCGExHeuristicScoreMode::WeightedAverage;
 		bool bRequiresGraphBuilder = false;
 
+		// Processors flag edges on their cluster instead of inserting them in the graph builder,
+		// which then compiles straight from the clusters. See FGraphBuilder::CompileClustersAsync.
+		bool bCompileFromClusters = false;
+
 		bool bWantsProjection = false;
 		bool bWantsPerClusterProjection = false;
 		FPCGExGeo2DProjectionDetails ProjectionDetails;
@@ -18,10 +18,16 @@ namespace PCGEx
 
 namespace PCGExData
 {
+	class FPointIO;
 	class FPointIOCollection;
 	class FFacade;
 }
 
+namespace PCGExClusters
+{
+	class FCluster;
+}
+
 namespace PCGExMT
 {
 	class FTaskManager;
@@ -96,7 +102,27 @@ namespace PCGExGraphs
 		void CompileAsync(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager, const bool bWriteNodeFacade, const FGraphMetadataDetails* MetadataDetails = nullptr);
 		void Compile(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager, const bool bWriteNodeFacade, const FGraphMetadataDetails* MetadataDetails = nullptr);
 
+		/**
+		 * Compile the valid edges of clusters that were refined in-place, instead of edges inserted in the graph.
+		 * When a regular compile would output vtx as-is, the clusters are patched in-place and their edge points compacted in a single pass,
+		 * skipping the graph entirely (see CanCompileDelta). Otherwise, their valid edges are inserted in the graph and compiled as usual.
+		 */
+		void CompileClustersAsync(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager, const TArray<TSharedPtr<PCGExClusters::FCluster>>& InClusters, const bool bWriteNodeFacade, const FGraphMetadataDetails* MetadataDetails = nullptr);
+		void CompileClusters(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager, const TArray<TSharedPtr<PCGExClusters::FCluster>>& InClusters, const bool bWriteNodeFacade, const FGraphMetadataDetails* MetadataDetails = nullptr);
+
+		/** Build the cached data OutputDetails asks for on a freshly compiled cluster */
+		void PrebuildCachedData(const TSharedRef<PCGExClusters::FCluster>& InCluster) const;
+
 	protected:
+		/**
+		 * Whether clusters can be compiled as a delta of their input, i.e. every vtx belongs to a cluster that stays in one piece,
+		 * clusters cover contiguous & ordered vtx ranges, and kept edges are already in compiled order.
+		 * @param OutClusters Clusters in output order
+		 */
+		bool CanCompileDelta(const TArray<TSharedPtr<PCGExClusters::FCluster>>& InClusters, TArray<TSharedPtr<PCGExClusters::FCluster>>& OutClusters) const;
+		void CompileDelta(const TArray<TSharedPtr<PCGExClusters::FCluster>>& InClusters);
+		void CompileClusterDelta(const TSharedPtr<PCGExClusters::FCluster>& InCluster, const TSharedPtr<PCGExData::FPointIO>& InEdgeIO, TArray<int64>& OutVtxEndpoints) const;
+
 		void OnCompilationEnd();
 
 	public:
@@ -41,6 +41,8 @@ namespace PCGExMT
 {
 	template <typename T>
 	class TScopedArray;
+
+	class FArena;
 }
 
 namespace PCGExGraphs
@@ -52,7 +54,8 @@ namespace PCGExGraphs
 
 #pragma region Compound Graph
 
-	class PCGEXGRAPHS_API FUnionNode : public TSharedFromThis<FUnionNode>
+	// Allocated from the union graph's arena, owned by it
+	class PCGEXGRAPHS_API FUnionNode
 	{
 	public:
 		const PCGExData::FConstPoint Point;
@@ -82,7 +85,8 @@ namespace PCGExGraphs
 		TWeakPtr<PCGExData::FPointIOCollection> SourceCollection = nullptr;
 		TSharedPtr<PCGExData::FUnionMetadata> NodesUnion;
 		TSharedPtr<PCGExData::FUnionMetadata> EdgesUnion;
-		TArray<TSharedPtr<FUnionNode>> Nodes;
+		TSharedPtr<PCGExMT::FArena> Arena;
+		TArray<FUnionNode*> Nodes;
 
 		PCGExMT::TH64MapShards<int32> EdgesMapShards;
 		TArray<FEdge> Edges;
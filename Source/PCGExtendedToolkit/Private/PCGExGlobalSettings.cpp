@@ -51,10 +51,16 @@ void UPCGExGlobalSettings::UpdateSettingsCaches() const
 	PCGEX_PUSH_SETTING(Core, bCacheClusters)
 	PCGEX_PUSH_SETTING(Core, bDefaultScopedIndexLookupBuild)
 	PCGEX_PUSH_SETTING(Core, bDefaultBuildAndCacheClusters)
+	PCGEX_PUSH_SETTING(Core, bPersistentClusterCache)
+	PCGEX_PUSH_SETTING(Core, PersistentClusterCacheBudget)
+	PCGEX_PUSH_SETTING(Core, bClusterSnapshots)
+	PCGEX_PUSH_SETTING(Core, ClusterSnapshotsBudget)
 
 	PCGEX_PUSH_SETTING(Core, SmallPointsSize)
 	PCGEX_PUSH_SETTING(Core, SmallClusterSize)
 	PCGEX_PUSH_SETTING(Core, PointsDefaultBatchChunkSize)
+	PCGEX_PUSH_SETTING(Core, bSizeAwareBatching)
+	PCGEX_PUSH_SETTING(Core, PathSegmentSize)
 	PCGEX_PUSH_SETTING(Core, ClusterDefaultBatchChunkSize)
 
 #if WITH_EDITOR
@@ -70,6 +70,22 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bCacheClusters"))
 	bool bDefaultBuildAndCacheClusters = true;
 
+	/** Keep built clusters around across executions, so unchanged vtx/edges don't have to be rebuilt. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bCacheClusters"))
+	bool bPersistentClusterCache = true;
+
+	/** Memory budget (in MB) for persistent clusters. Least recently used clusters are evicted first. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bCacheClusters && bPersistentClusterCache", ClampMin=1))
+	int32 PersistentClusterCacheBudget = 256;
+
+	/** Also write persistent clusters to disk as binary snapshots (Saved/PCGEx/ClusterSnapshots), so unchanged graphs skip reconstruction across sessions. Snapshots are keyed by content & written in the background. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bCacheClusters && bPersistentClusterCache"))
+	bool bClusterSnapshots = false;
+
+	/** Disk budget (in MB) for cluster snapshots. Least recently used snapshots are deleted first. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bCacheClusters && bPersistentClusterCache && bClusterSnapshots", ClampMin=1))
+	int32 ClusterSnapshotsBudget = 1024;
+
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Points", meta=(ClampMin=1))
 	int32 SmallPointsSize = 1024;
 	bool IsSmallPointSize(const int32 InNum) const { return InNum <= SmallPointsSize; }
@@ -78,6 +94,14 @@ public:
 	int32 PointsDefaultBatchChunkSize = 1024;
 	int32 GetPointsBatchChunkSize(const int32 In = -1) const { return In <= -1 ? PointsDefaultBatchChunkSize : In; }
 
+	/** Schedule point batches by input size : small inputs are packed into shared tasks, larger ones start first and are split into finer chunks. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Points")
+	bool bSizeAwareBatching = true;
+
+	/** Paths with more points than this have their path-wide passes (edges, edge extras, convexity) split into segments processed in parallel. Results are identical to a single pass. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Points", meta=(ClampMin=1024))
+	int32 PathSegmentSize = 65536;
+
 	/** If enabled, debug generated by PCG will not be transient. (Pre-5.6 behavior) (Requires restarting the editor.)*/
 	UPROPERTY(EditAnywhere, config, Category = "Debug")
 	bool bPersistentDebug = false;